@@ -0,0 +1,138 @@
+/**
+ * @file bullet_discrete_query_context.h
+ * @brief Tesseract Bullet discrete read-only query context.
+ *
+ * @date Oct 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef TESSERACT_COLLISION_BULLET_DISCRETE_QUERY_CONTEXT_H
+#define TESSERACT_COLLISION_BULLET_DISCRETE_QUERY_CONTEXT_H
+
+#include <tesseract_collision/bullet/bullet_utils.h>
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/bullet/tesseract_collision_configuration.h>
+
+namespace tesseract_collision::tesseract_collision_bullet
+{
+/**
+ * @brief A bullet read-only query context shared by the bullet discrete managers
+ * @details The collision objects are shallow copies of the managers collision objects which share the bullet collision
+ * shapes, so only the transforms, margins and filters are owned by the context. The context owns its own collision
+ * dispatcher and pool allocators because they are not thread safe. When created with a broadphase the context owns
+ * its own bullet BVH broadphase like the BulletDiscreteBVHManager. Otherwise the contact test checks every active
+ * object against all other objects with overlapping bounding boxes like the BulletDiscreteSimpleManager, which is
+ * O(active * n).
+ */
+class BulletDiscreteQueryContext : public DiscreteContactQueryContext
+{
+public:
+  using Ptr = std::shared_ptr<BulletDiscreteQueryContext>;
+  using ConstPtr = std::shared_ptr<const BulletDiscreteQueryContext>;
+  using UPtr = std::unique_ptr<BulletDiscreteQueryContext>;
+  using ConstUPtr = std::unique_ptr<const BulletDiscreteQueryContext>;
+
+  /**
+   * @brief Create a query context from the collision objects of a bullet manager
+   * @param link2cow The collision objects of the manager
+   * @param active The active collision objects of the manager
+   * @param collision_margin_data The collision margin data of the manager
+   * @param fn The contact allowed function of the manager
+   * @param use_broadphase If true the context uses a BVH broadphase, otherwise all pairs are checked
+   */
+  BulletDiscreteQueryContext(const Link2Cow& link2cow,
+                             std::vector<std::string> active,
+                             CollisionMarginData collision_margin_data,
+                             IsContactAllowedFn fn,
+                             bool use_broadphase);
+  ~BulletDiscreteQueryContext() override;
+  BulletDiscreteQueryContext(const BulletDiscreteQueryContext&) = delete;
+  BulletDiscreteQueryContext& operator=(const BulletDiscreteQueryContext&) = delete;
+  BulletDiscreteQueryContext(BulletDiscreteQueryContext&&) = delete;
+  BulletDiscreteQueryContext& operator=(BulletDiscreteQueryContext&&) = delete;
+
+  void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& poses) override final;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final;
+
+  void setCollisionMarginData(
+      CollisionMarginData collision_margin_data,
+      CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override final;
+
+  const CollisionMarginData& getCollisionMarginData() const override final;
+
+  void setIsContactAllowedFn(IsContactAllowedFn fn) override final;
+
+  IsContactAllowedFn getIsContactAllowedFn() const override final;
+
+  void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
+
+private:
+  /** @brief A list of the active collision objects */
+  std::vector<std::string> active_;
+  /** @brief The bullet collision configuration information */
+  TesseractCollisionConfigurationInfo config_info_;
+  /** @brief The bullet collision configuration */
+  TesseractCollisionConfiguration coll_config_;
+  /** @brief The bullet collision dispatcher used for getting object to object collison algorithm */
+  std::unique_ptr<btCollisionDispatcher> dispatcher_;
+  /** @brief The bullet collision dispatcher configuration information */
+  btDispatcherInfo dispatch_info_;
+  /** @brief The bullet broadphase interface, this is nullptr if the context does not use a broadphase */
+  std::unique_ptr<btBroadphaseInterface> broadphase_;
+  /** @brief Filter collision objects before broadphase check */
+  TesseractOverlapFilterCallback broadphase_overlap_cb_;
+  /** @brief A map of all (static and active) collision objects owned by the context */
+  Link2Cow link2cow_;
+  /** @brief A vector of collision objects (active followed by static) */
+  std::vector<COW::Ptr> cows_;
+
+  /**
+   * @brief This is used when contactTest is called. It is also added as a user point to the collsion objects
+   * so it can be used to exit collision checking for compound shapes.
+   */
+  ContactTestData contact_test_data_;
+
+  /** @brief Perform the contact test using the broadphase */
+  void broadphaseContactTest();
+
+  /** @brief Perform the contact test by checking every active object against all other objects */
+  void simpleContactTest();
+};
+
+}  // namespace tesseract_collision::tesseract_collision_bullet
+#endif  // TESSERACT_COLLISION_BULLET_DISCRETE_QUERY_CONTEXT_H
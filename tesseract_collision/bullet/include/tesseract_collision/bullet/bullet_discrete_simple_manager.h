@@ -42,6 +42,7 @@
 #define TESSERACT_COLLISION_BULLET_DISCRETE_SIMPLE_MANAGERS_H
 
 #include <tesseract_collision/bullet/bullet_utils.h>
+#include <tesseract_collision/bullet/bullet_discrete_query_context.h>
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/bullet/tesseract_collision_configuration.h>
 
@@ -120,6 +121,28 @@ public:
 
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
 
+  void contactTest(FlatContactResultMap& collisions, const ContactRequest& request) override final;
+
+  void contactTest(std::vector<ContactResultMap>& collisions,
+                   const tesseract_common::VectorIsometry3d& transforms,
+                   const ContactRequest& request) override final;
+
+  std::size_t registerCollisionObjectId(const std::string& name) override final;
+
+  const CollisionObjectIdMap& getCollisionObjectIdMap() const override final;
+
+  void setCollisionObjectsTransform(std::size_t id, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::size_t>& ids,
+                                    const tesseract_common::VectorIsometry3d& poses) override final;
+
+  void contactTest(ContactResultMap& collisions,
+                   std::size_t id1,
+                   std::size_t id2,
+                   const ContactRequest& request) override final;
+
+  DiscreteContactQueryContext::UPtr createQueryContext() const override final;
+
   /**
    * @brief A a bullet collision object to the manager
    * @param cow The tesseract bullet collision object
@@ -142,6 +165,10 @@ private:
   TesseractCollisionConfiguration coll_config_;
   /** @brief A map of all (static and active) collision objects being managed */
   Link2Cow link2cow_;
+  /** @brief The registered collision object ids */
+  CollisionObjectIdMap object_ids_;
+  /** @brief The registered collision objects indexed by id */
+  std::vector<COW::Ptr> id2cow_;
   /** @brief A vector of collision objects (active followed by static) */
   std::vector<COW::Ptr> cows_;
 
@@ -153,6 +180,9 @@ private:
 
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /** @brief Perform the contact test storing the results in the contact test data results */
+  void contactTestHelper(const ContactRequest& request);
 };
 
 }  // namespace tesseract_collision::tesseract_collision_bullet
@@ -104,6 +104,8 @@ public:
   short int m_collisionFilterGroup{ btBroadphaseProxy::KinematicFilter };
   short int m_collisionFilterMask{ btBroadphaseProxy::StaticFilter | btBroadphaseProxy::KinematicFilter };
   bool m_enabled{ true };
+  /** @brief The index in the compiled allowed collision matrix of the contact test data, -1 if it has none */
+  long m_acm_index{ -1 };
 
   /** @brief Get the collision object name */
   const std::string& getName() const;
@@ -125,6 +127,8 @@ public:
 
   /**
    * @brief This clones the collision objects but not the collision shape wich is const.
+   * @details The tesseract geometry, shape poses and bullet collision shapes are shared with the clone so only the
+   * bullet collision object (transform, filters and broadphase proxy) is duplicated.
    * @return Shared Pointer to the cloned collision object
    */
   std::shared_ptr<CollisionObjectWrapper> clone();
@@ -138,12 +142,18 @@ protected:
   std::string m_name;
   /** @brief A user defined type id */
   int m_type_id{ -1 };
-  /* @brief The shapes that define the collision object */
-  CollisionShapesConst m_shapes{};
-  /**< @brief The shapes poses information */
-  tesseract_common::VectorIsometry3d m_shape_poses{};
-  /** @brief This manages the collision shape pointer so they get destroyed */
-  std::vector<std::shared_ptr<btCollisionShape>> m_data{};
+  /* @brief The shapes that define the collision object, this is immutable and shared between clones */
+  std::shared_ptr<const CollisionShapesConst> m_shapes;
+  /**< @brief The shapes poses information, this is immutable and shared between clones */
+  std::shared_ptr<const tesseract_common::VectorIsometry3d> m_shape_poses;
+  /**
+   * @brief This manages the collision shape pointer so they get destroyed
+   * @details This is shared between clones and copied before it is modified
+   */
+  std::shared_ptr<std::vector<std::shared_ptr<btCollisionShape>>> m_data;
+
+  /** @brief Make sure the managed collision shapes are not shared with a clone before modifying them */
+  void detachManagedData();
 };
 
 using COW = CollisionObjectWrapper;
@@ -215,6 +225,41 @@ btTransform getLinkTransformFromCOW(const btCollisionObjectWrapper* cow);
  */
 bool needsCollisionCheck(const COW& cow1, const COW& cow2, const IsContactAllowedFn& acm, bool verbose = false);
 
+/**
+ * @brief This is used to check if a collision check is required between the provided two collision objects
+ * @details If the contact test data has a compiled allowed collision matrix it is queried by the index of the
+ * collision objects, otherwise the contact allowed function is called.
+ * @param cow1 The first collision object
+ * @param cow2 The second collision object
+ * @param cdata The contact test data
+ * @param verbose Indicate if verbose information should be printed to the terminal
+ * @return True if the two collision objects should be checked for collision, otherwise false
+ */
+bool needsCollisionCheck(const COW& cow1, const COW& cow2, const ContactTestData& cdata, bool verbose = false);
+
+/**
+ * @brief Update the index of the collision objects in the compiled allowed collision matrix of the contact test data
+ * @details This must be called when updateCompiledAllowedCollisionMatrix returns true.
+ * @param cdata The contact test data
+ * @param link2cow The collision objects to update
+ */
+void updateAllowedCollisionIndices(const ContactTestData& cdata, const Link2Cow& link2cow);
+
+/**
+ * @brief Perform a discrete contact test between two collision objects bypassing the broadphase
+ * @details This does not check if the collision objects are enabled, filtered or allowed to be in contact.
+ * @param cdata The contact test data
+ * @param cow1 The first collision object
+ * @param cow2 The second collision object
+ * @param dispatcher The bullet collision dispatcher
+ * @param dispatch_info The bullet collision dispatcher configuration information
+ */
+void discretePairContactTest(ContactTestData& cdata,
+                             const COW::Ptr& cow1,
+                             const COW::Ptr& cow2,
+                             const std::unique_ptr<btCollisionDispatcher>& dispatcher,
+                             const btDispatcherInfo& dispatch_info);
+
 btScalar addDiscreteSingleResult(btManifoldPoint& cp,
                                  const btCollisionObjectWrapper* colObj0Wrap,
                                  const btCollisionObjectWrapper* colObj1Wrap,
@@ -459,6 +459,12 @@ void BulletCastBVHManager::contactTest(ContactResultMap& collisions, const Conta
   contact_test_data_.req = request;
   contact_test_data_.done = false;
 
+  if (updateCompiledAllowedCollisionMatrix(contact_test_data_))
+  {
+    updateAllowedCollisionIndices(contact_test_data_, link2cow_);
+    updateAllowedCollisionIndices(contact_test_data_, link2castcow_);
+  }
+
   broadphase_->calculateOverlappingPairs(dispatcher_.get());
 
   btOverlappingPairCache* pairCache = broadphase_->getOverlappingPairCache();
@@ -474,6 +480,7 @@ void BulletCastBVHManager::contactTest(ContactResultMap& collisions, const Conta
 void BulletCastBVHManager::addCollisionObject(const COW::Ptr& cow)
 {
   cow->setUserPointer(&contact_test_data_);
+  cow->m_acm_index = getAllowedCollisionIndex(contact_test_data_, cow->getName());
   link2cow_[cow->getName()] = cow;
   collision_objects_.push_back(cow->getName());
 
@@ -372,6 +372,12 @@ void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const Co
   contact_test_data_.req = request;
   contact_test_data_.done = false;
 
+  if (updateCompiledAllowedCollisionMatrix(contact_test_data_))
+  {
+    updateAllowedCollisionIndices(contact_test_data_, link2cow_);
+    updateAllowedCollisionIndices(contact_test_data_, link2castcow_);
+  }
+
   for (auto cow1_iter = cows_.begin(); cow1_iter != (cows_.end() - 1); cow1_iter++)
   {
     const COW::Ptr& cow1 = *cow1_iter;
@@ -401,7 +407,7 @@ void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const Co
 
       if (aabb_check)
       {
-        bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_.fn, false);
+        bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_, false);
 
         if (needs_collision)
         {
@@ -437,6 +443,7 @@ void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const Co
 void BulletCastSimpleManager::addCollisionObject(const COW::Ptr& cow)
 {
   cow->setUserPointer(&contact_test_data_);
+  cow->m_acm_index = getAllowedCollisionIndex(contact_test_data_, cow->getName());
   link2cow_[cow->getName()] = cow;
   collision_objects_.push_back(cow->getName());
 
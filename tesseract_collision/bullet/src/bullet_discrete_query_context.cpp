@@ -0,0 +1,252 @@
+/**
+ * @file bullet_discrete_query_context.cpp
+ * @brief Tesseract Bullet discrete read-only query context implementation.
+ *
+ * @date Oct 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tesseract_collision/bullet/bullet_discrete_query_context.h>
+
+namespace tesseract_collision::tesseract_collision_bullet
+{
+/**
+ * @brief Create the collision configuration information for a query context
+ * @details A query context only allocates a few collision algorithms at a time so smaller pools are used than the
+ * default, bullet falls back to the heap if a pool is exhausted.
+ */
+static TesseractCollisionConfigurationInfo createQueryContextConfigInfo()
+{
+  TesseractCollisionConfigurationInfo config_info(false);
+  config_info.m_defaultMaxPersistentManifoldPoolSize = 64;
+  config_info.m_defaultMaxCollisionAlgorithmPoolSize = 64;
+  config_info.createPoolAllocators();
+  return config_info;
+}
+
+BulletDiscreteQueryContext::BulletDiscreteQueryContext(const Link2Cow& link2cow,
+                                                       std::vector<std::string> active,
+                                                       CollisionMarginData collision_margin_data,
+                                                       IsContactAllowedFn fn,
+                                                       bool use_broadphase)
+  : active_(std::move(active)), config_info_(createQueryContextConfigInfo()), coll_config_(config_info_)
+{
+  dispatcher_ = std::make_unique<btCollisionDispatcher>(&coll_config_);
+
+  dispatcher_->registerCollisionCreateFunc(
+      BOX_SHAPE_PROXYTYPE,
+      BOX_SHAPE_PROXYTYPE,
+      coll_config_.getCollisionAlgorithmCreateFunc(CONVEX_SHAPE_PROXYTYPE, CONVEX_SHAPE_PROXYTYPE));
+
+  dispatcher_->setDispatcherFlags(dispatcher_->getDispatcherFlags() &
+                                  ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
+
+  if (use_broadphase)
+  {
+    broadphase_ = std::make_unique<btDbvtBroadphase>();
+    broadphase_->getOverlappingPairCache()->setOverlapFilterCallback(&broadphase_overlap_cb_);
+  }
+
+  contact_test_data_.active = &active_;
+  contact_test_data_.collision_margin_data = std::move(collision_margin_data);
+  contact_test_data_.fn = std::move(fn);
+
+  auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
+
+  cows_.reserve(link2cow.size());
+  for (const auto& cow : link2cow)
+  {
+    // The clone shares the collision shapes so only the transform, margin and filters are owned by the context
+    COW::Ptr new_cow = cow.second->clone();
+    new_cow->setContactProcessingThreshold(margin);
+    new_cow->setUserPointer(&contact_test_data_);
+
+    if (new_cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
+      cows_.insert(cows_.begin(), new_cow);
+    else
+      cows_.push_back(new_cow);
+
+    link2cow_[cow.first] = new_cow;
+
+    if (broadphase_ != nullptr)
+      addCollisionObjectToBroadphase(new_cow, broadphase_, dispatcher_);
+  }
+}
+
+BulletDiscreteQueryContext::~BulletDiscreteQueryContext()
+{
+  if (broadphase_ == nullptr)
+    return;
+
+  for (auto& cow : cows_)
+    removeCollisionObjectFromBroadphase(cow, broadphase_, dispatcher_);
+}
+
+void BulletDiscreteQueryContext::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
+{
+  auto it = link2cow_.find(name);
+  if (it != link2cow_.end())
+  {
+    it->second->setWorldTransform(convertEigenToBt(pose));
+    if (broadphase_ != nullptr)
+      updateBroadphaseAABB(it->second, broadphase_, dispatcher_);
+  }
+}
+
+void BulletDiscreteQueryContext::setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                                              const tesseract_common::VectorIsometry3d& poses)
+{
+  assert(names.size() == poses.size());
+  for (auto i = 0U; i < names.size(); ++i)
+    setCollisionObjectsTransform(names[i], poses[i]);
+}
+
+void BulletDiscreteQueryContext::setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms)
+{
+  for (const auto& transform : transforms)
+    setCollisionObjectsTransform(transform.first, transform.second);
+}
+
+void BulletDiscreteQueryContext::setCollisionMarginData(CollisionMarginData collision_margin_data,
+                                                        CollisionMarginOverrideType override_type)
+{
+  contact_test_data_.collision_margin_data.apply(collision_margin_data, override_type);
+
+  auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
+  for (auto& cow : cows_)
+  {
+    cow->setContactProcessingThreshold(margin);
+    if (broadphase_ != nullptr)
+      updateBroadphaseAABB(cow, broadphase_, dispatcher_);
+  }
+}
+
+const CollisionMarginData& BulletDiscreteQueryContext::getCollisionMarginData() const
+{
+  return contact_test_data_.collision_margin_data;
+}
+
+void BulletDiscreteQueryContext::setIsContactAllowedFn(IsContactAllowedFn fn) { contact_test_data_.fn = std::move(fn); }
+
+IsContactAllowedFn BulletDiscreteQueryContext::getIsContactAllowedFn() const { return contact_test_data_.fn; }
+
+void BulletDiscreteQueryContext::contactTest(ContactResultMap& collisions, const ContactRequest& request)
+{
+  contact_test_data_.res = &collisions;
+  contact_test_data_.req = request;
+  contact_test_data_.done = false;
+
+  if (updateCompiledAllowedCollisionMatrix(contact_test_data_))
+    updateAllowedCollisionIndices(contact_test_data_, link2cow_);
+
+  if (broadphase_ != nullptr)
+    broadphaseContactTest();
+  else
+    simpleContactTest();
+}
+
+void BulletDiscreteQueryContext::broadphaseContactTest()
+{
+  broadphase_->calculateOverlappingPairs(dispatcher_.get());
+
+  DiscreteBroadphaseContactResultCallback cc(contact_test_data_,
+                                             contact_test_data_.collision_margin_data.getMaxCollisionMargin());
+
+  TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc);
+
+  broadphase_->getOverlappingPairCache()->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
+}
+
+void BulletDiscreteQueryContext::simpleContactTest()
+{
+  if (cows_.empty())
+    return;
+
+  for (auto cow1_iter = cows_.begin(); cow1_iter != (cows_.end() - 1); cow1_iter++)
+  {
+    const COW::Ptr& cow1 = *cow1_iter;
+
+    if (cow1->m_collisionFilterGroup != btBroadphaseProxy::KinematicFilter)
+      break;
+
+    if (!cow1->m_enabled)
+      continue;
+
+    btVector3 min_aabb[2], max_aabb[2];  // NOLINT
+    cow1->getAABB(min_aabb[0], max_aabb[0]);
+
+    btCollisionObjectWrapper obA(nullptr, cow1->getCollisionShape(), cow1.get(), cow1->getWorldTransform(), -1, -1);
+
+    DiscreteCollisionCollector cc(contact_test_data_, cow1, cow1->getContactProcessingThreshold());
+    for (auto cow2_iter = cow1_iter + 1; cow2_iter != cows_.end(); cow2_iter++)
+    {
+      assert(!contact_test_data_.done);
+
+      const COW::Ptr& cow2 = *cow2_iter;
+      cow2->getAABB(min_aabb[1], max_aabb[1]);
+
+      bool aabb_check = (min_aabb[0][0] <= max_aabb[1][0] && max_aabb[0][0] >= min_aabb[1][0]) &&
+                        (min_aabb[0][1] <= max_aabb[1][1] && max_aabb[0][1] >= min_aabb[1][1]) &&
+                        (min_aabb[0][2] <= max_aabb[1][2] && max_aabb[0][2] >= min_aabb[1][2]);
+
+      if (aabb_check && needsCollisionCheck(*cow1, *cow2, contact_test_data_, false))
+      {
+        btCollisionObjectWrapper obB(nullptr, cow2->getCollisionShape(), cow2.get(), cow2->getWorldTransform(), -1, -1);
+
+        btCollisionAlgorithm* algorithm = dispatcher_->findAlgorithm(&obA, &obB, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+        assert(algorithm != nullptr);
+        if (algorithm != nullptr)
+        {
+          TesseractBridgedManifoldResult contactPointResult(&obA, &obB, cc);
+          contactPointResult.m_closestPointDistanceThreshold = cc.m_closestDistanceThreshold;
+
+          // discrete collision detection query
+          algorithm->processCollision(&obA, &obB, dispatch_info_, &contactPointResult);
+
+          algorithm->~btCollisionAlgorithm();
+          dispatcher_->freeCollisionAlgorithm(algorithm);
+        }
+      }
+
+      if (contact_test_data_.done)
+        break;
+    }
+
+    if (contact_test_data_.done)
+      break;
+  }
+}
+
+}  // namespace tesseract_collision::tesseract_collision_bullet
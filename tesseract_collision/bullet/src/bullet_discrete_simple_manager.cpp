@@ -46,6 +46,17 @@ namespace tesseract_collision::tesseract_collision_bullet
 static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
 static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
 
+/** @brief Get the collision object of a registered id, this will throw if the collision object has been removed */
+static const COW::Ptr& getRegisteredCollisionObject(const std::vector<COW::Ptr>& id2cow, std::size_t id)
+{
+  const COW::Ptr& cow = id2cow.at(id);
+  if (cow == nullptr)
+    throw std::runtime_error("BulletDiscreteSimpleManager, collision object id " + std::to_string(id) +
+                             " has been removed!");
+
+  return cow;
+}
+
 BulletDiscreteSimpleManager::BulletDiscreteSimpleManager(std::string name,
                                                          TesseractCollisionConfigurationInfo config_info)
   : name_(std::move(name)), config_info_(std::move(config_info)), coll_config_(config_info_)
@@ -88,6 +99,15 @@ DiscreteContactManager::UPtr BulletDiscreteSimpleManager::clone() const
   manager->setCollisionMarginData(contact_test_data_.collision_margin_data);
   manager->setIsContactAllowedFn(contact_test_data_.fn);
 
+  // The ids are copied so they include the ids of removed collision objects
+  manager->object_ids_ = object_ids_;
+  manager->id2cow_.reserve(id2cow_.size());
+  for (const auto& name : object_ids_.getNames())
+  {
+    auto it = manager->link2cow_.find(name);
+    manager->id2cow_.push_back((it != manager->link2cow_.end()) ? it->second : nullptr);
+  }
+
   return manager;
 }
 
@@ -140,6 +160,15 @@ bool BulletDiscreteSimpleManager::removeCollisionObject(const std::string& name)
     cows_.erase(std::find(cows_.begin(), cows_.end(), it->second));
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
     link2cow_.erase(name);
+
+    // Only the removed id is invalidated so the remaining ids and their cached contact allowed state stay valid
+    if (object_ids_.has(name))
+    {
+      const std::size_t id = object_ids_.getId(name);
+      object_ids_.clearContactAllowedCache(id);
+      id2cow_[id] = nullptr;
+    }
+
     return true;
   }
 
@@ -250,14 +279,35 @@ const CollisionMarginData& BulletDiscreteSimpleManager::getCollisionMarginData()
 {
   return contact_test_data_.collision_margin_data;
 }
-void BulletDiscreteSimpleManager::setIsContactAllowedFn(IsContactAllowedFn fn) { contact_test_data_.fn = fn; }
+void BulletDiscreteSimpleManager::setIsContactAllowedFn(IsContactAllowedFn fn)
+{
+  contact_test_data_.fn = fn;
+  object_ids_.clearContactAllowedCache();
+}
+
 IsContactAllowedFn BulletDiscreteSimpleManager::getIsContactAllowedFn() const { return contact_test_data_.fn; }
 void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
   contact_test_data_.res = &collisions;
+  contact_test_data_.flat_res = nullptr;
+  contactTestHelper(request);
+}
+
+void BulletDiscreteSimpleManager::contactTest(FlatContactResultMap& collisions, const ContactRequest& request)
+{
+  contact_test_data_.res = nullptr;
+  contact_test_data_.flat_res = &collisions;
+  contactTestHelper(request);
+}
+
+void BulletDiscreteSimpleManager::contactTestHelper(const ContactRequest& request)
+{
   contact_test_data_.req = request;
   contact_test_data_.done = false;
 
+  if (updateCompiledAllowedCollisionMatrix(contact_test_data_))
+    updateAllowedCollisionIndices(contact_test_data_, link2cow_);
+
   for (auto cow1_iter = cows_.begin(); cow1_iter != (cows_.end() - 1); cow1_iter++)
   {
     const COW::Ptr& cow1 = *cow1_iter;
@@ -287,7 +337,7 @@ void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, cons
 
       if (aabb_check)
       {
-        bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_.fn, false);
+        bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_, false);
 
         if (needs_collision)
         {
@@ -320,12 +370,110 @@ void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, cons
   }
 }
 
+void BulletDiscreteSimpleManager::contactTest(std::vector<ContactResultMap>& collisions,
+                                              const tesseract_common::VectorIsometry3d& transforms,
+                                              const ContactRequest& request)
+{
+  const std::size_t num_states = getBatchStateCount(active_.size(), transforms.size());
+
+  // Resolve the active collision objects once so each state only updates transforms
+  std::vector<COW::Ptr> active_cows;
+  active_cows.reserve(active_.size());
+  for (const auto& name : active_)
+  {
+    auto it = link2cow_.find(name);
+    active_cows.push_back((it != link2cow_.end()) ? it->second : nullptr);
+  }
+
+  collisions.resize(num_states);
+  for (std::size_t i = 0; i < num_states; ++i)
+  {
+    const std::size_t offset = i * active_.size();
+    for (std::size_t j = 0; j < active_cows.size(); ++j)
+    {
+      if (active_cows[j] != nullptr)
+        active_cows[j]->setWorldTransform(convertEigenToBt(transforms[offset + j]));
+    }
+
+    contactTest(collisions[i], request);
+  }
+}
+
+std::size_t BulletDiscreteSimpleManager::registerCollisionObjectId(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    throw std::runtime_error("BulletDiscreteSimpleManager, collision object '" + name + "' does not exist!");
+
+  std::size_t id = object_ids_.add(name);
+  if (id == id2cow_.size())
+    id2cow_.push_back(it->second);
+
+  return id;
+}
+
+const CollisionObjectIdMap& BulletDiscreteSimpleManager::getCollisionObjectIdMap() const { return object_ids_; }
+
+void BulletDiscreteSimpleManager::setCollisionObjectsTransform(std::size_t id, const Eigen::Isometry3d& pose)
+{
+  getRegisteredCollisionObject(id2cow_, id)->setWorldTransform(convertEigenToBt(pose));
+}
+
+void BulletDiscreteSimpleManager::setCollisionObjectsTransform(const std::vector<std::size_t>& ids,
+                                                               const tesseract_common::VectorIsometry3d& poses)
+{
+  assert(ids.size() == poses.size());
+  for (std::size_t i = 0; i < ids.size(); ++i)
+    setCollisionObjectsTransform(ids[i], poses[i]);
+}
+
+void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions,
+                                              std::size_t id1,
+                                              std::size_t id2,
+                                              const ContactRequest& request)
+{
+  const COW::Ptr& cow1 = getRegisteredCollisionObject(id2cow_, id1);
+  const COW::Ptr& cow2 = getRegisteredCollisionObject(id2cow_, id2);
+
+  contact_test_data_.res = &collisions;
+  contact_test_data_.flat_res = nullptr;
+  contact_test_data_.req = request;
+  contact_test_data_.done = false;
+
+  if (updateCompiledAllowedCollisionMatrix(contact_test_data_))
+    updateAllowedCollisionIndices(contact_test_data_, link2cow_);
+
+  // Without a compiled allowed collision matrix the contact allowed function is cached by id
+  if (contact_test_data_.acm != nullptr)
+  {
+    if (!needsCollisionCheck(*cow1, *cow2, contact_test_data_, false))
+      return;
+  }
+  else if (!needsCollisionCheck(*cow1, *cow2, nullptr, false) ||
+           object_ids_.isContactAllowed(id1, id2, contact_test_data_.fn))
+  {
+    return;
+  }
+
+  discretePairContactTest(contact_test_data_, cow1, cow2, dispatcher_, dispatch_info_);
+}
+
+DiscreteContactQueryContext::UPtr BulletDiscreteSimpleManager::createQueryContext() const
+{
+  return std::make_unique<BulletDiscreteQueryContext>(
+      link2cow_, active_, contact_test_data_.collision_margin_data, contact_test_data_.fn, false);
+}
+
 void BulletDiscreteSimpleManager::addCollisionObject(const COW::Ptr& cow)
 {
   cow->setUserPointer(&contact_test_data_);
+  cow->m_acm_index = getAllowedCollisionIndex(contact_test_data_, cow->getName());
   link2cow_[cow->getName()] = cow;
   collision_objects_.push_back(cow->getName());
 
+  if (object_ids_.has(cow->getName()))
+    id2cow_[object_ids_.getId(cow->getName())] = cow;
+
   if (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
     cows_.insert(cows_.begin(), cow);
   else
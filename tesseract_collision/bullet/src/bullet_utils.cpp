@@ -440,27 +440,32 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
                                                const int& type_id,
                                                CollisionShapesConst shapes,
                                                tesseract_common::VectorIsometry3d shape_poses)
-  : m_name(std::move(name)), m_type_id(type_id), m_shapes(std::move(shapes)), m_shape_poses(std::move(shape_poses))
-{
-  assert(!m_shapes.empty());
-  assert(!m_shape_poses.empty());
+  : m_name(std::move(name))
+  , m_type_id(type_id)
+  , m_shapes(std::make_shared<const CollisionShapesConst>(std::move(shapes)))
+  , m_shape_poses(std::make_shared<const tesseract_common::VectorIsometry3d>(std::move(shape_poses)))
+{
+  const CollisionShapesConst& geoms = *m_shapes;
+  const tesseract_common::VectorIsometry3d& geom_poses = *m_shape_poses;
+  assert(!geoms.empty());
+  assert(!geom_poses.empty());
   assert(!m_name.empty());
-  assert(m_shapes.size() == m_shape_poses.size());
+  assert(geoms.size() == geom_poses.size());
 
   m_collisionFilterGroup = btBroadphaseProxy::KinematicFilter;
   m_collisionFilterMask = btBroadphaseProxy::StaticFilter | btBroadphaseProxy::KinematicFilter;
 
-  if (m_shapes.size() == 1 && m_shape_poses[0].matrix().isIdentity() &&
-      m_shapes[0]->getType() != tesseract_geometry::GeometryType::COMPOUND_MESH)
+  if (geoms.size() == 1 && geom_poses[0].matrix().isIdentity() &&
+      geoms[0]->getType() != tesseract_geometry::GeometryType::COMPOUND_MESH)
   {
-    std::shared_ptr<btCollisionShape> shape = createShapePrimitive(m_shapes[0], this, 0);
+    std::shared_ptr<btCollisionShape> shape = createShapePrimitive(geoms[0], this, 0);
     manage(shape);
     setCollisionShape(shape.get());
   }
   else
   {
     auto compound =
-        std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, static_cast<int>(m_shapes.size()));
+        std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, static_cast<int>(geoms.size()));
     manage(compound);
     compound->setMargin(BULLET_MARGIN);  // margin: compound. seems to have no
                                          // effect when positive but has an
@@ -468,29 +473,29 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
     setCollisionShape(compound.get());
 
     int shape_id{ 0 };
-    for (std::size_t j = 0; j < m_shapes.size(); ++j)
+    for (std::size_t j = 0; j < geoms.size(); ++j)
     {
-      if (m_shapes[j]->getType() == tesseract_geometry::GeometryType::COMPOUND_MESH)
+      if (geoms[j]->getType() == tesseract_geometry::GeometryType::COMPOUND_MESH)
       {
-        const auto& meshes = std::static_pointer_cast<const tesseract_geometry::CompoundMesh>(m_shapes[j])->getMeshes();
+        const auto& meshes = std::static_pointer_cast<const tesseract_geometry::CompoundMesh>(geoms[j])->getMeshes();
         for (const auto& mesh : meshes)
         {
           std::shared_ptr<btCollisionShape> subshape = createShapePrimitive(mesh, this, shape_id++);
           if (subshape != nullptr)
           {
             manage(subshape);
-            btTransform geomTrans = convertEigenToBt(m_shape_poses[j]);
+            btTransform geomTrans = convertEigenToBt(geom_poses[j]);
             compound->addChildShape(geomTrans, subshape.get());
           }
         }
       }
       else
       {
-        std::shared_ptr<btCollisionShape> subshape = createShapePrimitive(m_shapes[j], this, shape_id++);
+        std::shared_ptr<btCollisionShape> subshape = createShapePrimitive(geoms[j], this, shape_id++);
         if (subshape != nullptr)
         {
           manage(subshape);
-          btTransform geomTrans = convertEigenToBt(m_shape_poses[j]);
+          btTransform geomTrans = convertEigenToBt(geom_poses[j]);
           compound->addChildShape(geomTrans, subshape.get());
         }
       }
@@ -508,20 +513,26 @@ const int& CollisionObjectWrapper::getTypeID() const { return m_type_id; }
 
 bool CollisionObjectWrapper::sameObject(const CollisionObjectWrapper& other) const
 {
-  return m_name == other.m_name && m_type_id == other.m_type_id && m_shapes.size() == other.m_shapes.size() &&
-         m_shape_poses.size() == other.m_shape_poses.size() &&
-         std::equal(m_shapes.begin(), m_shapes.end(), other.m_shapes.begin()) &&
-         std::equal(m_shape_poses.begin(),
-                    m_shape_poses.end(),
-                    other.m_shape_poses.begin(),
+  if (m_name != other.m_name || m_type_id != other.m_type_id)
+    return false;
+
+  // Clones share the same immutable shape data
+  if (m_shapes == other.m_shapes && m_shape_poses == other.m_shape_poses)
+    return true;
+
+  return m_shapes->size() == other.m_shapes->size() && m_shape_poses->size() == other.m_shape_poses->size() &&
+         std::equal(m_shapes->begin(), m_shapes->end(), other.m_shapes->begin()) &&
+         std::equal(m_shape_poses->begin(),
+                    m_shape_poses->end(),
+                    other.m_shape_poses->begin(),
                     [](const Eigen::Isometry3d& t1, const Eigen::Isometry3d& t2) { return t1.isApprox(t2); });
 }
 
-const CollisionShapesConst& CollisionObjectWrapper::getCollisionGeometries() const { return m_shapes; }
+const CollisionShapesConst& CollisionObjectWrapper::getCollisionGeometries() const { return *m_shapes; }
 
 const tesseract_common::VectorIsometry3d& CollisionObjectWrapper::getCollisionGeometriesTransforms() const
 {
-  return m_shape_poses;
+  return *m_shape_poses;
 }
 
 void CollisionObjectWrapper::getAABB(btVector3& aabb_min, btVector3& aabb_max) const
@@ -546,13 +557,30 @@ std::shared_ptr<CollisionObjectWrapper> CollisionObjectWrapper::clone()
   clone_cow->m_collisionFilterGroup = m_collisionFilterGroup;
   clone_cow->m_collisionFilterMask = m_collisionFilterMask;
   clone_cow->m_enabled = m_enabled;
+  clone_cow->m_acm_index = m_acm_index;
   clone_cow->setBroadphaseHandle(nullptr);
   return clone_cow;
 }
 
-void CollisionObjectWrapper::manage(const std::shared_ptr<btCollisionShape>& t) { m_data.push_back(t); }
+void CollisionObjectWrapper::manage(const std::shared_ptr<btCollisionShape>& t)
+{
+  detachManagedData();
+  m_data->push_back(t);
+}
+
+void CollisionObjectWrapper::manageReserve(std::size_t s)
+{
+  detachManagedData();
+  m_data->reserve(s);
+}
 
-void CollisionObjectWrapper::manageReserve(std::size_t s) { m_data.reserve(s); }
+void CollisionObjectWrapper::detachManagedData()
+{
+  if (m_data == nullptr)
+    m_data = std::make_shared<std::vector<std::shared_ptr<btCollisionShape>>>();
+  else if (m_data.use_count() > 1)
+    m_data = std::make_shared<std::vector<std::shared_ptr<btCollisionShape>>>(*m_data);
+}
 
 CastHullShape::CastHullShape(btConvexShape* shape, const btTransform& t01) : m_shape(shape), m_t01(t01)
 {
@@ -702,6 +730,55 @@ bool needsCollisionCheck(const COW& cow1, const COW& cow2, const IsContactAllowe
          !isContactAllowed(cow1.getName(), cow2.getName(), acm, verbose);
 }
 
+bool needsCollisionCheck(const COW& cow1, const COW& cow2, const ContactTestData& cdata, bool verbose)
+{
+  return cow1.m_enabled && cow2.m_enabled && (cow2.m_collisionFilterGroup & cow1.m_collisionFilterMask) &&  // NOLINT
+         (cow1.m_collisionFilterGroup & cow2.m_collisionFilterMask) &&                                      // NOLINT
+         !isContactAllowed(cow1.getName(), cow1.m_acm_index, cow2.getName(), cow2.m_acm_index, cdata, verbose);
+}
+
+void updateAllowedCollisionIndices(const ContactTestData& cdata, const Link2Cow& link2cow)
+{
+  for (const auto& cow : link2cow)
+    cow.second->m_acm_index = getAllowedCollisionIndex(cdata, cow.first);
+}
+
+void discretePairContactTest(ContactTestData& cdata,
+                             const COW::Ptr& cow1,
+                             const COW::Ptr& cow2,
+                             const std::unique_ptr<btCollisionDispatcher>& dispatcher,
+                             const btDispatcherInfo& dispatch_info)
+{
+  btVector3 min_aabb[2], max_aabb[2];  // NOLINT
+  cow1->getAABB(min_aabb[0], max_aabb[0]);
+  cow2->getAABB(min_aabb[1], max_aabb[1]);
+
+  bool aabb_check = (min_aabb[0][0] <= max_aabb[1][0] && max_aabb[0][0] >= min_aabb[1][0]) &&
+                    (min_aabb[0][1] <= max_aabb[1][1] && max_aabb[0][1] >= min_aabb[1][1]) &&
+                    (min_aabb[0][2] <= max_aabb[1][2] && max_aabb[0][2] >= min_aabb[1][2]);
+
+  if (!aabb_check)
+    return;
+
+  btCollisionObjectWrapper obA(nullptr, cow1->getCollisionShape(), cow1.get(), cow1->getWorldTransform(), -1, -1);
+  btCollisionObjectWrapper obB(nullptr, cow2->getCollisionShape(), cow2.get(), cow2->getWorldTransform(), -1, -1);
+
+  btCollisionAlgorithm* algorithm = dispatcher->findAlgorithm(&obA, &obB, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+  assert(algorithm != nullptr);
+  if (algorithm != nullptr)
+  {
+    DiscreteCollisionCollector cc(cdata, cow1, cow1->getContactProcessingThreshold());
+    TesseractBridgedManifoldResult contactPointResult(&obA, &obB, cc);
+    contactPointResult.m_closestPointDistanceThreshold = cc.m_closestDistanceThreshold;
+
+    // discrete collision detection query
+    algorithm->processCollision(&obA, &obB, dispatch_info, &contactPointResult);
+
+    algorithm->~btCollisionAlgorithm();
+    dispatcher->freeCollisionAlgorithm(algorithm);
+  }
+}
+
 btScalar addDiscreteSingleResult(btManifoldPoint& cp,
                                  const btCollisionObjectWrapper* colObj0Wrap,
                                  const btCollisionObjectWrapper* colObj1Wrap,
@@ -712,10 +789,10 @@ btScalar addDiscreteSingleResult(btManifoldPoint& cp,
   const auto* cd0 = static_cast<const CollisionObjectWrapper*>(colObj0Wrap->getCollisionObject());  // NOLINT
   const auto* cd1 = static_cast<const CollisionObjectWrapper*>(colObj1Wrap->getCollisionObject());  // NOLINT
 
-  ObjectPairKey pc = tesseract_common::makeOrderedLinkPair(cd0->getName(), cd1->getName());
+  thread_local ObjectPairKey pc;
+  tesseract_common::makeOrderedLinkPair(pc, cd0->getName(), cd1->getName());
 
-  const auto it = collisions.res->find(pc);
-  bool found = (it != collisions.res->end() && !it->second.empty());
+  bool found = hasContactResult(collisions, pc);
 
   //    size_t l = 0;
   //    if (found)
@@ -843,12 +920,10 @@ btScalar addCastSingleResult(btManifoldPoint& cp,
   const auto* cd0 = static_cast<const CollisionObjectWrapper*>(colObj0Wrap->getCollisionObject());  // NOLINT
   const auto* cd1 = static_cast<const CollisionObjectWrapper*>(colObj1Wrap->getCollisionObject());  // NOLINT
 
-  const std::pair<std::string, std::string>& pc = cd0->getName() < cd1->getName() ?
-                                                      std::make_pair(cd0->getName(), cd1->getName()) :
-                                                      std::make_pair(cd1->getName(), cd0->getName());
+  thread_local ObjectPairKey pc;
+  tesseract_common::makeOrderedLinkPair(pc, cd0->getName(), cd1->getName());
 
-  const auto it = collisions.res->find(pc);
-  bool found = (it != collisions.res->end() && !it->second.empty());
+  bool found = hasContactResult(collisions, pc);
 
   //    size_t l = 0;
   //    if (found)
@@ -980,7 +1055,7 @@ BroadphaseContactResultCallback::BroadphaseContactResultCallback(ContactTestData
 bool BroadphaseContactResultCallback::needsCollision(const CollisionObjectWrapper* cow0,
                                                      const CollisionObjectWrapper* cow1) const
 {
-  return !collisions_.done && needsCollisionCheck(*cow0, *cow1, collisions_.fn, verbose_);
+  return !collisions_.done && needsCollisionCheck(*cow0, *cow1, collisions_, verbose_);
 }
 
 DiscreteBroadphaseContactResultCallback::DiscreteBroadphaseContactResultCallback(ContactTestData& collisions,
@@ -1183,7 +1258,7 @@ bool DiscreteCollisionCollector::needsCollision(btBroadphaseProxy* proxy0) const
 {
   return !collisions_.done &&
          needsCollisionCheck(
-             *cow_, *(static_cast<CollisionObjectWrapper*>(proxy0->m_clientObject)), collisions_.fn, verbose_);
+             *cow_, *(static_cast<CollisionObjectWrapper*>(proxy0->m_clientObject)), collisions_, verbose_);
 }
 
 CastCollisionCollector::CastCollisionCollector(ContactTestData& collisions,
@@ -1216,7 +1291,7 @@ bool CastCollisionCollector::needsCollision(btBroadphaseProxy* proxy0) const
 {
   return !collisions_.done &&
          needsCollisionCheck(
-             *cow_, *(static_cast<CollisionObjectWrapper*>(proxy0->m_clientObject)), collisions_.fn, verbose_);
+             *cow_, *(static_cast<CollisionObjectWrapper*>(proxy0->m_clientObject)), collisions_, verbose_);
 }
 
 COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
@@ -57,6 +57,15 @@ std::vector<ObjectPairKey> getCollisionObjectPairs(const std::vector<std::string
  */
 bool isLinkActive(const std::vector<std::string>& active, const std::string& name);
 
+/**
+ * @brief Get the number of states stored in a contiguous batch of active collision object transforms
+ * @details This will throw if there are no active objects or the number of transforms is not a multiple of it.
+ * @param active_count The number of active collision objects
+ * @param transform_count The total number of transforms
+ * @return The number of states
+ */
+std::size_t getBatchStateCount(std::size_t active_count, std::size_t transform_count);
+
 /**
  * @brief Determine if contact is allowed between two objects.
  * @param name1 The name of the first object
@@ -70,6 +79,51 @@ bool isContactAllowed(const std::string& name1,
                       const IsContactAllowedFn& acm,
                       bool verbose = false);
 
+/**
+ * @brief Determine if contact is allowed between two objects using the contact test data.
+ * @details If the contact test data has a compiled allowed collision matrix it is queried by index, otherwise the
+ * contact allowed function is called with the object names.
+ * @param name1 The name of the first object
+ * @param index1 The index of the first object in the compiled allowed collision matrix, see getAllowedCollisionIndex
+ * @param name2 The name of the second object
+ * @param index2 The index of the second object in the compiled allowed collision matrix, see getAllowedCollisionIndex
+ * @param cdata The contact test data
+ * @param verbose If true print debug information
+ * @return True if contact is allowed between the two object, otherwise false.
+ */
+bool isContactAllowed(const std::string& name1,
+                      long index1,
+                      const std::string& name2,
+                      long index2,
+                      const ContactTestData& cdata,
+                      bool verbose = false);
+
+/**
+ * @brief Update the compiled allowed collision matrix of the contact test data from its contact allowed function
+ * @details The latest matrix published by the contact allowed function is stored if it is a
+ * tesseract_common::CompiledIsContactAllowedFn, otherwise the matrix is cleared. Contact managers call this at the
+ * start of a contact test and must update the index of their collision objects if it returns true.
+ * @param cdata The contact test data
+ * @return True if the compiled allowed collision matrix changed, otherwise false
+ */
+bool updateCompiledAllowedCollisionMatrix(ContactTestData& cdata);
+
+/**
+ * @brief Get the index of an object in the compiled allowed collision matrix of the contact test data
+ * @param cdata The contact test data
+ * @param name The name of the object
+ * @return The index of the object, or -1 if there is no compiled matrix or the object has no allowed collisions
+ */
+long getAllowedCollisionIndex(const ContactTestData& cdata, const std::string& name);
+
+/**
+ * @brief Check if a contact result is already stored for a link pair
+ * @param cdata The contact test data holding the results
+ * @param key The ordered link pair
+ * @return True if a contact result is stored for the link pair, otherwise false
+ */
+bool hasContactResult(const ContactTestData& cdata, const ObjectPairKey& key);
+
 /**
  * @brief processResult Processes the ContactResult based on the information in the ContactTestData
  * @param cdata Information used to process the results
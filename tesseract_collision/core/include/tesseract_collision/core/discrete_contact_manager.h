@@ -37,6 +37,83 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_collision
 {
+/**
+ * @brief A lightweight context for performing read-only contact queries against a discrete contact manager
+ * @details The context shares the collision geometry of the contact manager which created it and only owns the
+ * collision object transforms, margin data and contact allowed function used for its queries. This allows a context
+ * to be created per thread instead of cloning the contact manager. A context must only be used by one thread at a
+ * time and the contact manager must not be modified while any of its contexts are in use. The context reflects the
+ * collision objects, active objects and enabled state of the contact manager at the time it was created.
+ */
+class DiscreteContactQueryContext
+{
+public:
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using Ptr = std::shared_ptr<DiscreteContactQueryContext>;
+  using ConstPtr = std::shared_ptr<const DiscreteContactQueryContext>;
+  using UPtr = std::unique_ptr<DiscreteContactQueryContext>;
+  using ConstUPtr = std::unique_ptr<const DiscreteContactQueryContext>;
+
+  DiscreteContactQueryContext() = default;
+  virtual ~DiscreteContactQueryContext() = default;
+  DiscreteContactQueryContext(const DiscreteContactQueryContext&) = delete;
+  DiscreteContactQueryContext& operator=(const DiscreteContactQueryContext&) = delete;
+  DiscreteContactQueryContext(DiscreteContactQueryContext&&) = delete;
+  DiscreteContactQueryContext& operator=(DiscreteContactQueryContext&&) = delete;
+
+  /**
+   * @brief Set a single collision object's transforms
+   * @param name The name of the object
+   * @param pose The transformation in world
+   */
+  virtual void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) = 0;
+
+  /**
+   * @brief Set a series of collision object's transforms
+   * @param names The name of the object
+   * @param poses The transformation in world
+   */
+  virtual void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                            const tesseract_common::VectorIsometry3d& poses) = 0;
+
+  /**
+   * @brief Set a series of collision object's transforms
+   * @param transforms A transform map <name, pose>
+   */
+  virtual void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) = 0;
+
+  /**
+   * @brief Set the contact distance thresholds for which collision should be considered on a per pair basis
+   * @param collision_margin_data Contains the data that will replace the current settings
+   * @param override_type This determines how the provided CollisionMarginData is applied
+   */
+  virtual void
+  setCollisionMarginData(CollisionMarginData collision_margin_data,
+                         CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) = 0;
+
+  /**
+   * @brief Get the contact distance threshold
+   * @return The contact distance
+   */
+  virtual const CollisionMarginData& getCollisionMarginData() const = 0;
+
+  /** @brief Set the active function for determining if two links are allowed to be in collision */
+  virtual void setIsContactAllowedFn(IsContactAllowedFn fn) = 0;
+
+  /** @brief Get the active function for determining if two links are allowed to be in collision */
+  virtual IsContactAllowedFn getIsContactAllowedFn() const = 0;
+
+  /**
+   * @brief Perform a contact test for all objects based
+   * @param collisions The contact results data
+   * @param request The contact request data
+   */
+  virtual void contactTest(ContactResultMap& collisions, const ContactRequest& request) = 0;
+};
+
 class DiscreteContactManager
 {
 public:
@@ -219,6 +296,83 @@ public:
    */
   virtual void contactTest(ContactResultMap& collisions, const ContactRequest& request) = 0;
 
+  /**
+   * @brief Perform a contact test for all objects storing the results in a flat contact result map
+   * @details The results are appended to the provided container. The default implementation performs the contact test
+   * with a ContactResultMap and copies the results, contact managers should override this to store them directly.
+   * @param collisions The contact results data
+   * @param request The contact request data
+   */
+  virtual void contactTest(FlatContactResultMap& collisions, const ContactRequest& request);
+
+  /**
+   * @brief Perform a contact test for a batch of states
+   * @details The transforms are stored contiguously ordered by the active collision objects, where
+   * transforms[(state * getActiveCollisionObjects().size()) + i] is the pose of getActiveCollisionObjects()[i].
+   * The collisions vector is resized to the number of states and the results are appended to each entry. The
+   * manager is left with the transforms of the last state.
+   * @param collisions The contact results data for each state
+   * @param transforms The active collision object transforms for each state
+   * @param request The contact request data
+   */
+  virtual void contactTest(std::vector<ContactResultMap>& collisions,
+                           const tesseract_common::VectorIsometry3d& transforms,
+                           const ContactRequest& request);
+
+  /**
+   * @brief Register a collision object so it may be accessed by a dense integer id instead of its name
+   * @details Ids are assigned in registration order starting at zero and registering an object more than once returns
+   * the same id. Ids stay valid when a collision object is removed, the id of the removed collision object may not be
+   * used until a collision object with the same name is added again. This will throw if the collision object does not
+   * exist or the contact manager does not support ids.
+   * @param name The name of the collision object
+   * @return The collision object id
+   */
+  virtual std::size_t registerCollisionObjectId(const std::string& name);
+
+  /**
+   * @brief Get the registered collision object ids
+   * @return The collision object id map
+   */
+  virtual const CollisionObjectIdMap& getCollisionObjectIdMap() const;
+
+  /**
+   * @brief Set a single collision object's transform by id
+   * @param id The id of the registered collision object
+   * @param pose The transformation in world
+   */
+  virtual void setCollisionObjectsTransform(std::size_t id, const Eigen::Isometry3d& pose);
+
+  /**
+   * @brief Set a series of collision object's transforms by id
+   * @param ids The ids of the registered collision objects
+   * @param poses The transformations in world
+   */
+  virtual void setCollisionObjectsTransform(const std::vector<std::size_t>& ids,
+                                            const tesseract_common::VectorIsometry3d& poses);
+
+  /**
+   * @brief Perform a contact test between a pair of registered collision objects bypassing the broadphase
+   * @details The contact allowed state of the pair is cached by id, see CollisionObjectIdMap::isContactAllowed.
+   * @param collisions The contact results data
+   * @param id1 The id of the first registered collision object
+   * @param id2 The id of the second registered collision object
+   * @param request The contact request data
+   */
+  virtual void contactTest(ContactResultMap& collisions,
+                           std::size_t id1,
+                           std::size_t id2,
+                           const ContactRequest& request);
+
+  /**
+   * @brief Create a context for performing read-only contact queries which shares the geometry of this manager
+   * @details The context is initialized with the current transforms, margin data and contact allowed function of this
+   * manager. The default implementation does not share the geometry and owns a clone of this manager, so it costs the
+   * same as calling clone. Contact managers which can share their geometry should override this.
+   * @return The query context
+   */
+  virtual DiscreteContactQueryContext::UPtr createQueryContext() const;
+
   /**
    * @brief Applies settings in the config
    * @param config Settings to be applies
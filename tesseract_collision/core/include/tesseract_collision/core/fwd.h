@@ -33,6 +33,7 @@ enum class ContinuousCollisionType;
 enum class ContactTestType;
 struct ContactResult;
 class ContactResultMap;
+class FlatContactResultMap;
 struct ContactRequest;
 struct ContactTestData;
 enum class CollisionEvaluatorType;
@@ -36,6 +36,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <array>
 #include <unordered_map>
 #include <functional>
+#include <cstdint>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/fwd.h>
@@ -295,6 +296,181 @@ private:
   long count_{ 0 };
 };
 
+/**
+ * @brief A flat alternative to ContactResultMap which avoids heap allocation once warmed up
+ * @details Link names are interned to integer ids and the contact results are stored contiguously in insertion order
+ * along with the link ids of each result. Stored results are reused so copying a result into them, including its link
+ * names, does not allocate once warmed up. Use toContactResultMap to convert to the standard container.
+ *
+ * The first result of every link pair is indexed in an open addressing hash table, so finding or replacing the result
+ * of a link pair takes constant time.
+ *
+ * The clear method only resets the number of results so the stored results and interned link names are reused by
+ * subsequent contact requests. The release method fully clears all internal data.
+ */
+class FlatContactResultMap
+{
+public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  using LinkIdPair = std::array<std::size_t, 2>;
+  using ConstIteratorType = ContactResultVector::const_iterator;
+
+  /**
+   * @brief Get the id of a link name, interning it if it has not been seen
+   * @param link_name The link name
+   * @return The link id
+   */
+  std::size_t getLinkId(const std::string& link_name);
+
+  /**
+   * @brief Get the name of an interned link id, this will throw if the id is not valid
+   * @param link_id The link id
+   * @return The link name
+   */
+  const std::string& getLinkName(std::size_t link_id) const;
+
+  /**
+   * @brief Get the interned link names where the index is the link id
+   * @return The interned link names
+   */
+  const std::vector<std::string>& getLinkNames() const;
+
+  /**
+   * @brief Add a contact result for the provided link ids
+   * @param link_id1 The link id associated with the first entry of the result
+   * @param link_id2 The link id associated with the second entry of the result
+   * @param result The result to add
+   * @return The stored contact result
+   */
+  ContactResult& addContactResult(std::size_t link_id1, std::size_t link_id2, const ContactResult& result);
+
+  /**
+   * @brief Add a contact result interning its link names
+   * @param result The result to add
+   * @return The stored contact result
+   */
+  ContactResult& addContactResult(const ContactResult& result);
+
+  /**
+   * @brief Find the first stored contact result between two link ids in either order
+   * @param link_id1 The first link id
+   * @param link_id2 The second link id
+   * @return The stored contact result, nullptr if not found
+   */
+  const ContactResult* findContactResult(std::size_t link_id1, std::size_t link_id2) const;
+
+  /**
+   * @brief Find the first stored contact result between two link names in either order
+   * @details Unlike getLinkId this does not intern the link names
+   * @param link_name1 The first link name
+   * @param link_name2 The second link name
+   * @return The stored contact result, nullptr if not found
+   */
+  const ContactResult* findContactResult(const std::string& link_name1, const std::string& link_name2) const;
+
+  /**
+   * @brief Replace the first stored contact result between two link ids, adding it if the pair has no result
+   * @param link_id1 The link id associated with the first entry of the result
+   * @param link_id2 The link id associated with the second entry of the result
+   * @param result The result to store
+   * @return The stored contact result
+   */
+  ContactResult& setContactResult(std::size_t link_id1, std::size_t link_id2, const ContactResult& result);
+
+  /**
+   * @brief Add all of the results stored in a contact result map
+   * @param results The contact result map
+   */
+  void addContactResults(const ContactResultMap& results);
+
+  /**
+   * @brief Convert to a contact result map, populating the link names of each result
+   * @details The provided map is not cleared before adding the results
+   * @param results The contact result map to add the results to
+   */
+  void toContactResultMap(ContactResultMap& results) const;
+
+  /**
+   * @brief Get the contact result at the provided index
+   * @param index The index of the result, must be less than size()
+   * @return The contact result
+   */
+  const ContactResult& getContactResult(std::size_t index) const;
+
+  /**
+   * @brief Get the link ids of the contact result at the provided index
+   * @param index The index of the result, must be less than size()
+   * @return The link ids of the contact result
+   */
+  const LinkIdPair& getLinkIds(std::size_t index) const;
+
+  /**
+   * @brief Get the number of contact results stored
+   * @return The number of contact results
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief Check if results are present
+   * @return True if no results are stored, otherwise false
+   */
+  bool empty() const;
+
+  /**
+   * @brief This is a consurvative clear.
+   * @details This only resets the number of results so the underlying storage and interned link names are reused.
+   * @note Use release to fully clear the internal data structure
+   */
+  void clear();
+
+  /** @brief Fully clear all internal data */
+  void release();
+
+  ///////////////
+  // Iterators //
+  ///////////////
+  /** @brief returns an iterator to the beginning */
+  ConstIteratorType begin() const;
+  /** @brief returns an iterator to the end */
+  ConstIteratorType end() const;
+
+private:
+  /** @brief The stored results, only the first size_ entries are valid */
+  ContactResultVector results_;
+  /** @brief The link ids of the stored results */
+  std::vector<LinkIdPair> link_ids_;
+  /** @brief The number of valid results */
+  std::size_t size_{ 0 };
+  /** @brief The interned link names where the index is the link id */
+  std::vector<std::string> link_names_;
+  /** @brief A map of link name to link id */
+  std::unordered_map<std::string, std::size_t> link_name_ids_;
+
+  /** @brief An entry of the pair index, which is only valid when its generation is the current generation */
+  struct PairSlot
+  {
+    std::uint64_t key{ 0 };
+    std::size_t index{ 0 };
+    std::size_t generation{ 0 };
+  };
+
+  /** @brief The open addressing pair index from link pair key to the index of its first result */
+  std::vector<PairSlot> pair_slots_;
+  /** @brief The current pair index generation, which is incremented by clear to invalidate every entry */
+  std::size_t pair_generation_{ 1 };
+  /** @brief The number of valid pair index entries */
+  std::size_t num_pairs_{ 0 };
+
+  /** @brief Create the pair index key of two link ids, which does not depend on their order */
+  static std::uint64_t makePairKey(std::size_t link_id1, std::size_t link_id2);
+
+  /** @brief Find the pair index slot holding the key, or the empty slot where it would be stored */
+  std::size_t findPairSlot(std::uint64_t key) const;
+
+  /** @brief Index the result of a link pair if the pair has not been indexed */
+  void indexPair(std::uint64_t key, std::size_t index);
+};
+
 /**
  * @brief Should return true if contact results are valid, otherwise false.
  *
@@ -338,6 +514,11 @@ struct ContactTestData
                   IsContactAllowedFn fn,
                   ContactRequest req,
                   ContactResultMap& res);
+  ContactTestData(const std::vector<std::string>& active,
+                  CollisionMarginData collision_margin_data,
+                  IsContactAllowedFn fn,
+                  ContactRequest req,
+                  FlatContactResultMap& flat_res);
 
   /** @brief A vector of active links */
   const std::vector<std::string>* active = nullptr;
@@ -348,16 +529,110 @@ struct ContactTestData
   /** @brief The allowed collision function used to check if two links should be excluded from collision checking */
   IsContactAllowedFn fn = nullptr;
 
+  /**
+   * @brief The compiled allowed collision matrix published by fn, if it is a CompiledIsContactAllowedFn
+   * @details If not nullptr it is queried by the index of the collision objects instead of calling fn.
+   */
+  std::shared_ptr<const tesseract_common::CompiledAllowedCollisionMatrix> acm;
+
   /** @brief The type of contact request data */
   ContactRequest req;
 
   /** @brief Distance query results information */
   ContactResultMap* res = nullptr;
 
+  /** @brief Distance query results information, if not nullptr results are stored here instead of in res */
+  FlatContactResultMap* flat_res = nullptr;
+
   /** @brief Indicate if search is finished */
   bool done = false;
 };
 
+/**
+ * @brief Maps collision object names to dense integer ids
+ * @details Ids are assigned in registration order starting at zero. This also caches the contact allowed state
+ * between registered objects so repeated queries by id only call the IsContactAllowedFn once per pair.
+ */
+class CollisionObjectIdMap
+{
+public:
+  /**
+   * @brief Register a collision object name
+   * @param name The collision object name
+   * @return The id of the collision object, if already registered the existing id is returned
+   */
+  std::size_t add(const std::string& name);
+
+  /**
+   * @brief Check if a collision object name has been registered
+   * @param name The collision object name
+   * @return True if registered, otherwise false
+   */
+  bool has(const std::string& name) const;
+
+  /**
+   * @brief Get the id of a registered collision object, this will throw if it is not registered
+   * @param name The collision object name
+   * @return The collision object id
+   */
+  std::size_t getId(const std::string& name) const;
+
+  /**
+   * @brief Get the name of a registered collision object, this will throw if the id is not valid
+   * @param id The collision object id
+   * @return The collision object name
+   */
+  const std::string& getName(std::size_t id) const;
+
+  /**
+   * @brief Get the registered collision object names where the index is the id
+   * @return The registered collision object names
+   */
+  const std::vector<std::string>& getNames() const;
+
+  /** @brief Get the number of registered collision objects */
+  std::size_t size() const;
+
+  /** @brief Check if no collision objects are registered */
+  bool empty() const;
+
+  /**
+   * @brief Check if contact is allowed between two registered collision objects
+   * @details The result of the provided function is cached for the pair until clearContactAllowedCache is called.
+   * @param id1 The id of the first collision object
+   * @param id2 The id of the second collision object
+   * @param fn The contact allowed function
+   * @return True if contact is allowed, otherwise false
+   */
+  bool isContactAllowed(std::size_t id1, std::size_t id2, const IsContactAllowedFn& fn);
+
+  /** @brief Clear the cached contact allowed state, this must be called when the contact allowed function changes */
+  void clearContactAllowedCache();
+
+  /**
+   * @brief Clear the cached contact allowed state of every pair including a single collision object
+   * @details This should be called when the collision object is removed so the id may be reused if it is added again.
+   * @param id The id of the collision object
+   */
+  void clearContactAllowedCache(std::size_t id);
+
+  /** @brief Clear all registered collision objects */
+  void clear();
+
+private:
+  /** @brief The registered collision object names where the index is the id */
+  std::vector<std::string> names_;
+
+  /** @brief A map of collision object name to id */
+  std::unordered_map<std::string, std::size_t> ids_;
+
+  /**
+   * @brief The cached contact allowed state stored as a dense matrix indexed by id
+   * @details Zero indicates the state has not been computed, one is allowed and two is not allowed
+   */
+  std::vector<std::uint8_t> contact_allowed_;
+};
+
 /**
  * @brief High level descriptor used in planners and utilities to specify what kind of collision check is desired.
  *
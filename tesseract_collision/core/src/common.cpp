@@ -36,6 +36,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/utils.h>
 #include <tesseract_common/types.h>
+#include <tesseract_common/allowed_collision_matrix.h>
 #include <tesseract_collision/core/common.h>
 
 namespace tesseract_collision
@@ -80,6 +81,18 @@ bool isLinkActive(const std::vector<std::string>& active, const std::string& nam
   return active.empty() || (std::find(active.begin(), active.end(), name) != active.end());
 }
 
+std::size_t getBatchStateCount(std::size_t active_count, std::size_t transform_count)
+{
+  if (active_count == 0)
+    throw std::runtime_error("Batch contact test requires at least one active collision object!");
+
+  if (transform_count % active_count != 0)
+    throw std::runtime_error("Batch contact test transforms size must be a multiple of the number of active "
+                             "collision objects!");
+
+  return transform_count / active_count;
+}
+
 bool isContactAllowed(const std::string& name1, const std::string& name2, const IsContactAllowedFn& acm, bool verbose)
 {
   // do not distance check geoms part of the same object / link / attached body
@@ -104,6 +117,65 @@ bool isContactAllowed(const std::string& name1, const std::string& name2, const
   return false;
 }
 
+bool isContactAllowed(const std::string& name1,
+                      long index1,
+                      const std::string& name2,
+                      long index2,
+                      const ContactTestData& cdata,
+                      bool verbose)
+{
+  if (cdata.acm == nullptr)
+    return isContactAllowed(name1, name2, cdata.fn, verbose);
+
+  // do not distance check geoms part of the same object / link / attached body
+  if (name1 == name2)
+    return true;
+
+  if (index1 >= 0 && index2 >= 0 &&
+      cdata.acm->isCollisionAllowed(static_cast<std::size_t>(index1), static_cast<std::size_t>(index2)))
+  {
+    if (verbose)
+    {
+      CONSOLE_BRIDGE_logError(
+          "Collision between '%s' and '%s' is allowed. No contacts are computed.", name1.c_str(), name2.c_str());
+    }
+    return true;
+  }
+
+  if (verbose)
+  {
+    CONSOLE_BRIDGE_logError("Actually checking collisions between %s and %s", name1.c_str(), name2.c_str());
+  }
+
+  return false;
+}
+
+bool updateCompiledAllowedCollisionMatrix(ContactTestData& cdata)
+{
+  const auto* compiled_fn = cdata.fn.target<tesseract_common::CompiledIsContactAllowedFn>();
+  std::shared_ptr<const tesseract_common::CompiledAllowedCollisionMatrix> acm =
+      (compiled_fn != nullptr) ? compiled_fn->get() : nullptr;
+  if (acm == cdata.acm)
+    return false;
+
+  cdata.acm = std::move(acm);
+  return true;
+}
+
+long getAllowedCollisionIndex(const ContactTestData& cdata, const std::string& name)
+{
+  return (cdata.acm != nullptr) ? cdata.acm->getIndex(name) : -1;
+}
+
+bool hasContactResult(const ContactTestData& cdata, const ObjectPairKey& key)
+{
+  if (cdata.flat_res != nullptr)
+    return (cdata.flat_res->findContactResult(key.first, key.second) != nullptr);
+
+  const auto it = cdata.res->find(key);
+  return (it != cdata.res->end() && !it->second.empty());
+}
+
 ContactResult* processResult(ContactTestData& cdata,
                              ContactResult& contact,
                              const std::pair<std::string, std::string>& key,
@@ -116,6 +188,27 @@ ContactResult* processResult(ContactTestData& cdata,
       (contact.distance > cdata.collision_margin_data.getPairCollisionMargin(key.first, key.second)))
     return nullptr;
 
+  if (cdata.flat_res != nullptr)
+  {
+    FlatContactResultMap& flat_res = *cdata.flat_res;
+    const std::size_t link_id1 = flat_res.getLinkId(contact.link_names[0]);
+    const std::size_t link_id2 = flat_res.getLinkId(contact.link_names[1]);
+
+    // Only the closest request depends on a previous result of the pair so only it searches the stored results
+    if (cdata.req.type == ContactTestType::CLOSEST)
+    {
+      const ContactResult* closest = flat_res.findContactResult(link_id1, link_id2);
+      if (closest != nullptr)
+        return (contact.distance < closest->distance) ? &flat_res.setContactResult(link_id1, link_id2, contact) :
+                                                        nullptr;
+    }
+
+    if (cdata.req.type == ContactTestType::FIRST)
+      cdata.done = true;
+
+    return &flat_res.addContactResult(link_id1, link_id2, contact);
+  }
+
   if (!found)
   {
     if (cdata.req.type == ContactTestType::FIRST)
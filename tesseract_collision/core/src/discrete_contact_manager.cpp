@@ -26,13 +26,124 @@
 
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/utils.h>
+#include <tesseract_collision/core/common.h>
 
 namespace tesseract_collision
 {
+/**
+ * @brief A query context which owns a clone of the contact manager
+ * @details This is used by contact managers which cannot share their geometry with a context
+ */
+class ClonedDiscreteContactQueryContext : public DiscreteContactQueryContext
+{
+public:
+  explicit ClonedDiscreteContactQueryContext(DiscreteContactManager::UPtr manager) : manager_(std::move(manager)) {}
+
+  void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final
+  {
+    manager_->setCollisionObjectsTransform(name, pose);
+  }
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& poses) override final
+  {
+    manager_->setCollisionObjectsTransform(names, poses);
+  }
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override final
+  {
+    manager_->setCollisionObjectsTransform(transforms);
+  }
+
+  void setCollisionMarginData(CollisionMarginData collision_margin_data,
+                              CollisionMarginOverrideType override_type) override final
+  {
+    manager_->setCollisionMarginData(std::move(collision_margin_data), override_type);
+  }
+
+  const CollisionMarginData& getCollisionMarginData() const override final
+  {
+    return manager_->getCollisionMarginData();
+  }
+
+  void setIsContactAllowedFn(IsContactAllowedFn fn) override final { manager_->setIsContactAllowedFn(std::move(fn)); }
+
+  IsContactAllowedFn getIsContactAllowedFn() const override final { return manager_->getIsContactAllowedFn(); }
+
+  void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final
+  {
+    manager_->contactTest(collisions, request);
+  }
+
+private:
+  DiscreteContactManager::UPtr manager_;
+};
+
 void DiscreteContactManager::applyContactManagerConfig(const ContactManagerConfig& config)
 {
   setCollisionMarginData(config.margin_data, config.margin_data_override_type);
   applyIsContactAllowedFnOverride(*this, config.acm, config.acm_override_type);
   applyModifyObjectEnabled(*this, config.modify_object_enabled);
 }
+
+void DiscreteContactManager::contactTest(FlatContactResultMap& collisions, const ContactRequest& request)
+{
+  ContactResultMap results;
+  contactTest(results, request);
+  collisions.addContactResults(results);
+}
+
+void DiscreteContactManager::contactTest(std::vector<ContactResultMap>& collisions,
+                                         const tesseract_common::VectorIsometry3d& transforms,
+                                         const ContactRequest& request)
+{
+  const std::vector<std::string>& active = getActiveCollisionObjects();
+  const std::size_t num_states = getBatchStateCount(active.size(), transforms.size());
+
+  collisions.resize(num_states);
+  for (std::size_t i = 0; i < num_states; ++i)
+  {
+    const std::size_t offset = i * active.size();
+    for (std::size_t j = 0; j < active.size(); ++j)
+      setCollisionObjectsTransform(active[j], transforms[offset + j]);
+
+    contactTest(collisions[i], request);
+  }
+}
+
+std::size_t DiscreteContactManager::registerCollisionObjectId(const std::string& /*name*/)
+{
+  throw std::runtime_error("DiscreteContactManager, '" + getName() + "' does not support collision object ids!");
+}
+
+const CollisionObjectIdMap& DiscreteContactManager::getCollisionObjectIdMap() const
+{
+  throw std::runtime_error("DiscreteContactManager, '" + getName() + "' does not support collision object ids!");
+}
+
+void DiscreteContactManager::setCollisionObjectsTransform(std::size_t /*id*/, const Eigen::Isometry3d& /*pose*/)
+{
+  throw std::runtime_error("DiscreteContactManager, '" + getName() + "' does not support collision object ids!");
+}
+
+void DiscreteContactManager::setCollisionObjectsTransform(const std::vector<std::size_t>& ids,
+                                                          const tesseract_common::VectorIsometry3d& poses)
+{
+  assert(ids.size() == poses.size());
+  for (std::size_t i = 0; i < ids.size(); ++i)
+    setCollisionObjectsTransform(ids[i], poses[i]);
+}
+
+void DiscreteContactManager::contactTest(ContactResultMap& /*collisions*/,
+                                         std::size_t /*id1*/,
+                                         std::size_t /*id2*/,
+                                         const ContactRequest& /*request*/)
+{
+  throw std::runtime_error("DiscreteContactManager, '" + getName() + "' does not support collision object ids!");
+}
+
+DiscreteContactQueryContext::UPtr DiscreteContactManager::createQueryContext() const
+{
+  return std::make_unique<ClonedDiscreteContactQueryContext>(clone());
+}
 }  // namespace tesseract_collision
@@ -26,7 +26,10 @@
 
 #include <tesseract_collision/core/types.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cassert>
 #include <iomanip>
+#include <stdexcept>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_collision
@@ -84,6 +87,194 @@ bool ContactResult::operator==(const ContactResult& rhs) const
 }
 bool ContactResult::operator!=(const ContactResult& rhs) const { return !operator==(rhs); }
 
+std::size_t FlatContactResultMap::getLinkId(const std::string& link_name)
+{
+  auto it = link_name_ids_.find(link_name);
+  if (it != link_name_ids_.end())
+    return it->second;
+
+  const std::size_t link_id = link_names_.size();
+  link_names_.push_back(link_name);
+  link_name_ids_[link_name] = link_id;
+  return link_id;
+}
+
+const std::string& FlatContactResultMap::getLinkName(std::size_t link_id) const { return link_names_.at(link_id); }
+
+const std::vector<std::string>& FlatContactResultMap::getLinkNames() const { return link_names_; }
+
+ContactResult& FlatContactResultMap::addContactResult(std::size_t link_id1,
+                                                      std::size_t link_id2,
+                                                      const ContactResult& result)
+{
+  assert(link_id1 < link_names_.size() && link_id2 < link_names_.size());
+  if (size_ == results_.size())
+  {
+    results_.emplace_back();
+    link_ids_.emplace_back();
+  }
+
+  // The link names reuse the string storage of the stored result
+  ContactResult& r = results_[size_];
+  r = result;
+  link_ids_[size_] = { link_id1, link_id2 };
+  indexPair(makePairKey(link_id1, link_id2), size_);
+  ++size_;
+  return r;
+}
+
+ContactResult& FlatContactResultMap::addContactResult(const ContactResult& result)
+{
+  return addContactResult(getLinkId(result.link_names[0]), getLinkId(result.link_names[1]), result);
+}
+
+const ContactResult* FlatContactResultMap::findContactResult(std::size_t link_id1, std::size_t link_id2) const
+{
+  if (pair_slots_.empty())
+    return nullptr;
+
+  const PairSlot& slot = pair_slots_[findPairSlot(makePairKey(link_id1, link_id2))];
+  return (slot.generation == pair_generation_) ? &results_[slot.index] : nullptr;
+}
+
+const ContactResult* FlatContactResultMap::findContactResult(const std::string& link_name1,
+                                                             const std::string& link_name2) const
+{
+  auto it1 = link_name_ids_.find(link_name1);
+  if (it1 == link_name_ids_.end())
+    return nullptr;
+
+  auto it2 = link_name_ids_.find(link_name2);
+  if (it2 == link_name_ids_.end())
+    return nullptr;
+
+  return findContactResult(it1->second, it2->second);
+}
+
+ContactResult& FlatContactResultMap::setContactResult(std::size_t link_id1,
+                                                      std::size_t link_id2,
+                                                      const ContactResult& result)
+{
+  if (!pair_slots_.empty())
+  {
+    const PairSlot& slot = pair_slots_[findPairSlot(makePairKey(link_id1, link_id2))];
+    if (slot.generation == pair_generation_)
+    {
+      results_[slot.index] = result;
+      link_ids_[slot.index] = { link_id1, link_id2 };
+      return results_[slot.index];
+    }
+  }
+
+  return addContactResult(link_id1, link_id2, result);
+}
+
+void FlatContactResultMap::addContactResults(const ContactResultMap& results)
+{
+  for (const auto& pair : results)
+  {
+    for (const auto& result : pair.second)
+      addContactResult(result);
+  }
+}
+
+void FlatContactResultMap::toContactResultMap(ContactResultMap& results) const
+{
+  for (std::size_t i = 0; i < size_; ++i)
+  {
+    const std::string& link_name1 = link_names_[link_ids_[i][0]];
+    const std::string& link_name2 = link_names_[link_ids_[i][1]];
+    ContactResult& r = results.addContactResult(tesseract_common::makeOrderedLinkPair(link_name1, link_name2),
+                                                results_[i]);
+    r.link_names[0] = link_name1;
+    r.link_names[1] = link_name2;
+  }
+}
+
+const ContactResult& FlatContactResultMap::getContactResult(std::size_t index) const
+{
+  assert(index < size_);
+  return results_[index];
+}
+
+const FlatContactResultMap::LinkIdPair& FlatContactResultMap::getLinkIds(std::size_t index) const
+{
+  assert(index < size_);
+  return link_ids_[index];
+}
+
+std::size_t FlatContactResultMap::size() const { return size_; }
+
+bool FlatContactResultMap::empty() const { return (size_ == 0); }
+
+void FlatContactResultMap::clear()
+{
+  size_ = 0;
+  num_pairs_ = 0;
+  ++pair_generation_;
+}
+
+void FlatContactResultMap::release()
+{
+  results_.clear();
+  link_ids_.clear();
+  size_ = 0;
+  link_names_.clear();
+  link_name_ids_.clear();
+  pair_slots_.clear();
+  num_pairs_ = 0;
+}
+
+std::uint64_t FlatContactResultMap::makePairKey(std::size_t link_id1, std::size_t link_id2)
+{
+  assert(link_id1 <= 0xFFFFFFFFU && link_id2 <= 0xFFFFFFFFU);
+  const auto lower = static_cast<std::uint64_t>(std::min(link_id1, link_id2));
+  const auto upper = static_cast<std::uint64_t>(std::max(link_id1, link_id2));
+  return (lower << 32U) | upper;
+}
+
+std::size_t FlatContactResultMap::findPairSlot(std::uint64_t key) const
+{
+  assert(!pair_slots_.empty());
+  const std::size_t mask = pair_slots_.size() - 1;
+
+  // Fibonacci hashing mixes both link ids into the bits used by the mask
+  auto slot = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32U) & mask;
+  while (pair_slots_[slot].generation == pair_generation_ && pair_slots_[slot].key != key)
+    slot = (slot + 1) & mask;
+
+  return slot;
+}
+
+void FlatContactResultMap::indexPair(std::uint64_t key, std::size_t index)
+{
+  // Keep the table at most half full so the probe sequences stay short
+  if (2 * (num_pairs_ + 1) > pair_slots_.size())
+  {
+    std::vector<PairSlot> old_slots(std::max<std::size_t>(16, 2 * pair_slots_.size()));
+    old_slots.swap(pair_slots_);
+    for (const auto& old_slot : old_slots)
+    {
+      if (old_slot.generation == pair_generation_)
+        pair_slots_[findPairSlot(old_slot.key)] = old_slot;
+    }
+  }
+
+  PairSlot& slot = pair_slots_[findPairSlot(key)];
+  if (slot.generation == pair_generation_)
+    return;
+
+  slot = PairSlot{ key, index, pair_generation_ };
+  ++num_pairs_;
+}
+
+FlatContactResultMap::ConstIteratorType FlatContactResultMap::begin() const { return results_.begin(); }
+
+FlatContactResultMap::ConstIteratorType FlatContactResultMap::end() const
+{
+  return results_.begin() + static_cast<long>(size_);
+}
+
 ContactRequest::ContactRequest(ContactTestType type) : type(type) {}
 
 ContactResult& ContactResultMap::addContactResult(const KeyType& key, ContactResult result)
@@ -321,6 +512,108 @@ ContactTestData::ContactTestData(const std::vector<std::string>& active,
 {
 }
 
+ContactTestData::ContactTestData(const std::vector<std::string>& active,
+                                 CollisionMarginData collision_margin_data,
+                                 IsContactAllowedFn fn,
+                                 ContactRequest req,
+                                 FlatContactResultMap& flat_res)
+  : active(&active)
+  , collision_margin_data(std::move(collision_margin_data))
+  , fn(std::move(fn))
+  , req(std::move(req))
+  , flat_res(&flat_res)
+{
+}
+
+std::size_t CollisionObjectIdMap::add(const std::string& name)
+{
+  auto it = ids_.find(name);
+  if (it != ids_.end())
+    return it->second;
+
+  const std::size_t id = names_.size();
+  names_.push_back(name);
+  ids_[name] = id;
+
+  // The cache is indexed by the number of objects so it must be recomputed
+  clearContactAllowedCache();
+  return id;
+}
+
+bool CollisionObjectIdMap::has(const std::string& name) const { return (ids_.find(name) != ids_.end()); }
+
+std::size_t CollisionObjectIdMap::getId(const std::string& name) const
+{
+  auto it = ids_.find(name);
+  if (it == ids_.end())
+    throw std::runtime_error("CollisionObjectIdMap, collision object '" + name + "' is not registered!");
+
+  return it->second;
+}
+
+const std::string& CollisionObjectIdMap::getName(std::size_t id) const
+{
+  if (id >= names_.size())
+    throw std::runtime_error("CollisionObjectIdMap, collision object id " + std::to_string(id) + " is not valid!");
+
+  return names_[id];
+}
+
+const std::vector<std::string>& CollisionObjectIdMap::getNames() const { return names_; }
+
+std::size_t CollisionObjectIdMap::size() const { return names_.size(); }
+
+bool CollisionObjectIdMap::empty() const { return names_.empty(); }
+
+bool CollisionObjectIdMap::isContactAllowed(std::size_t id1, std::size_t id2, const IsContactAllowedFn& fn)
+{
+  const std::string& name1 = getName(id1);
+  const std::string& name2 = getName(id2);
+  if (id1 == id2)
+    return true;
+
+  if (fn == nullptr)
+    return false;
+
+  const std::size_t n = names_.size();
+  if (contact_allowed_.size() != n * n)
+    contact_allowed_.assign(n * n, 0);
+
+  std::uint8_t& state = contact_allowed_[(id1 * n) + id2];
+  if (state == 0)
+  {
+    state = fn(name1, name2) ? 1 : 2;
+    contact_allowed_[(id2 * n) + id1] = state;
+  }
+
+  return (state == 1);
+}
+
+void CollisionObjectIdMap::clearContactAllowedCache() { contact_allowed_.clear(); }
+
+void CollisionObjectIdMap::clearContactAllowedCache(std::size_t id)
+{
+  const std::size_t n = names_.size();
+  if (id >= n)
+    throw std::runtime_error("CollisionObjectIdMap, collision object id " + std::to_string(id) + " is not valid!");
+
+  if (contact_allowed_.size() != n * n)
+    return;
+
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    contact_allowed_[(id * n) + i] = 0;
+    contact_allowed_[(i * n) + id] = 0;
+  }
+}
+
+void CollisionObjectIdMap::clear()
+{
+  names_.clear();
+  ids_.clear();
+  contact_allowed_.clear();
+}
+
 ContactManagerConfig::ContactManagerConfig(double default_margin)
   : margin_data_override_type(CollisionMarginOverrideType::OVERRIDE_DEFAULT_MARGIN), margin_data(default_margin)
 {
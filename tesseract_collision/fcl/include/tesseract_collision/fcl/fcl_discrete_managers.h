@@ -119,6 +119,26 @@ public:
 
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
 
+  void contactTest(FlatContactResultMap& collisions, const ContactRequest& request) override final;
+
+  void contactTest(std::vector<ContactResultMap>& collisions,
+                   const tesseract_common::VectorIsometry3d& transforms,
+                   const ContactRequest& request) override final;
+
+  std::size_t registerCollisionObjectId(const std::string& name) override final;
+
+  const CollisionObjectIdMap& getCollisionObjectIdMap() const override final;
+
+  void setCollisionObjectsTransform(std::size_t id, const Eigen::Isometry3d& pose) override final;
+
+  void setCollisionObjectsTransform(const std::vector<std::size_t>& ids,
+                                    const tesseract_common::VectorIsometry3d& poses) override final;
+
+  void contactTest(ContactResultMap& collisions,
+                   std::size_t id1,
+                   std::size_t id2,
+                   const ContactRequest& request) override final;
+
   /**
    * @brief Add a fcl collision object to the manager
    * @param cow The tesseract fcl collision object
@@ -140,6 +160,11 @@ private:
   CollisionMarginData collision_margin_data_;  /**< @brief The contact distance threshold */
   IsContactAllowedFn fn_;                      /**< @brief The is allowed collision function */
   std::size_t fcl_co_count_{ 0 };              /**< @brief The number fcl collision objects */
+  CollisionObjectIdMap object_ids_;            /**< @brief The registered collision object ids */
+  std::vector<COW::Ptr> id2cow_;               /**< @brief The registered collision objects indexed by id */
+
+  /** @brief The compiled allowed collision matrix the collision object indices refer to, see ContactTestData::acm */
+  std::shared_ptr<const tesseract_common::CompiledAllowedCollisionMatrix> acm_;
 
   /** @brief This is used to store static collision objects to update */
   std::vector<CollisionObjectRawPtr> static_update_;
@@ -149,6 +174,15 @@ private:
 
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /** @brief Perform the broadphase contact test storing the results in the contact test data */
+  void contactTestHelper(ContactTestData& cdata);
+
+  /**
+   * @brief Update the compiled allowed collision matrix of the contact test data and the collision object indices
+   * @param cdata The contact test data
+   */
+  void updateAllowedCollisionIndices(ContactTestData& cdata);
 };
 
 }  // namespace tesseract_collision::tesseract_collision_fcl
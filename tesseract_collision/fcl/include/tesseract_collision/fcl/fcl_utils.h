@@ -91,24 +91,32 @@ public:
   short int m_collisionFilterGroup{ CollisionFilterGroups::KinematicFilter };
   short int m_collisionFilterMask{ CollisionFilterGroups::StaticFilter | CollisionFilterGroups::KinematicFilter };
   bool m_enabled{ true };
+  /** @brief The index in the compiled allowed collision matrix of the contact test data, -1 if it has none */
+  long m_acm_index{ -1 };
 
   const std::string& getName() const { return name_; }
   const int& getTypeID() const { return type_id_; }
   /** \brief Check if two objects point to the same source object */
   bool sameObject(const CollisionObjectWrapper& other) const
   {
-    return name_ == other.name_ && type_id_ == other.type_id_ && shapes_.size() == other.shapes_.size() &&
-           shape_poses_.size() == other.shape_poses_.size() &&
-           std::equal(shapes_.begin(), shapes_.end(), other.shapes_.begin()) &&
-           std::equal(shape_poses_.begin(),
-                      shape_poses_.end(),
-                      other.shape_poses_.begin(),
+    if (name_ != other.name_ || type_id_ != other.type_id_)
+      return false;
+
+    // Clones share the same immutable shape data
+    if (shapes_ == other.shapes_ && shape_poses_ == other.shape_poses_)
+      return true;
+
+    return shapes_->size() == other.shapes_->size() && shape_poses_->size() == other.shape_poses_->size() &&
+           std::equal(shapes_->begin(), shapes_->end(), other.shapes_->begin()) &&
+           std::equal(shape_poses_->begin(),
+                      shape_poses_->end(),
+                      other.shape_poses_->begin(),
                       [](const Eigen::Isometry3d& t1, const Eigen::Isometry3d& t2) { return t1.isApprox(t2); });
   }
 
-  const CollisionShapesConst& getCollisionGeometries() const { return shapes_; }
+  const CollisionShapesConst& getCollisionGeometries() const { return *shapes_; }
 
-  const tesseract_common::VectorIsometry3d& getCollisionGeometriesTransforms() const { return shape_poses_; }
+  const tesseract_common::VectorIsometry3d& getCollisionGeometriesTransforms() const { return *shape_poses_; }
 
   void setCollisionObjectsTransform(const Eigen::Isometry3d& pose)
   {
@@ -116,7 +124,7 @@ public:
     for (unsigned i = 0; i < collision_objects_.size(); ++i)
     {
       CollisionObjectPtr& co = collision_objects_[i];
-      co->setTransform(pose * shape_poses_[i]);
+      co->setTransform(pose * (*shape_poses_)[i]);
       co->updateAABB();  // This a tesseract function that updates abb to take into account contact distance
     }
   }
@@ -160,6 +168,7 @@ public:
     clone_cow->m_collisionFilterGroup = m_collisionFilterGroup;
     clone_cow->m_collisionFilterMask = m_collisionFilterMask;
     clone_cow->m_enabled = m_enabled;
+    clone_cow->m_acm_index = m_acm_index;
     return clone_cow;
   }
 
@@ -174,9 +183,10 @@ protected:
   std::string name_;                                              // name of the collision object
   int type_id_{ -1 };                                             // user defined type id
   Eigen::Isometry3d world_pose_{ Eigen::Isometry3d::Identity() }; /**< @brief Collision Object World Transformation */
-  CollisionShapesConst shapes_;
-  tesseract_common::VectorIsometry3d shape_poses_;
-  std::vector<CollisionGeometryPtr> collision_geometries_;
+  /** @brief The shapes, shape poses and fcl geometries are immutable and shared between clones */
+  std::shared_ptr<const CollisionShapesConst> shapes_;
+  std::shared_ptr<const tesseract_common::VectorIsometry3d> shape_poses_;
+  std::shared_ptr<const std::vector<CollisionGeometryPtr>> collision_geometries_;
   std::vector<CollisionObjectPtr> collision_objects_;
   /**
    * @brief The raw pointer is also stored because FCL accepts vectors for batch process.
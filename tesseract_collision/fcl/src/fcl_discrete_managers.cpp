@@ -40,12 +40,23 @@
  */
 
 #include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_common/allowed_collision_matrix.h>
 
 namespace tesseract_collision::tesseract_collision_fcl
 {
 static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
 static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
 
+/** @brief Get the collision object of a registered id, this will throw if the collision object has been removed */
+static const COW::Ptr& getRegisteredCollisionObject(const std::vector<COW::Ptr>& id2cow, std::size_t id)
+{
+  const COW::Ptr& cow = id2cow.at(id);
+  if (cow == nullptr)
+    throw std::runtime_error("FCLDiscreteBVHManager, collision object id " + std::to_string(id) + " has been removed!");
+
+  return cow;
+}
+
 FCLDiscreteBVHManager::FCLDiscreteBVHManager(std::string name) : name_(std::move(name))
 {
   static_manager_ = std::make_unique<fcl::DynamicAABBTreeCollisionManagerd>();
@@ -66,6 +77,15 @@ DiscreteContactManager::UPtr FCLDiscreteBVHManager::clone() const
   manager->setCollisionMarginData(collision_margin_data_);
   manager->setIsContactAllowedFn(fn_);
 
+  // The ids are copied so they include the ids of removed collision objects
+  manager->object_ids_ = object_ids_;
+  manager->id2cow_.reserve(id2cow_.size());
+  for (const auto& name : object_ids_.getNames())
+  {
+    auto it = manager->link2cow_.find(name);
+    manager->id2cow_.push_back((it != manager->link2cow_.end()) ? it->second : nullptr);
+  }
+
   return manager;
 }
 
@@ -137,6 +157,15 @@ bool FCLDiscreteBVHManager::removeCollisionObject(const std::string& name)
 
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
     link2cow_.erase(name);
+
+    // Only the removed id is invalidated so the remaining ids and their cached contact allowed state stay valid
+    if (object_ids_.has(name))
+    {
+      const std::size_t id = object_ids_.getId(name);
+      object_ids_.clearContactAllowedCache(id);
+      id2cow_[id] = nullptr;
+    }
+
     return true;
   }
   return false;
@@ -308,12 +337,30 @@ void FCLDiscreteBVHManager::setPairCollisionMarginData(const std::string& name1,
 }
 
 const CollisionMarginData& FCLDiscreteBVHManager::getCollisionMarginData() const { return collision_margin_data_; }
-void FCLDiscreteBVHManager::setIsContactAllowedFn(IsContactAllowedFn fn) { fn_ = fn; }
+void FCLDiscreteBVHManager::setIsContactAllowedFn(IsContactAllowedFn fn)
+{
+  fn_ = fn;
+  object_ids_.clearContactAllowedCache();
+}
+
 IsContactAllowedFn FCLDiscreteBVHManager::getIsContactAllowedFn() const { return fn_; }
 
 void FCLDiscreteBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
   ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
+  contactTestHelper(cdata);
+}
+
+void FCLDiscreteBVHManager::contactTest(FlatContactResultMap& collisions, const ContactRequest& request)
+{
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
+  contactTestHelper(cdata);
+}
+
+void FCLDiscreteBVHManager::contactTestHelper(ContactTestData& cdata)
+{
+  updateAllowedCollisionIndices(cdata);
+
   if (collision_margin_data_.getMaxCollisionMargin() > 0)
   {
     // TODO: Should the order be flipped?
@@ -336,8 +383,167 @@ void FCLDiscreteBVHManager::contactTest(ContactResultMap& collisions, const Cont
   }
 }
 
+void FCLDiscreteBVHManager::contactTest(std::vector<ContactResultMap>& collisions,
+                                        const tesseract_common::VectorIsometry3d& transforms,
+                                        const ContactRequest& request)
+{
+  const std::size_t num_states = getBatchStateCount(active_.size(), transforms.size());
+
+  // Resolve the active collision objects once so each state only updates transforms and the broadphase
+  std::vector<COW::Ptr> active_cows;
+  active_cows.reserve(active_.size());
+  for (const auto& name : active_)
+  {
+    auto it = link2cow_.find(name);
+    active_cows.push_back((it != link2cow_.end()) ? it->second : nullptr);
+  }
+
+  collisions.resize(num_states);
+  for (std::size_t i = 0; i < num_states; ++i)
+  {
+    const std::size_t offset = i * active_.size();
+    static_update_.clear();
+    dynamic_update_.clear();
+    for (std::size_t j = 0; j < active_cows.size(); ++j)
+    {
+      const COW::Ptr& cow = active_cows[j];
+      if (cow == nullptr)
+        continue;
+
+      const Eigen::Isometry3d& pose = transforms[offset + j];
+      const Eigen::Isometry3d& cur_tf = cow->getCollisionObjectsTransform();
+      // Note: If the transform has not changed do not updated to prevent unnecessary re-balancing of the BVH tree
+      if (!cur_tf.translation().isApprox(pose.translation(), 1e-8) ||
+          !cur_tf.rotation().isApprox(pose.rotation(), 1e-8))
+      {
+        cow->setCollisionObjectsTransform(pose);
+        std::vector<CollisionObjectRawPtr>& co = cow->getCollisionObjectsRaw();
+        if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+          static_update_.insert(static_update_.end(), co.begin(), co.end());
+        else
+          dynamic_update_.insert(dynamic_update_.end(), co.begin(), co.end());
+      }
+    }
+
+    // Batch update so the tree is only re-balanced once per state
+    if (!static_update_.empty())
+      static_manager_->update(static_update_);
+
+    if (!dynamic_update_.empty())
+      dynamic_manager_->update(dynamic_update_);
+
+    contactTest(collisions[i], request);
+  }
+}
+
+std::size_t FCLDiscreteBVHManager::registerCollisionObjectId(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    throw std::runtime_error("FCLDiscreteBVHManager, collision object '" + name + "' does not exist!");
+
+  std::size_t id = object_ids_.add(name);
+  if (id == id2cow_.size())
+    id2cow_.push_back(it->second);
+
+  return id;
+}
+
+const CollisionObjectIdMap& FCLDiscreteBVHManager::getCollisionObjectIdMap() const { return object_ids_; }
+
+void FCLDiscreteBVHManager::setCollisionObjectsTransform(std::size_t id, const Eigen::Isometry3d& pose)
+{
+  const COW::Ptr& cow = getRegisteredCollisionObject(id2cow_, id);
+  const Eigen::Isometry3d& cur_tf = cow->getCollisionObjectsTransform();
+  // Note: If the transform has not changed do not updated to prevent unnecessary re-balancing of the BVH tree
+  if (!cur_tf.translation().isApprox(pose.translation(), 1e-8) || !cur_tf.rotation().isApprox(pose.rotation(), 1e-8))
+  {
+    cow->setCollisionObjectsTransform(pose);
+    if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+    {
+      // Note: Calling update causes a re-balance of the AABB tree, which is expensive
+      static_manager_->update(cow->getCollisionObjectsRaw());
+    }
+    else
+    {
+      // Note: Calling update causes a re-balance of the AABB tree, which is expensive
+      dynamic_manager_->update(cow->getCollisionObjectsRaw());
+    }
+  }
+}
+
+void FCLDiscreteBVHManager::setCollisionObjectsTransform(const std::vector<std::size_t>& ids,
+                                                         const tesseract_common::VectorIsometry3d& poses)
+{
+  assert(ids.size() == poses.size());
+  static_update_.clear();
+  dynamic_update_.clear();
+  for (std::size_t i = 0; i < ids.size(); ++i)
+  {
+    const COW::Ptr& cow = getRegisteredCollisionObject(id2cow_, ids[i]);
+    const Eigen::Isometry3d& cur_tf = cow->getCollisionObjectsTransform();
+    // Note: If the transform has not changed do not updated to prevent unnecessary re-balancing of the BVH tree
+    if (!cur_tf.translation().isApprox(poses[i].translation(), 1e-8) ||
+        !cur_tf.rotation().isApprox(poses[i].rotation(), 1e-8))
+    {
+      cow->setCollisionObjectsTransform(poses[i]);
+      std::vector<CollisionObjectRawPtr>& co = cow->getCollisionObjectsRaw();
+      if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+        static_update_.insert(static_update_.end(), co.begin(), co.end());
+      else
+        dynamic_update_.insert(dynamic_update_.end(), co.begin(), co.end());
+    }
+  }
+
+  // This is because FCL supports batch update which only re-balances the tree once
+  if (!static_update_.empty())
+    static_manager_->update(static_update_);
+
+  if (!dynamic_update_.empty())
+    dynamic_manager_->update(dynamic_update_);
+}
+
+void FCLDiscreteBVHManager::contactTest(ContactResultMap& collisions,
+                                        std::size_t id1,
+                                        std::size_t id2,
+                                        const ContactRequest& request)
+{
+  const COW::Ptr& cow1 = getRegisteredCollisionObject(id2cow_, id1);
+  const COW::Ptr& cow2 = getRegisteredCollisionObject(id2cow_, id2);
+
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
+  updateAllowedCollisionIndices(cdata);
+
+  // Without a compiled allowed collision matrix the contact allowed function is cached by id
+  bool needs_collision =
+      cow1->m_enabled && cow2->m_enabled &&
+      (cow1->m_collisionFilterGroup & cow2->m_collisionFilterMask) &&  // NOLINT
+      (cow2->m_collisionFilterGroup & cow1->m_collisionFilterMask) &&  // NOLINT
+      ((cdata.acm != nullptr) ?
+           !isContactAllowed(cow1->getName(), cow1->m_acm_index, cow2->getName(), cow2->m_acm_index, cdata) :
+           !object_ids_.isContactAllowed(id1, id2, fn_));
+  if (!needs_collision)
+    return;
+
+  // The cached result has already been checked so the callbacks do not call the contact allowed function again
+  if (cdata.acm == nullptr)
+    cdata.fn = nullptr;
+
+  const bool use_distance = (collision_margin_data_.getMaxCollisionMargin() > 0);
+  for (auto* co1 : cow1->getCollisionObjectsRaw())
+  {
+    for (auto* co2 : cow2->getCollisionObjectsRaw())
+    {
+      bool done = use_distance ? distanceCallback(co1, co2, &cdata) : collisionCallback(co1, co2, &cdata);
+      if (done)
+        return;
+    }
+  }
+}
+
 void FCLDiscreteBVHManager::addCollisionObject(const COW::Ptr& cow)
 {
+  cow->m_acm_index = (acm_ != nullptr) ? acm_->getIndex(cow->getName()) : -1;
   std::size_t cnt = cow->getCollisionObjectsRaw().size();
   fcl_co_count_ += cnt;
   static_update_.reserve(fcl_co_count_);
@@ -345,6 +551,9 @@ void FCLDiscreteBVHManager::addCollisionObject(const COW::Ptr& cow)
   link2cow_[cow->getName()] = cow;
   collision_objects_.push_back(cow->getName());
 
+  if (object_ids_.has(cow->getName()))
+    id2cow_[object_ids_.getId(cow->getName())] = cow;
+
   std::vector<CollisionObjectPtr>& objects = cow->getCollisionObjects();
   if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
   {
@@ -392,4 +601,15 @@ void FCLDiscreteBVHManager::onCollisionMarginDataChanged()
   if (!dynamic_update_.empty())
     dynamic_manager_->update(dynamic_update_);
 }
+
+void FCLDiscreteBVHManager::updateAllowedCollisionIndices(ContactTestData& cdata)
+{
+  cdata.acm = acm_;
+  if (!updateCompiledAllowedCollisionMatrix(cdata))
+    return;
+
+  acm_ = cdata.acm;
+  for (const auto& cow : link2cow_)
+    cow.second->m_acm_index = getAllowedCollisionIndex(cdata, cow.first);
+}
 }  // namespace tesseract_collision::tesseract_collision_fcl
@@ -217,7 +217,8 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
   bool needs_collision = cd1->m_enabled && cd2->m_enabled &&
                          (cd1->m_collisionFilterGroup & cd2->m_collisionFilterMask) &&  // NOLINT
                          (cd2->m_collisionFilterGroup & cd1->m_collisionFilterMask) &&  // NOLINT
-                         !isContactAllowed(cd1->getName(), cd2->getName(), cdata->fn, false);
+                         !isContactAllowed(
+                             cd1->getName(), cd1->m_acm_index, cd2->getName(), cd2->m_acm_index, *cdata, false);
 
   assert(std::find(cdata->active->begin(), cdata->active->end(), cd1->getName()) != cdata->active->end() ||
          std::find(cdata->active->begin(), cdata->active->end(), cd2->getName()) != cdata->active->end());
@@ -261,9 +262,9 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
       contact.distance = -1.0 * fcl_contact.penetration_depth;
       contact.normal = fcl_contact.normal;
 
-      ObjectPairKey pc = tesseract_common::makeOrderedLinkPair(cd1->getName(), cd2->getName());
-      const auto it = cdata->res->find(pc);
-      bool found = (it != cdata->res->end() && !it->second.empty());
+      thread_local ObjectPairKey pc;
+      tesseract_common::makeOrderedLinkPair(pc, cd1->getName(), cd2->getName());
+      bool found = hasContactResult(*cdata, pc);
 
       processResult(*cdata, contact, pc, found);
     }
@@ -285,7 +286,8 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
   bool needs_collision = cd1->m_enabled && cd2->m_enabled &&
                          (cd1->m_collisionFilterGroup & cd2->m_collisionFilterMask) &&  // NOLINT
                          (cd2->m_collisionFilterGroup & cd1->m_collisionFilterMask) &&  // NOLINT
-                         !isContactAllowed(cd1->getName(), cd2->getName(), cdata->fn, false);
+                         !isContactAllowed(
+                             cd1->getName(), cd1->m_acm_index, cd2->getName(), cd2->m_acm_index, *cdata, false);
 
   assert(std::find(cdata->active->begin(), cdata->active->end(), cd1->getName()) != cdata->active->end() ||
          std::find(cdata->active->begin(), cdata->active->end(), cd2->getName()) != cdata->active->end());
@@ -325,9 +327,9 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
     // TODO: There is an issue with FCL need to track down
     assert(!std::isnan(contact.nearest_points[0](0)));
 
-    ObjectPairKey pc = tesseract_common::makeOrderedLinkPair(cd1->getName(), cd2->getName());
-    const auto it = cdata->res->find(pc);
-    bool found = (it != cdata->res->end() && !it->second.empty());
+    thread_local ObjectPairKey pc;
+    tesseract_common::makeOrderedLinkPair(pc, cd1->getName(), cd2->getName());
+    bool found = hasContactResult(*cdata, pc);
 
     processResult(*cdata, contact, pc, found);
   }
@@ -339,33 +341,39 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
                                                const int& type_id,
                                                CollisionShapesConst shapes,
                                                tesseract_common::VectorIsometry3d shape_poses)
-  : name_(std::move(name)), type_id_(type_id), shapes_(std::move(shapes)), shape_poses_(std::move(shape_poses))
+  : name_(std::move(name))
+  , type_id_(type_id)
+  , shapes_(std::make_shared<const CollisionShapesConst>(std::move(shapes)))
+  , shape_poses_(std::make_shared<const tesseract_common::VectorIsometry3d>(std::move(shape_poses)))
 {
-  assert(!shapes_.empty());                       // NOLINT
-  assert(!shape_poses_.empty());                  // NOLINT
-  assert(!name_.empty());                         // NOLINT
-  assert(shapes_.size() == shape_poses_.size());  // NOLINT
+  const CollisionShapesConst& geoms = *shapes_;
+  const tesseract_common::VectorIsometry3d& geom_poses = *shape_poses_;
+  assert(!geoms.empty());                     // NOLINT
+  assert(!geom_poses.empty());                // NOLINT
+  assert(!name_.empty());                     // NOLINT
+  assert(geoms.size() == geom_poses.size());  // NOLINT
 
   m_collisionFilterGroup = CollisionFilterGroups::KinematicFilter;
   m_collisionFilterMask = CollisionFilterGroups::StaticFilter | CollisionFilterGroups::KinematicFilter;
 
-  collision_geometries_.reserve(shapes_.size());
-  collision_objects_.reserve(shapes_.size());
-  collision_objects_raw_.reserve(shapes_.size());
-  for (std::size_t i = 0; i < shapes_.size(); ++i)  // NOLINT
+  std::vector<CollisionGeometryPtr> collision_geometries;
+  collision_geometries.reserve(geoms.size());
+  collision_objects_.reserve(geoms.size());
+  collision_objects_raw_.reserve(geoms.size());
+  for (std::size_t i = 0; i < geoms.size(); ++i)  // NOLINT
   {
-    if (shapes_[i]->getType() == tesseract_geometry::GeometryType::COMPOUND_MESH)
+    if (geoms[i]->getType() == tesseract_geometry::GeometryType::COMPOUND_MESH)
     {
-      const auto& meshes = std::static_pointer_cast<const tesseract_geometry::CompoundMesh>(shapes_[i])->getMeshes();
+      const auto& meshes = std::static_pointer_cast<const tesseract_geometry::CompoundMesh>(geoms[i])->getMeshes();
       for (const auto& mesh : meshes)
       {
         CollisionGeometryPtr subshape = createShapePrimitive(mesh);
         if (subshape != nullptr)
         {
-          collision_geometries_.push_back(subshape);
+          collision_geometries.push_back(subshape);
           auto co = std::make_shared<FCLCollisionObjectWrapper>(subshape);
           co->setUserData(this);
-          co->setTransform(shape_poses_[i]);
+          co->setTransform(geom_poses[i]);
           co->updateAABB();
           collision_objects_.push_back(co);
           collision_objects_raw_.push_back(co.get());
@@ -374,19 +382,21 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
     }
     else
     {
-      CollisionGeometryPtr subshape = createShapePrimitive(shapes_[i]);
+      CollisionGeometryPtr subshape = createShapePrimitive(geoms[i]);
       if (subshape != nullptr)
       {
-        collision_geometries_.push_back(subshape);
+        collision_geometries.push_back(subshape);
         auto co = std::make_shared<FCLCollisionObjectWrapper>(subshape);
         co->setUserData(this);
-        co->setTransform(shape_poses_[i]);
+        co->setTransform(geom_poses[i]);
         co->updateAABB();
         collision_objects_.push_back(co);
         collision_objects_raw_.push_back(co.get());
       }
     }
   }
+
+  collision_geometries_ = std::make_shared<const std::vector<CollisionGeometryPtr>>(std::move(collision_geometries));
 }
 
 int CollisionObjectWrapper::getShapeIndex(const fcl::CollisionObjectd* co) const
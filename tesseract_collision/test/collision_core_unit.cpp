@@ -7,6 +7,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/core/common.h>
 #include <tesseract_common/utils.h>
+#include <tesseract_common/allowed_collision_matrix.h>
 
 TEST(TesseractCoreUnit, getCollisionObjectPairsUnit)  // NOLINT
 {
@@ -62,6 +63,108 @@ TEST(TesseractCoreUnit, isContactAllowedUnit)  // NOLINT
   EXPECT_TRUE(tesseract_collision::isContactAllowed("base_link", "link_1", acm, true));
 }
 
+TEST(TesseractCoreUnit, isContactAllowedCompiledUnit)  // NOLINT
+{
+  using tesseract_collision::getAllowedCollisionIndex;
+  using tesseract_collision::isContactAllowed;
+  using tesseract_collision::updateCompiledAllowedCollisionMatrix;
+
+  tesseract_common::AllowedCollisionMatrix acm;
+  acm.addAllowedCollision("base_link", "link_1", "test");
+  tesseract_common::CompiledIsContactAllowedFn fn(
+      std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>(acm));
+
+  // Without a compiled allowed collision matrix the contact allowed function is called
+  tesseract_collision::ContactTestData cdata;
+  cdata.fn = [](const std::string& s1, const std::string& s2) { return (s1 == "link_2" || s2 == "link_2"); };
+  EXPECT_FALSE(updateCompiledAllowedCollisionMatrix(cdata));
+  EXPECT_EQ(getAllowedCollisionIndex(cdata, "base_link"), -1);
+  EXPECT_TRUE(isContactAllowed("base_link", -1, "link_2", -1, cdata));
+  EXPECT_FALSE(isContactAllowed("base_link", -1, "link_1", -1, cdata));
+
+  // With a compiled allowed collision matrix the indices are used
+  cdata.fn = fn;
+  EXPECT_TRUE(updateCompiledAllowedCollisionMatrix(cdata));
+  EXPECT_FALSE(updateCompiledAllowedCollisionMatrix(cdata));
+  EXPECT_EQ(cdata.acm, fn.get());
+  long base_index = getAllowedCollisionIndex(cdata, "base_link");
+  long link1_index = getAllowedCollisionIndex(cdata, "link_1");
+  EXPECT_GE(base_index, 0);
+  EXPECT_GE(link1_index, 0);
+  EXPECT_EQ(getAllowedCollisionIndex(cdata, "link_2"), -1);
+  EXPECT_TRUE(isContactAllowed("base_link", base_index, "link_1", link1_index, cdata));
+  EXPECT_TRUE(isContactAllowed("link_1", link1_index, "base_link", base_index, cdata, true));
+  EXPECT_TRUE(isContactAllowed("link_2", -1, "link_2", -1, cdata));
+  EXPECT_FALSE(isContactAllowed("base_link", base_index, "link_2", -1, cdata));
+
+  // Publishing a new matrix is detected on the next update
+  acm.removeAllowedCollision("base_link", "link_1");
+  fn.publish(std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>(acm));
+  EXPECT_TRUE(updateCompiledAllowedCollisionMatrix(cdata));
+  EXPECT_EQ(cdata.acm, fn.get());
+  EXPECT_EQ(getAllowedCollisionIndex(cdata, "base_link"), -1);
+
+  // Replacing the function with one which is not compiled clears the matrix
+  cdata.fn = nullptr;
+  EXPECT_TRUE(updateCompiledAllowedCollisionMatrix(cdata));
+  EXPECT_TRUE(cdata.acm == nullptr);
+}
+
+TEST(TesseractCoreUnit, CollisionObjectIdMapUnit)  // NOLINT
+{
+  int acm_calls{ 0 };
+  auto acm = [&acm_calls](const std::string& s1, const std::string& s2) {
+    ++acm_calls;
+    return (tesseract_common::makeOrderedLinkPair("base_link", "link_1") ==
+            tesseract_common::makeOrderedLinkPair(s1, s2));
+  };
+
+  tesseract_collision::CollisionObjectIdMap ids;
+  EXPECT_TRUE(ids.empty());
+  EXPECT_EQ(ids.add("base_link"), 0);
+  EXPECT_EQ(ids.add("link_1"), 1);
+  EXPECT_EQ(ids.add("link_2"), 2);
+  EXPECT_EQ(ids.add("link_1"), 1);
+  EXPECT_EQ(ids.size(), 3);
+  EXPECT_FALSE(ids.empty());
+  EXPECT_TRUE(ids.has("link_2"));
+  EXPECT_FALSE(ids.has("link_3"));
+  EXPECT_EQ(ids.getId("link_2"), 2);
+  EXPECT_EQ(ids.getName(1), "link_1");
+  EXPECT_EQ(ids.getNames(), std::vector<std::string>({ "base_link", "link_1", "link_2" }));
+  EXPECT_ANY_THROW(ids.getId("link_3"));  // NOLINT
+  EXPECT_ANY_THROW(ids.getName(3));       // NOLINT
+
+  // Contact allowed state is cached and symmetric
+  EXPECT_TRUE(ids.isContactAllowed(0, 0, acm));
+  EXPECT_EQ(acm_calls, 0);
+  EXPECT_TRUE(ids.isContactAllowed(0, 1, acm));
+  EXPECT_TRUE(ids.isContactAllowed(1, 0, acm));
+  EXPECT_FALSE(ids.isContactAllowed(0, 2, acm));
+  EXPECT_FALSE(ids.isContactAllowed(2, 0, acm));
+  EXPECT_EQ(acm_calls, 2);
+  EXPECT_FALSE(ids.isContactAllowed(0, 1, nullptr));
+  EXPECT_ANY_THROW(ids.isContactAllowed(0, 3, acm));  // NOLINT
+
+  ids.clearContactAllowedCache();
+  EXPECT_TRUE(ids.isContactAllowed(1, 0, acm));
+  EXPECT_EQ(acm_calls, 3);
+
+  // Clearing a single id only recomputes the pairs including it
+  EXPECT_FALSE(ids.isContactAllowed(0, 2, acm));
+  EXPECT_EQ(acm_calls, 4);
+  ids.clearContactAllowedCache(2);
+  EXPECT_TRUE(ids.isContactAllowed(0, 1, acm));
+  EXPECT_EQ(acm_calls, 4);
+  EXPECT_FALSE(ids.isContactAllowed(2, 0, acm));
+  EXPECT_EQ(acm_calls, 5);
+  EXPECT_ANY_THROW(ids.clearContactAllowedCache(3));  // NOLINT
+
+  ids.clear();
+  EXPECT_TRUE(ids.empty());
+  EXPECT_FALSE(ids.has("base_link"));
+}
+
 TEST(TesseractCoreUnit, scaleVerticesUnit)  // NOLINT
 {
   tesseract_common::VectorVector3d base_vertices{};
@@ -694,6 +797,135 @@ TEST(TesseractCoreUnit, ContactResultMapUnit)  // NOLINT
   }
 }
 
+TEST(TesseractCoreUnit, FlatContactResultMapUnit)  // NOLINT
+{
+  tesseract_collision::FlatContactResultMap flat_results;
+  EXPECT_TRUE(flat_results.empty());
+  EXPECT_EQ(flat_results.size(), 0);
+  EXPECT_TRUE(flat_results.begin() == flat_results.end());
+
+  std::size_t link1_id = flat_results.getLinkId("link1");
+  std::size_t link2_id = flat_results.getLinkId("link2");
+  EXPECT_EQ(link1_id, 0);
+  EXPECT_EQ(link2_id, 1);
+  EXPECT_EQ(flat_results.getLinkId("link1"), link1_id);
+  EXPECT_EQ(flat_results.getLinkName(link2_id), "link2");
+  EXPECT_ANY_THROW(flat_results.getLinkName(2));  // NOLINT
+
+  tesseract_collision::ContactResult result;
+  result.distance = -0.1;
+  result.link_names = { "link1", "link2" };
+  flat_results.addContactResult(link1_id, link2_id, result);
+
+  result.distance = 0.2;
+  result.link_names = { "link3", "link2" };
+  flat_results.addContactResult(result);
+
+  EXPECT_FALSE(flat_results.empty());
+  EXPECT_EQ(flat_results.size(), 2);
+  EXPECT_EQ(std::distance(flat_results.begin(), flat_results.end()), 2);
+  EXPECT_EQ(flat_results.getLinkNames(), std::vector<std::string>({ "link1", "link2", "link3" }));
+  EXPECT_NEAR(flat_results.getContactResult(0).distance, -0.1, 1e-8);
+  EXPECT_NEAR(flat_results.getContactResult(1).distance, 0.2, 1e-8);
+  EXPECT_EQ(flat_results.getContactResult(1).link_names[0], "link3");
+  EXPECT_EQ(flat_results.getLinkIds(1)[0], 2);
+  EXPECT_EQ(flat_results.getLinkIds(1)[1], link2_id);
+
+  // Find and replace the result of a link pair in either order
+  const std::size_t link3_id = flat_results.getLinkId("link3");
+  ASSERT_TRUE(flat_results.findContactResult(link2_id, link3_id) != nullptr);
+  EXPECT_NEAR(flat_results.findContactResult(link2_id, link3_id)->distance, 0.2, 1e-8);
+  EXPECT_TRUE(flat_results.findContactResult(link1_id, link3_id) == nullptr);
+  ASSERT_TRUE(flat_results.findContactResult("link2", "link3") != nullptr);
+  EXPECT_NEAR(flat_results.findContactResult("link3", "link2")->distance, 0.2, 1e-8);
+  EXPECT_TRUE(flat_results.findContactResult("link1", "link3") == nullptr);
+  EXPECT_TRUE(flat_results.findContactResult("link1", "link4") == nullptr);
+  EXPECT_EQ(flat_results.getLinkNames().size(), 3);
+
+  result.distance = 0.3;
+  flat_results.setContactResult(link2_id, link3_id, result);
+  EXPECT_EQ(flat_results.size(), 2);
+  EXPECT_NEAR(flat_results.getContactResult(1).distance, 0.3, 1e-8);
+  EXPECT_EQ(flat_results.getLinkIds(1)[0], link2_id);
+  EXPECT_EQ(flat_results.getLinkIds(1)[1], link3_id);
+
+  result.distance = 0.2;
+  flat_results.setContactResult(link3_id, link2_id, result);
+  EXPECT_EQ(flat_results.size(), 2);
+  EXPECT_NEAR(flat_results.getContactResult(1).distance, 0.2, 1e-8);
+
+  // Convert to the standard container
+  tesseract_collision::ContactResultMap result_map;
+  flat_results.toContactResultMap(result_map);
+  EXPECT_EQ(result_map.count(), 2);
+  EXPECT_EQ(result_map.size(), 2);
+  const auto& results = result_map.at(tesseract_common::makeOrderedLinkPair("link2", "link3"));
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(results[0].link_names[0], "link3");
+  EXPECT_EQ(results[0].link_names[1], "link2");
+  EXPECT_NEAR(results[0].distance, 0.2, 1e-8);
+
+  // Clear keeps the interned link names
+  flat_results.clear();
+  EXPECT_TRUE(flat_results.empty());
+  EXPECT_TRUE(flat_results.begin() == flat_results.end());
+  EXPECT_EQ(flat_results.getLinkNames().size(), 3);
+  EXPECT_TRUE(flat_results.findContactResult(link2_id, link3_id) == nullptr);
+
+  // Convert from the standard container
+  flat_results.addContactResults(result_map);
+  EXPECT_EQ(flat_results.size(), 2);
+  EXPECT_EQ(flat_results.getLinkNames().size(), 3);
+  tesseract_collision::ContactResultMap round_trip_map;
+  flat_results.toContactResultMap(round_trip_map);
+  EXPECT_TRUE(round_trip_map == result_map);
+
+  // The pair index grows with the number of link pairs
+  std::vector<std::size_t> link_ids;
+  for (int i = 0; i < 40; ++i)
+    link_ids.push_back(flat_results.getLinkId("many_link" + std::to_string(i)));
+
+  for (std::size_t i = 0; i < link_ids.size(); ++i)
+  {
+    for (std::size_t j = i + 1; j < link_ids.size(); j += 2)
+    {
+      result.distance = static_cast<double>((i * link_ids.size()) + j);
+      flat_results.addContactResult(link_ids[i], link_ids[j], result);
+    }
+  }
+
+  for (std::size_t i = 0; i < link_ids.size(); ++i)
+  {
+    for (std::size_t j = i + 1; j < link_ids.size(); ++j)
+    {
+      const tesseract_collision::ContactResult* found = flat_results.findContactResult(link_ids[j], link_ids[i]);
+      if ((j - i) % 2 == 1)
+      {
+        ASSERT_TRUE(found != nullptr);
+        EXPECT_NEAR(found->distance, static_cast<double>((i * link_ids.size()) + j), 1e-8);
+      }
+      else
+      {
+        EXPECT_TRUE(found == nullptr);
+      }
+    }
+  }
+
+  // The stored results are visible to the contact test data
+  std::vector<std::string> active{ "link1", "link2", "link3" };
+  tesseract_collision::ContactTestData cdata(active,
+                                             tesseract_common::CollisionMarginData(0.5),
+                                             nullptr,
+                                             tesseract_collision::ContactRequest(),
+                                             flat_results);
+  EXPECT_TRUE(tesseract_collision::hasContactResult(cdata, tesseract_common::makeOrderedLinkPair("link2", "link3")));
+  EXPECT_FALSE(tesseract_collision::hasContactResult(cdata, tesseract_common::makeOrderedLinkPair("link1", "link3")));
+
+  flat_results.release();
+  EXPECT_TRUE(flat_results.empty());
+  EXPECT_TRUE(flat_results.getLinkNames().empty());
+}
+
 TEST(TesseractCoreUnit, CollisionCheckConfigUnit)  // NOLINT
 {
   tesseract_collision::ContactRequest request;
@@ -46,6 +46,42 @@ TEST(TesseractCollisionMultiThreadedUnit, FCLDiscreteBVHCollisionMultiThreadedUn
   test_suite::runTest(checker);
 }
 
+TEST(TesseractCollisionMultiThreadedUnit, BulletDiscreteSimpleCollisionQueryContextConvexHullUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runQueryContextTest(checker, true);
+}
+
+TEST(TesseractCollisionMultiThreadedUnit, BulletDiscreteSimpleCollisionQueryContextUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runQueryContextTest(checker);
+}
+
+TEST(TesseractCollisionMultiThreadedUnit, BulletDiscreteBVHCollisionQueryContextConvexHullUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runQueryContextTest(checker, true);
+}
+
+TEST(TesseractCollisionMultiThreadedUnit, BulletDiscreteBVHCollisionQueryContextUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runQueryContextTest(checker);
+}
+
+TEST(TesseractCollisionMultiThreadedUnit, FCLDiscreteBVHCollisionQueryContextConvexHullUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  test_suite::runQueryContextTest(checker, true);
+}
+
+TEST(TesseractCollisionMultiThreadedUnit, FCLDiscreteBVHCollisionQueryContextUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  test_suite::runQueryContextTest(checker);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
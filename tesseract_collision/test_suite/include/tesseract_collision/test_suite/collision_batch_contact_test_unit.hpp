@@ -0,0 +1,135 @@
+#ifndef TESSERACT_COLLISION_COLLISION_BATCH_CONTACT_TEST_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_BATCH_CONTACT_TEST_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision::test_suite
+{
+namespace detail
+{
+inline void addCollisionObjects(DiscreteContactManager& checker)
+{
+  ////////////////////////
+  // Add static box to checker
+  ////////////////////////
+  CollisionShapePtr box = std::make_shared<tesseract_geometry::Box>(1, 1, 1);
+  Eigen::Isometry3d box_pose;
+  box_pose.setIdentity();
+
+  CollisionShapesConst obj1_shapes;
+  tesseract_common::VectorIsometry3d obj1_poses;
+  obj1_shapes.push_back(box);
+  obj1_poses.push_back(box_pose);
+
+  checker.addCollisionObject("box_link", 0, obj1_shapes, obj1_poses);
+
+  ////////////////////////
+  // Add spheres to checker
+  ////////////////////////
+  CollisionShapePtr sphere = std::make_shared<tesseract_geometry::Sphere>(0.25);
+  Eigen::Isometry3d sphere_pose;
+  sphere_pose.setIdentity();
+
+  CollisionShapesConst obj2_shapes;
+  tesseract_common::VectorIsometry3d obj2_poses;
+  obj2_shapes.push_back(sphere);
+  obj2_poses.push_back(sphere_pose);
+
+  checker.addCollisionObject("sphere_link", 0, obj2_shapes, obj2_poses);
+  checker.addCollisionObject("sphere1_link", 0, obj2_shapes, obj2_poses);
+}
+
+inline tesseract_common::VectorIsometry3d getBatchTransforms(std::size_t num_states)
+{
+  // Active order is sphere_link, no_geometry_link, sphere1_link
+  tesseract_common::VectorIsometry3d transforms;
+  transforms.reserve(num_states * 3);
+  for (std::size_t i = 0; i < num_states; ++i)
+  {
+    const double t = static_cast<double>(i) / static_cast<double>(num_states - 1);
+
+    Eigen::Isometry3d sphere_pose{ Eigen::Isometry3d::Identity() };
+    sphere_pose.translation() = Eigen::Vector3d(-1.5 + (3.0 * t), 0, 0);
+
+    Eigen::Isometry3d sphere1_pose{ Eigen::Isometry3d::Identity() };
+    sphere1_pose.translation() = Eigen::Vector3d(0, 1.5 - (1.5 * t), 0);
+
+    transforms.push_back(sphere_pose);
+    transforms.push_back(Eigen::Isometry3d::Identity());
+    transforms.push_back(sphere1_pose);
+  }
+  return transforms;
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker)
+{
+  // Add collision objects
+  detail::addCollisionObjects(checker);
+
+  std::vector<std::string> active_links{ "sphere_link", "no_geometry_link", "sphere1_link" };
+  checker.setActiveCollisionObjects(active_links);
+  checker.setDefaultCollisionMarginData(0.1);
+  EXPECT_NEAR(checker.getCollisionMarginData().getMaxCollisionMargin(), 0.1, 1e-5);
+
+  const std::size_t num_states = 11;
+  const tesseract_common::VectorIsometry3d transforms = detail::getBatchTransforms(num_states);
+
+  // Compute the expected results one state at a time using a clone
+  DiscreteContactManager::UPtr serial_checker = checker.clone();
+  std::vector<ContactResultMap> expected(num_states);
+  for (std::size_t i = 0; i < num_states; ++i)
+  {
+    for (std::size_t j = 0; j < active_links.size(); ++j)
+      serial_checker->setCollisionObjectsTransform(active_links[j], transforms[(i * active_links.size()) + j]);
+
+    serial_checker->contactTest(expected[i], ContactRequest(ContactTestType::ALL));
+  }
+
+  // Perform the batched contact test
+  std::vector<ContactResultMap> results;
+  checker.contactTest(results, transforms, ContactRequest(ContactTestType::ALL));
+  ASSERT_EQ(results.size(), num_states);
+
+  bool found = false;
+  for (std::size_t i = 0; i < num_states; ++i)
+  {
+    EXPECT_EQ(results[i].size(), expected[i].size());
+    EXPECT_EQ(results[i].count(), expected[i].count());
+    for (const auto& pair : expected[i])
+    {
+      auto it = results[i].find(pair.first);
+      ASSERT_TRUE(it != results[i].end());
+      ASSERT_EQ(it->second.size(), pair.second.size());
+      for (std::size_t k = 0; k < pair.second.size(); ++k)
+        EXPECT_NEAR(it->second[k].distance, pair.second[k].distance, 1e-5);
+
+      found = true;
+    }
+  }
+  EXPECT_TRUE(found);
+
+  // The manager should be left at the last state
+  const Eigen::Isometry3d& last_sphere_pose = transforms[((num_states - 1) * active_links.size())];
+  ContactResultMap last_result;
+  checker.setCollisionObjectsTransform("sphere_link", last_sphere_pose);
+  checker.contactTest(last_result, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(last_result.count(), expected.back().count());
+
+  // Results are appended to the provided maps
+  checker.contactTest(results, transforms, ContactRequest(ContactTestType::ALL));
+  for (std::size_t i = 0; i < num_states; ++i)
+    EXPECT_EQ(results[i].count(), 2 * expected[i].count());
+
+  // Transforms size must be a multiple of the number of active objects
+  tesseract_common::VectorIsometry3d bad_transforms(transforms.begin(), transforms.end() - 1);
+  EXPECT_ANY_THROW(checker.contactTest(results, bad_transforms, ContactRequest(ContactTestType::ALL)));  // NOLINT
+
+  // Must have at least one active object
+  checker.setActiveCollisionObjects({});
+  EXPECT_ANY_THROW(checker.contactTest(results, transforms, ContactRequest(ContactTestType::ALL)));  // NOLINT
+}
+}  // namespace tesseract_collision::test_suite
+#endif  // TESSERACT_COLLISION_COLLISION_BATCH_CONTACT_TEST_UNIT_HPP
@@ -167,6 +167,14 @@ runTest(DiscreteContactManager& checker, double dist_tol = 0.001, double nearest
     cloned_idx = { 1, 0, -1 };
 
   EXPECT_FALSE(cloned_checker->isCollisionObjectEnabled("thin_box_link"));
+
+  // The clone should share the collision geometry instead of copying it
+  for (const auto& co : checker.getCollisionObjects())
+  {
+    EXPECT_EQ(&checker.getCollisionObjectGeometries(co), &cloned_checker->getCollisionObjectGeometries(co));
+    EXPECT_EQ(&checker.getCollisionObjectGeometriesTransforms(co),
+              &cloned_checker->getCollisionObjectGeometriesTransforms(co));
+  }
   EXPECT_TRUE(!result_vector.empty() && !cloned_result_vector.empty());
   EXPECT_NEAR(result_vector[0].distance, cloned_result_vector[0].distance, dist_tol);
   EXPECT_NEAR(result_vector[0].nearest_points[static_cast<size_t>(idx[0])][0],
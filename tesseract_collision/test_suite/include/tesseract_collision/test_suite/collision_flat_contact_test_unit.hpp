@@ -0,0 +1,109 @@
+#ifndef TESSERACT_COLLISION_COLLISION_FLAT_CONTACT_TEST_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_FLAT_CONTACT_TEST_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision::test_suite
+{
+namespace detail
+{
+inline void addCollisionObjects(DiscreteContactManager& checker)
+{
+  ////////////////////////
+  // Add static box to checker
+  ////////////////////////
+  CollisionShapePtr box = std::make_shared<tesseract_geometry::Box>(1, 1, 1);
+  Eigen::Isometry3d box_pose;
+  box_pose.setIdentity();
+
+  CollisionShapesConst obj1_shapes;
+  tesseract_common::VectorIsometry3d obj1_poses;
+  obj1_shapes.push_back(box);
+  obj1_poses.push_back(box_pose);
+
+  checker.addCollisionObject("box_link", 0, obj1_shapes, obj1_poses);
+
+  ////////////////////////
+  // Add spheres to checker
+  ////////////////////////
+  CollisionShapePtr sphere = std::make_shared<tesseract_geometry::Sphere>(0.25);
+  Eigen::Isometry3d sphere_pose;
+  sphere_pose.setIdentity();
+
+  CollisionShapesConst obj2_shapes;
+  tesseract_common::VectorIsometry3d obj2_poses;
+  obj2_shapes.push_back(sphere);
+  obj2_poses.push_back(sphere_pose);
+
+  checker.addCollisionObject("sphere_link", 0, obj2_shapes, obj2_poses);
+  checker.addCollisionObject("sphere1_link", 0, obj2_shapes, obj2_poses);
+}
+
+inline void runContactTest(DiscreteContactManager& checker, const ContactRequest& request)
+{
+  ContactResultMap expected;
+  checker.contactTest(expected, request);
+
+  FlatContactResultMap flat_results;
+  checker.contactTest(flat_results, request);
+  EXPECT_EQ(flat_results.size(), static_cast<std::size_t>(expected.count()));
+
+  ContactResultMap results;
+  flat_results.toContactResultMap(results);
+  EXPECT_EQ(results.size(), expected.size());
+  EXPECT_EQ(results.count(), expected.count());
+  for (const auto& pair : expected)
+  {
+    auto it = results.find(pair.first);
+    ASSERT_TRUE(it != results.end());
+    ASSERT_EQ(it->second.size(), pair.second.size());
+    for (std::size_t k = 0; k < pair.second.size(); ++k)
+    {
+      EXPECT_NEAR(it->second[k].distance, pair.second[k].distance, 1e-5);
+      EXPECT_EQ(it->second[k].link_names, pair.second[k].link_names);
+    }
+  }
+
+  // The stored results are reused after a clear
+  flat_results.clear();
+  checker.contactTest(flat_results, request);
+  EXPECT_EQ(flat_results.size(), static_cast<std::size_t>(expected.count()));
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker)
+{
+  // Add collision objects
+  detail::addCollisionObjects(checker);
+
+  checker.setActiveCollisionObjects({ "sphere_link", "sphere1_link" });
+  checker.setDefaultCollisionMarginData(0.1);
+
+  // Both spheres are in contact with the box and each other
+  Eigen::Isometry3d sphere_pose{ Eigen::Isometry3d::Identity() };
+  sphere_pose.translation() = Eigen::Vector3d(0.7, 0, 0);
+  Eigen::Isometry3d sphere1_pose{ Eigen::Isometry3d::Identity() };
+  sphere1_pose.translation() = Eigen::Vector3d(0.7, 0.3, 0);
+  checker.setCollisionObjectsTransform("sphere_link", sphere_pose);
+  checker.setCollisionObjectsTransform("sphere1_link", sphere1_pose);
+
+  detail::runContactTest(checker, ContactRequest(ContactTestType::ALL));
+  detail::runContactTest(checker, ContactRequest(ContactTestType::CLOSEST));
+
+  FlatContactResultMap flat_results;
+  checker.contactTest(flat_results, ContactRequest(ContactTestType::FIRST));
+  EXPECT_EQ(flat_results.size(), 1);
+
+  // Out of contact
+  sphere_pose.translation() = Eigen::Vector3d(0, -2, 0);
+  sphere1_pose.translation() = Eigen::Vector3d(0, 2, 0);
+  checker.setCollisionObjectsTransform("sphere_link", sphere_pose);
+  checker.setCollisionObjectsTransform("sphere1_link", sphere1_pose);
+  flat_results.clear();
+  checker.contactTest(flat_results, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(flat_results.empty());
+}
+}  // namespace tesseract_collision::test_suite
+#endif  // TESSERACT_COLLISION_COLLISION_FLAT_CONTACT_TEST_UNIT_HPP
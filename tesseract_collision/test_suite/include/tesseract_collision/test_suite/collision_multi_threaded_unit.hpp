@@ -15,7 +15,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_collision::test_suite
 {
-inline void runTest(DiscreteContactManager& checker, bool use_convex_mesh = false)
+namespace detail
+{
+inline tesseract_common::TransformMap addCollisionObjects(DiscreteContactManager& checker, bool use_convex_mesh)
 {
   // Add Meshed Sphere to checker
   CollisionShapePtr sphere;
@@ -79,6 +81,29 @@ inline void runTest(DiscreteContactManager& checker, bool use_convex_mesh = fals
   EXPECT_NEAR(checker.getCollisionMarginData().getMaxCollisionMargin(), 0.1, 1e-5);
   checker.setCollisionObjectsTransform(location);
 
+  return location;
+}
+
+inline Eigen::Isometry3d getThreadPose(const Eigen::Isometry3d& pose, int tn)
+{
+  Eigen::Isometry3d thread_pose = pose;
+  if (tn == 0)
+    thread_pose.translation()[0] += 0.1;
+  else if (tn == 1)
+    thread_pose.translation()[1] += 0.1;
+  else if (tn == 2)
+    thread_pose.translation()[2] += 0.1;
+  else
+    thread_pose.translation()[0] -= 0.1;
+
+  return thread_pose;
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker, bool use_convex_mesh = false)
+{
+  tesseract_common::TransformMap location = detail::addCollisionObjects(checker, use_convex_mesh);
+
   long num_threads = 4;
   std::vector<ContactResultVector> result_vector(static_cast<std::size_t>(num_threads));
   std::vector<DiscreteContactManager::Ptr> contact_manager(static_cast<std::size_t>(num_threads));
@@ -140,6 +165,72 @@ inline void runTest(DiscreteContactManager& checker, bool use_convex_mesh = fals
     EXPECT_TRUE(result_vector[static_cast<std::size_t>(i)].size() == 2700);
   }
 }
+
+inline void runQueryContextTest(DiscreteContactManager& checker, bool use_convex_mesh = false)
+{
+  tesseract_common::TransformMap location = detail::addCollisionObjects(checker, use_convex_mesh);
+
+  long num_threads = 4;
+  std::vector<ContactResultVector> result_vector(static_cast<std::size_t>(num_threads));
+  std::vector<DiscreteContactQueryContext::Ptr> contexts(static_cast<std::size_t>(num_threads));
+  for (auto& context : contexts)
+  {
+    context = checker.createQueryContext();
+    EXPECT_TRUE(context->getIsContactAllowedFn() == nullptr);
+    EXPECT_NEAR(context->getCollisionMarginData().getMaxCollisionMargin(), 0.1, 1e-5);
+  }
+
+  auto start_time = std::chrono::high_resolution_clock::now();
+
+#pragma omp parallel for num_threads(num_threads) shared(location)
+  for (long i = 0; i < num_threads; ++i)  // NOLINT
+  {
+    const int tn = omp_get_thread_num();
+    CONSOLE_BRIDGE_logDebug("Thread (ID: %i): %i of %i", tn, i, num_threads);
+    const DiscreteContactQueryContext::Ptr& context = contexts[static_cast<size_t>(tn)];
+    for (const auto& co : location)
+    {
+      if (tn % 2 == 0)
+      {
+        context->setCollisionObjectsTransform(co.first, detail::getThreadPose(co.second, tn));
+      }
+      else
+      {
+        std::vector<std::string> names = { co.first };
+        tesseract_common::VectorIsometry3d transforms = { detail::getThreadPose(co.second, tn) };
+        context->setCollisionObjectsTransform(names, transforms);
+      }
+    }
+
+    ContactResultMap result;
+    context->contactTest(result, ContactRequest(ContactTestType::ALL));
+    result.flattenMoveResults(result_vector[static_cast<size_t>(tn)]);
+  }
+  auto end_time = std::chrono::high_resolution_clock::now();
+
+  CONSOLE_BRIDGE_logInform("DT: %f ms", std::chrono::duration<double, std::milli>(end_time - start_time).count());
+
+  for (long i = 0; i < num_threads; ++i)
+  {
+    EXPECT_TRUE(result_vector[static_cast<std::size_t>(i)].size() == 2700);
+  }
+
+  // The margin of a context is independent of the contact manager
+  contexts[0]->setCollisionMarginData(CollisionMarginData(0.0));
+  EXPECT_NEAR(contexts[0]->getCollisionMarginData().getMaxCollisionMargin(), 0.0, 1e-5);
+  EXPECT_NEAR(checker.getCollisionMarginData().getMaxCollisionMargin(), 0.1, 1e-5);
+
+  ContactResultMap context_result;
+  contexts[0]->contactTest(context_result, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(context_result.empty());
+
+  // The contexts must not modify the transforms of the contact manager
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  ContactResultVector result_vector_checker;
+  result.flattenMoveResults(result_vector_checker);
+  EXPECT_TRUE(result_vector_checker.size() == 2700);
+}
 }  // namespace tesseract_collision::test_suite
 
 #endif  // TESSERACT_COLLISION_COLLISION_MULTI_THREADED_UNIT_HPP
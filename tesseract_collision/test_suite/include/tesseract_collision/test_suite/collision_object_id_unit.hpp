@@ -0,0 +1,167 @@
+#ifndef TESSERACT_COLLISION_COLLISION_OBJECT_ID_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_OBJECT_ID_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision::test_suite
+{
+namespace detail
+{
+inline void addCollisionObjects(DiscreteContactManager& checker)
+{
+  ////////////////////////
+  // Add static box to checker
+  ////////////////////////
+  CollisionShapePtr box = std::make_shared<tesseract_geometry::Box>(1, 1, 1);
+  Eigen::Isometry3d box_pose;
+  box_pose.setIdentity();
+
+  CollisionShapesConst obj1_shapes;
+  tesseract_common::VectorIsometry3d obj1_poses;
+  obj1_shapes.push_back(box);
+  obj1_poses.push_back(box_pose);
+
+  checker.addCollisionObject("box_link", 0, obj1_shapes, obj1_poses);
+
+  ////////////////////////
+  // Add spheres to checker
+  ////////////////////////
+  CollisionShapePtr sphere = std::make_shared<tesseract_geometry::Sphere>(0.25);
+  Eigen::Isometry3d sphere_pose;
+  sphere_pose.setIdentity();
+
+  CollisionShapesConst obj2_shapes;
+  tesseract_common::VectorIsometry3d obj2_poses;
+  obj2_shapes.push_back(sphere);
+  obj2_poses.push_back(sphere_pose);
+
+  checker.addCollisionObject("sphere_link", 0, obj2_shapes, obj2_poses);
+  checker.addCollisionObject("sphere1_link", 0, obj2_shapes, obj2_poses);
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker)
+{
+  // Add collision objects
+  detail::addCollisionObjects(checker);
+
+  checker.setActiveCollisionObjects({ "sphere_link", "sphere1_link" });
+  checker.setDefaultCollisionMarginData(0.1);
+
+  //////////////////////////////////////
+  // Register ids
+  //////////////////////////////////////
+  std::size_t box_id = checker.registerCollisionObjectId("box_link");
+  std::size_t sphere_id = checker.registerCollisionObjectId("sphere_link");
+  std::size_t sphere1_id = checker.registerCollisionObjectId("sphere1_link");
+  EXPECT_EQ(box_id, 0);
+  EXPECT_EQ(sphere_id, 1);
+  EXPECT_EQ(sphere1_id, 2);
+  EXPECT_EQ(checker.registerCollisionObjectId("sphere_link"), sphere_id);
+  EXPECT_EQ(checker.getCollisionObjectIdMap().size(), 3);
+  EXPECT_EQ(checker.getCollisionObjectIdMap().getName(sphere1_id), "sphere1_link");
+  EXPECT_ANY_THROW(checker.registerCollisionObjectId("link_does_not_exist"));  // NOLINT
+
+  //////////////////////////////////////
+  // Set transforms by id and compare against the full contact test
+  //////////////////////////////////////
+  Eigen::Isometry3d sphere_pose{ Eigen::Isometry3d::Identity() };
+  sphere_pose.translation() = Eigen::Vector3d(0.7, 0, 0);
+  Eigen::Isometry3d sphere1_pose{ Eigen::Isometry3d::Identity() };
+  sphere1_pose.translation() = Eigen::Vector3d(0, 2, 0);
+  checker.setCollisionObjectsTransform({ sphere_id, sphere1_id }, { sphere_pose, sphere1_pose });
+
+  ContactResultMap expected;
+  checker.contactTest(expected, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(expected.size(), 1);
+
+  ContactResultMap result;
+  checker.contactTest(result, box_id, sphere_id, ContactRequest(ContactTestType::ALL));
+  ASSERT_EQ(result.size(), 1);
+  auto expected_it = expected.find(tesseract_common::makeOrderedLinkPair("box_link", "sphere_link"));
+  auto result_it = result.find(tesseract_common::makeOrderedLinkPair("box_link", "sphere_link"));
+  ASSERT_TRUE(expected_it != expected.end());
+  ASSERT_TRUE(result_it != result.end());
+  ASSERT_EQ(result_it->second.size(), expected_it->second.size());
+  EXPECT_NEAR(result_it->second[0].distance, expected_it->second[0].distance, 1e-5);
+
+  // Pair out of contact
+  result.clear();
+  checker.contactTest(result, sphere_id, sphere1_id, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+
+  // Move the second sphere into contact by id
+  sphere1_pose.translation() = Eigen::Vector3d(0.7, 0.3, 0);
+  checker.setCollisionObjectsTransform(sphere1_id, sphere1_pose);
+  checker.contactTest(result, sphere_id, sphere1_id, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(result.size(), 1);
+
+  // Same object is never checked
+  result.clear();
+  checker.contactTest(result, sphere_id, sphere_id, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+
+  // Disabled objects are not checked
+  checker.disableCollisionObject("sphere1_link");
+  checker.contactTest(result, sphere_id, sphere1_id, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+  checker.enableCollisionObject("sphere1_link");
+
+  //////////////////////////////////////
+  // The contact allowed state is cached by id until the function is set
+  //////////////////////////////////////
+  checker.setIsContactAllowedFn([](const std::string& s1, const std::string& s2) {
+    return (tesseract_common::makeOrderedLinkPair("sphere_link", "sphere1_link") ==
+            tesseract_common::makeOrderedLinkPair(s1, s2));
+  });
+  checker.contactTest(result, sphere_id, sphere1_id, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+
+  checker.setIsContactAllowedFn(nullptr);
+  checker.contactTest(result, sphere_id, sphere1_id, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(result.size(), 1);
+
+  //////////////////////////////////////
+  // Clones keep the registered ids
+  //////////////////////////////////////
+  DiscreteContactManager::UPtr cloned_checker = checker.clone();
+  EXPECT_EQ(cloned_checker->getCollisionObjectIdMap().getNames(), checker.getCollisionObjectIdMap().getNames());
+  ContactResultMap cloned_result;
+  cloned_checker->contactTest(cloned_result, sphere_id, sphere1_id, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(cloned_result.size(), 1);
+
+  //////////////////////////////////////
+  // Removing a collision object only invalidates its own id
+  //////////////////////////////////////
+  checker.removeCollisionObject("box_link");
+  EXPECT_EQ(checker.getCollisionObjectIdMap().size(), 3);
+  EXPECT_ANY_THROW(checker.setCollisionObjectsTransform(box_id, sphere_pose));  // NOLINT
+  EXPECT_ANY_THROW(                                                             // NOLINT
+      checker.contactTest(result, box_id, sphere_id, ContactRequest(ContactTestType::ALL)));
+
+  result.clear();
+  checker.setCollisionObjectsTransform({ sphere_id, sphere1_id }, { sphere_pose, sphere1_pose });
+  checker.contactTest(result, sphere_id, sphere1_id, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(result.size(), 1);
+
+  cloned_checker = checker.clone();
+  EXPECT_EQ(cloned_checker->getCollisionObjectIdMap().getNames(), checker.getCollisionObjectIdMap().getNames());
+  EXPECT_ANY_THROW(  // NOLINT
+      cloned_checker->contactTest(cloned_result, box_id, sphere_id, ContactRequest(ContactTestType::ALL)));
+
+  //////////////////////////////////////
+  // Adding the collision object again reuses its id
+  //////////////////////////////////////
+  CollisionShapesConst box_shapes{ std::make_shared<tesseract_geometry::Box>(1, 1, 1) };
+  tesseract_common::VectorIsometry3d box_poses{ Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("box_link", 0, box_shapes, box_poses);
+  EXPECT_EQ(checker.registerCollisionObjectId("box_link"), box_id);
+
+  result.clear();
+  checker.contactTest(result, box_id, sphere_id, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(result.size(), 1);
+}
+}  // namespace tesseract_collision::test_suite
+#endif  // TESSERACT_COLLISION_COLLISION_OBJECT_ID_UNIT_HPP
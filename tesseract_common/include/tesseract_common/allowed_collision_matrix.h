@@ -8,6 +8,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 #include <Eigen/Core>
 #include <unordered_map>
+#include <vector>
+#include <cstdint>
+#include <functional>
 #include <tesseract_common/types.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -109,6 +112,110 @@ private:
 };
 
 std::ostream& operator<<(std::ostream& os, const AllowedCollisionMatrix& acm);
+
+/**
+ * @brief A read-only snapshot of an AllowedCollisionMatrix optimized for queries
+ * @details Link names are mapped to dense indices and the allowed state of every pair is stored in a packed
+ * symmetric bitset, so a query by name is two hash lookups without allocation and a query by index is a bit test.
+ * The snapshot does not track changes to the source matrix and must be rebuilt when it changes.
+ */
+class CompiledAllowedCollisionMatrix
+{
+public:
+  using Ptr = std::shared_ptr<CompiledAllowedCollisionMatrix>;
+  using ConstPtr = std::shared_ptr<const CompiledAllowedCollisionMatrix>;
+
+  CompiledAllowedCollisionMatrix() = default;
+  explicit CompiledAllowedCollisionMatrix(const AllowedCollisionMatrix& acm);
+
+  /**
+   * @brief This checks if two links are allowed to be in collision
+   * @param link_name1 First link name
+   * @param link_name2 Second link name
+   * @return True if allowed to be in collision, otherwise false
+   */
+  bool isCollisionAllowed(const std::string& link_name1, const std::string& link_name2) const;
+
+  /**
+   * @brief This checks if two links are allowed to be in collision by index
+   * @param index1 The index of the first link, see getIndex
+   * @param index2 The index of the second link, see getIndex
+   * @return True if allowed to be in collision, otherwise false
+   */
+  bool isCollisionAllowed(std::size_t index1, std::size_t index2) const;
+
+  /**
+   * @brief Get the index of a link
+   * @param link_name The link name
+   * @return The index of the link, or -1 if the link does not have any allowed collisions
+   */
+  long getIndex(const std::string& link_name) const;
+
+  /**
+   * @brief Get the link names where the index is the link index
+   * @return The link names with at least one allowed collision
+   */
+  const std::vector<std::string>& getLinkNames() const;
+
+  /**
+   * @brief Get a contact allowed function which shares ownership of this snapshot
+   * @details The function stores a CompiledIsContactAllowedFn, so contact managers may query the snapshot by index.
+   * @param acm The compiled allowed collision matrix
+   * @return A function returning true if two links are allowed to be in collision
+   */
+  static std::function<bool(const std::string&, const std::string&)> makeIsContactAllowedFn(ConstPtr acm);
+
+private:
+  /** @brief The link names where the index is the link index */
+  std::vector<std::string> link_names_;
+
+  /** @brief A map of link name to index */
+  std::unordered_map<std::string, std::size_t> link_indices_;
+
+  /** @brief The packed upper triangle, including the diagonal, of the symmetric allowed collision matrix */
+  std::vector<std::uint64_t> bits_;
+
+  /** @brief Get the bit index of a pair of link indices */
+  std::size_t getBitIndex(std::size_t index1, std::size_t index2) const;
+};
+
+/**
+ * @brief A contact allowed function which queries the latest published compiled allowed collision matrix
+ * @details Copies share the published matrix, so a matrix published through one copy is used by every copy. This
+ * allows the owner of the allowed collision matrix to update contact managers which were cloned earlier. Contact
+ * managers which find this function in their IsContactAllowedFn query the matrix by index instead of calling it.
+ */
+class CompiledIsContactAllowedFn
+{
+public:
+  /** @brief Create a function publishing an empty compiled allowed collision matrix */
+  CompiledIsContactAllowedFn();
+  explicit CompiledIsContactAllowedFn(CompiledAllowedCollisionMatrix::ConstPtr acm);
+
+  /**
+   * @brief Check if two links are allowed to be in collision using the latest published matrix
+   * @param link_name1 First link name
+   * @param link_name2 Second link name
+   * @return True if allowed to be in collision, otherwise false
+   */
+  bool operator()(const std::string& link_name1, const std::string& link_name2) const;
+
+  /**
+   * @brief Get the latest published matrix, this is thread safe
+   * @return The compiled allowed collision matrix
+   */
+  CompiledAllowedCollisionMatrix::ConstPtr get() const;
+
+  /**
+   * @brief Publish a matrix to every copy of this function, this is thread safe
+   * @param acm The compiled allowed collision matrix
+   */
+  void publish(CompiledAllowedCollisionMatrix::ConstPtr acm);
+
+private:
+  /** @brief The published matrix shared between copies, it must only be accessed atomically */
+  std::shared_ptr<CompiledAllowedCollisionMatrix::ConstPtr> acm_;
+};
 }  // namespace tesseract_common
 
 BOOST_CLASS_EXPORT_KEY(tesseract_common::AllowedCollisionMatrix)
@@ -33,6 +33,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 #include <algorithm>
 #include <mutex>
+#include <type_traits>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -43,9 +44,9 @@ namespace tesseract_common
 /** @brief Used to create a cache of objects
  *
  * CacheType needs the following methods
- * CacheType::Ptr clone() const;
+ * CacheType::Ptr clone() const;  // CacheType::UPtr is also supported
  * int getRevision() const;
- * bool update(Const CacheType::ConstPtr&);  // optional
+ * bool update(Const CacheType::ConstPtr&);  // optional, if false is returned a new clone is created
  * */
 template <typename CacheType>
 class CloneCache
@@ -53,7 +54,6 @@ class CloneCache
 public:
   CREATE_MEMBER_FUNC_SIGNATURE_CHECK(update, bool, const std::shared_ptr<const CacheType>&)
   CREATE_MEMBER_FUNC_SIGNATURE_NOARGS_CHECK(getRevision, int)
-  CREATE_MEMBER_FUNC_SIGNATURE_NOARGS_CHECK(clone, std::shared_ptr<CacheType>)
 
   CloneCache(std::shared_ptr<CacheType> original, const long& cache_size = 5)
     : supports_update(has_member_func_signature_update<CacheType>::value)
@@ -64,7 +64,9 @@ public:
     // These methods are required
     static_assert(has_member_func_signature_getRevision<CacheType>::value,
                   "Class 'getRevision' function has incorrect signature");
-    static_assert(has_member_func_signature_clone<CacheType>::value, "Class 'clone' function has incorrect signature");
+    static_assert(std::is_convertible<std::invoke_result_t<decltype(&CacheType::clone), const CacheType&>,
+                                      std::shared_ptr<CacheType>>::value,
+                  "Class 'clone' function has incorrect signature");
 
     for (long i = 0; i < cache_size; i++)
       createClone();
@@ -96,11 +98,11 @@ public:
     {
       // Update if possible
       std::shared_ptr<CacheType> t;
+      bool updated{ false };
       if constexpr (has_member_func_signature_update<CacheType>::value)
-      {
-        cache_.back()->update(original_);
-      }
-      else
+        updated = cache_.back()->update(original_);
+
+      if (!updated)
       {
         std::shared_ptr<CacheType> cache = getClone();
         if (cache == nullptr)
@@ -163,14 +165,13 @@ public:
       if (cache->getRevision() != original_->getRevision())
       {
         // Update if possible
+        bool updated{ false };
         if constexpr (has_member_func_signature_update<CacheType>::value)
-        {
-          cache->update(original_);
-        }
-        else
-        {  // Update is not available to assign new clone
+          updated = cache->update(original_);
+
+        // Update is not available or failed so assign new clone
+        if (!updated)
           cache = getClone();
-        }
       }
     }
 
@@ -46,6 +46,8 @@ struct ClassLoader;
 
 // allowed_collision_matrix
 class AllowedCollisionMatrix;
+class CompiledAllowedCollisionMatrix;
+class CompiledIsContactAllowedFn;
 
 // collision_margin_data.h
 enum class CollisionMarginOverrideType;
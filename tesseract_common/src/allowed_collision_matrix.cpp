@@ -32,6 +32,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/library_version_type.hpp>
 #endif
 #include <boost/serialization/unordered_map.hpp>
+#include <atomic>
+#include <cassert>
+#include <stdexcept>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/utils.h>
@@ -125,6 +128,106 @@ std::ostream& operator<<(std::ostream& os, const AllowedCollisionMatrix& acm)
     os << "link=" << pair.first.first << " link=" << pair.first.second << " reason=" << pair.second << std::endl;
   return os;
 }
+
+CompiledAllowedCollisionMatrix::CompiledAllowedCollisionMatrix(const AllowedCollisionMatrix& acm)
+{
+  const AllowedCollisionEntries& entries = acm.getAllAllowedCollisions();
+  link_indices_.reserve(2 * entries.size());
+  for (const auto& entry : entries)
+  {
+    for (const auto* link_name : { &entry.first.first, &entry.first.second })
+    {
+      if (link_indices_.emplace(*link_name, link_names_.size()).second)
+        link_names_.push_back(*link_name);
+    }
+  }
+
+  const std::size_t n = link_names_.size();
+  bits_.assign((((n * (n + 1)) / 2) + 63) / 64, 0);
+  for (const auto& entry : entries)
+  {
+    const std::size_t bit = getBitIndex(link_indices_[entry.first.first], link_indices_[entry.first.second]);
+    bits_[bit / 64] |= (std::uint64_t(1) << (bit % 64));
+  }
+}
+
+bool CompiledAllowedCollisionMatrix::isCollisionAllowed(const std::string& link_name1,
+                                                        const std::string& link_name2) const
+{
+  auto it1 = link_indices_.find(link_name1);
+  if (it1 == link_indices_.end())
+    return false;
+
+  auto it2 = link_indices_.find(link_name2);
+  if (it2 == link_indices_.end())
+    return false;
+
+  return isCollisionAllowed(it1->second, it2->second);
+}
+
+bool CompiledAllowedCollisionMatrix::isCollisionAllowed(std::size_t index1, std::size_t index2) const
+{
+  assert(index1 < link_names_.size() && index2 < link_names_.size());
+  const std::size_t bit = getBitIndex(index1, index2);
+  return ((bits_[bit / 64] >> (bit % 64)) & 1U) != 0;
+}
+
+long CompiledAllowedCollisionMatrix::getIndex(const std::string& link_name) const
+{
+  auto it = link_indices_.find(link_name);
+  if (it == link_indices_.end())
+    return -1;
+
+  return static_cast<long>(it->second);
+}
+
+const std::vector<std::string>& CompiledAllowedCollisionMatrix::getLinkNames() const { return link_names_; }
+
+std::function<bool(const std::string&, const std::string&)>
+CompiledAllowedCollisionMatrix::makeIsContactAllowedFn(ConstPtr acm)
+{
+  return CompiledIsContactAllowedFn(std::move(acm));
+}
+
+std::size_t CompiledAllowedCollisionMatrix::getBitIndex(std::size_t index1, std::size_t index2) const
+{
+  if (index1 > index2)
+    std::swap(index1, index2);
+
+  // Row major offset into the upper triangle including the diagonal
+  const std::size_t n = link_names_.size();
+  return (index1 * n) - ((index1 * (index1 - 1)) / 2) + (index2 - index1);
+}
+
+CompiledIsContactAllowedFn::CompiledIsContactAllowedFn()
+  : CompiledIsContactAllowedFn(std::make_shared<const CompiledAllowedCollisionMatrix>())
+{
+}
+
+CompiledIsContactAllowedFn::CompiledIsContactAllowedFn(CompiledAllowedCollisionMatrix::ConstPtr acm)
+  : acm_(std::make_shared<CompiledAllowedCollisionMatrix::ConstPtr>(std::move(acm)))
+{
+  if (*acm_ == nullptr)
+    throw std::runtime_error("CompiledIsContactAllowedFn, the compiled allowed collision matrix is a nullptr!");
+}
+
+bool CompiledIsContactAllowedFn::operator()(const std::string& link_name1, const std::string& link_name2) const
+{
+  return get()->isCollisionAllowed(link_name1, link_name2);
+}
+
+CompiledAllowedCollisionMatrix::ConstPtr CompiledIsContactAllowedFn::get() const
+{
+  return std::atomic_load(acm_.get());
+}
+
+void CompiledIsContactAllowedFn::publish(CompiledAllowedCollisionMatrix::ConstPtr acm)
+{
+  if (acm == nullptr)
+    throw std::runtime_error("CompiledIsContactAllowedFn, the compiled allowed collision matrix is a nullptr!");
+
+  std::atomic_store(acm_.get(), std::move(acm));
+}
 }  // namespace tesseract_common
 
 #include <tesseract_common/serialization.h>
@@ -83,6 +83,24 @@ public:
   }
 };
 
+class TestObjectSupportsUpdateRejected : public TestObject
+{
+public:
+  using Ptr = std::shared_ptr<TestObjectSupportsUpdateRejected>;
+  using ConstPtr = std::shared_ptr<const TestObjectSupportsUpdateRejected>;
+
+  bool update(const TestObjectSupportsUpdateRejected::ConstPtr& /*pattern*/) { return false; }
+
+  TestObjectSupportsUpdateRejected::Ptr clone() const
+  {
+    TestObjectSupportsUpdateRejected::Ptr clone = std::make_shared<TestObjectSupportsUpdateRejected>();
+    clone->val_1 = val_1;
+    clone->val_2 = val_2;
+    clone->revision_ = revision_;
+    return clone;
+  }
+};
+
 TEST(TesseractCloneCacheUnit, WithoutUpdate)  // NOLINT
 {
   auto original = std::make_shared<TestObject>();
@@ -245,6 +263,33 @@ TEST(TesseractCloneCacheUnit, SupportsUpdateFailure)  // NOLINT
   }
 }
 
+TEST(TesseractCloneCacheUnit, SupportsUpdateRejected)  // NOLINT
+{
+  auto original = std::make_shared<TestObjectSupportsUpdateRejected>();
+  original->val_1 = 1;
+  original->val_2 = 2;
+  auto clone_cache = std::make_shared<CloneCache<TestObjectSupportsUpdateRejected>>(original, 3);
+  EXPECT_TRUE(clone_cache->supports_update);
+  EXPECT_EQ(clone_cache->getCurrentCacheSize(), 3);
+
+  // The update is rejected so a new clone should be created
+  {
+    original->revision_++;
+    original->val_1 = 3;
+    auto clone = clone_cache->clone();
+    EXPECT_EQ(original->val_1, clone->val_1);
+    EXPECT_EQ(original->revision_, clone->revision_);
+  }
+  {
+    original->revision_++;
+    original->val_1 = 5;
+    clone_cache->updateCache();
+    EXPECT_EQ(clone_cache->getCurrentCacheSize(), 3);
+    auto clone = clone_cache->clone();
+    EXPECT_EQ(original->val_1, clone->val_1);
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -2576,6 +2576,82 @@ TEST(TesseractCommonUnit, TestAllowedCollisionEntriesCompare)  // NOLINT
   EXPECT_FALSE(acm1.getAllAllowedCollisions() == acm2.getAllAllowedCollisions());
 }
 
+TEST(TesseractCommonUnit, TestCompiledAllowedCollisionMatrix)  // NOLINT
+{
+  tesseract_common::AllowedCollisionMatrix acm;
+  acm.addAllowedCollision("link1", "link2", "test");
+  acm.addAllowedCollision("link3", "link1", "test");
+  acm.addAllowedCollision("link4", "link4", "test");
+
+  tesseract_common::CompiledAllowedCollisionMatrix compiled_acm(acm);
+  EXPECT_EQ(compiled_acm.getLinkNames().size(), 4);
+  for (const auto& link_name1 : compiled_acm.getLinkNames())
+  {
+    for (const auto& link_name2 : compiled_acm.getLinkNames())
+    {
+      EXPECT_EQ(compiled_acm.isCollisionAllowed(link_name1, link_name2),
+                acm.isCollisionAllowed(link_name1, link_name2));
+    }
+  }
+
+  EXPECT_TRUE(compiled_acm.isCollisionAllowed("link2", "link1"));
+  EXPECT_TRUE(compiled_acm.isCollisionAllowed("link4", "link4"));
+  EXPECT_FALSE(compiled_acm.isCollisionAllowed("link2", "link3"));
+  EXPECT_FALSE(compiled_acm.isCollisionAllowed("link1", "link1"));
+  EXPECT_FALSE(compiled_acm.isCollisionAllowed("link1", "link_does_not_exist"));
+  EXPECT_EQ(compiled_acm.getIndex("link_does_not_exist"), -1);
+
+  auto index1 = static_cast<std::size_t>(compiled_acm.getIndex("link1"));
+  auto index3 = static_cast<std::size_t>(compiled_acm.getIndex("link3"));
+  EXPECT_EQ(compiled_acm.getLinkNames()[index3], "link3");
+  EXPECT_TRUE(compiled_acm.isCollisionAllowed(index1, index3));
+  EXPECT_TRUE(compiled_acm.isCollisionAllowed(index3, index1));
+
+  // The function shares ownership of the snapshot and does not track changes to the source
+  auto fn = tesseract_common::CompiledAllowedCollisionMatrix::makeIsContactAllowedFn(
+      std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>(acm));
+  acm.removeAllowedCollision("link1");
+  EXPECT_TRUE(fn("link1", "link2"));
+  EXPECT_FALSE(fn("link2", "link3"));
+  EXPECT_TRUE(fn.target<tesseract_common::CompiledIsContactAllowedFn>() != nullptr);
+
+  tesseract_common::CompiledAllowedCollisionMatrix empty_acm;
+  EXPECT_TRUE(empty_acm.getLinkNames().empty());
+  EXPECT_FALSE(empty_acm.isCollisionAllowed("link1", "link2"));
+}
+
+TEST(TesseractCommonUnit, TestCompiledIsContactAllowedFn)  // NOLINT
+{
+  tesseract_common::CompiledIsContactAllowedFn empty_fn;
+  EXPECT_TRUE(empty_fn.get() != nullptr);
+  EXPECT_FALSE(empty_fn("link1", "link2"));
+
+  tesseract_common::AllowedCollisionMatrix acm;
+  acm.addAllowedCollision("link1", "link2", "test");
+  auto compiled_acm = std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>(acm);
+
+  tesseract_common::CompiledIsContactAllowedFn fn(compiled_acm);
+  EXPECT_EQ(fn.get(), compiled_acm);
+  EXPECT_TRUE(fn("link1", "link2"));
+
+  // Copies, including those stored in a std::function, share the published matrix
+  tesseract_common::CompiledIsContactAllowedFn fn_copy(fn);
+  std::function<bool(const std::string&, const std::string&)> std_fn = fn;
+
+  acm.removeAllowedCollision("link1");
+  acm.addAllowedCollision("link2", "link3", "test");
+  auto new_compiled_acm = std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>(acm);
+  fn.publish(new_compiled_acm);
+  EXPECT_EQ(fn_copy.get(), new_compiled_acm);
+  EXPECT_EQ(std_fn.target<tesseract_common::CompiledIsContactAllowedFn>()->get(), new_compiled_acm);
+  EXPECT_FALSE(fn_copy("link1", "link2"));
+  EXPECT_TRUE(fn_copy("link2", "link3"));
+  EXPECT_TRUE(std_fn("link3", "link2"));
+
+  EXPECT_ANY_THROW(fn.publish(nullptr));                                    // NOLINT
+  EXPECT_ANY_THROW(tesseract_common::CompiledIsContactAllowedFn(nullptr));  // NOLINT
+}
+
 TEST(TesseractCommonUnit, CollisionMarginDataCompare)  // NOLINT
 {
   {  // EQUAL Default
@@ -127,6 +127,17 @@ public:
    */
   Environment::UPtr clone() const;
 
+  /**
+   * @brief Update this environment to match the provided environment
+   * @details If this environment's command history is a prefix of the provided environment's command history only the
+   * commands after this environment's revision are applied, which is much cheaper than creating a new clone. The
+   * current state is also copied from the provided environment.
+   * @param env The environment to update from, typically the environment this was cloned from
+   * @return True if successful, otherwise false. If false, the histories diverged or a command failed to apply and this
+   * environment should be discarded in favor of a new clone.
+   */
+  bool update(const std::shared_ptr<const Environment>& env);
+
   /**
    * @brief reset to initialized state
    * @details If the environment has not been initialized then this returns false
@@ -526,6 +537,14 @@ public:
    */
   std::shared_lock<std::shared_mutex> lockRead() const;
 
+  /**
+   * @brief Get an immutable snapshot of the environment
+   * @details The snapshot is replaced whenever a command is applied or the state is changed so it does not require a
+   * lock and remains consistent while being read. This is preferred over lockRead when only making multiple reads of
+   * the state, link and joint names, collision margins and allowed collision matrix.
+   */
+  std::shared_ptr<const EnvironmentSnapshot> getSnapshot() const;
+
   /**
    * @brief These operators are to facilitate checking serialization but may have value elsewhere
    * @param rhs The environment to compare
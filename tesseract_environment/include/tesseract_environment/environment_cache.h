@@ -31,6 +31,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 #include <deque>
 #include <shared_mutex>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_environment
@@ -81,6 +84,22 @@ public:
 
   DefaultEnvironmentCache(std::shared_ptr<const Environment> env, std::size_t cache_size = 5);
 
+  /**
+   * @brief Create an environment cache which can be refilled in the background
+   * @details If background refill is enabled an event callback is added to the environment and the cache is refilled on
+   * a worker thread whenever a command is applied or the cache is running low. The callback is removed when the cache
+   * is destroyed.
+   * @param env The environment to cache
+   * @param cache_size The size of the cache
+   * @param background_refill Indicate if the cache should be refilled on a worker thread
+   */
+  DefaultEnvironmentCache(std::shared_ptr<Environment> env, std::size_t cache_size, bool background_refill);
+  ~DefaultEnvironmentCache() override;
+  DefaultEnvironmentCache(const DefaultEnvironmentCache&) = delete;
+  DefaultEnvironmentCache& operator=(const DefaultEnvironmentCache&) = delete;
+  DefaultEnvironmentCache(DefaultEnvironmentCache&&) = delete;
+  DefaultEnvironmentCache& operator=(DefaultEnvironmentCache&&) = delete;
+
   /**
    * @brief Set the cache size used to hold tesseract objects for motion planning
    * @param size The size of the cache.
@@ -98,10 +117,15 @@ public:
 
   /**
    * @brief This will pop an Environment object from the queue
-   * @details This will first call refreshCache to ensure it has an updated tesseract then proceed
+   * @details This will first call refreshCache to ensure it has an updated tesseract then proceed. If background refill
+   * is enabled this does not wait on the cache to be rebuilt, if the cache is out of date a single clone of the
+   * environment is returned and the cache is refilled on the worker thread.
    */
   std::unique_ptr<Environment> getCachedEnvironment() const override final;
 
+  /** @brief Check if the cache is refilled on a worker thread */
+  bool isBackgroundRefillEnabled() const;
+
 protected:
   /** @brief The tesseract_object used to create the cache */
   std::shared_ptr<const Environment> env_;
@@ -118,8 +142,35 @@ protected:
   /** @brief The mutex used when reading and writing to cache_ */
   mutable std::shared_mutex cache_mutex_;
 
+  /** @brief The environment the event callback was added to when background refill is enabled */
+  std::shared_ptr<Environment> event_env_;
+
+  /** @brief The worker thread used to refill the cache when background refill is enabled */
+  std::thread refill_thread_;
+
+  /** @brief The mutex used when reading and writing the refill flags */
+  mutable std::mutex refill_mutex_;
+
+  /** @brief Used to notify the worker thread of a refill request */
+  mutable std::condition_variable refill_cv_;
+
+  /** @brief Indicate that a refill was requested */
+  mutable bool refill_requested_{ false };
+
+  /** @brief Indicate that the worker thread should stop */
+  bool refill_stop_{ false };
+
   /** @brief This does not take a lock */
   void refreshCacheHelper() const;
+
+  /** @brief Request the worker thread to refill the cache */
+  void requestRefill() const;
+
+  /** @brief The worker thread loop */
+  void refillWorker();
+
+  /** @brief Refill the cache without holding the cache lock while cloning */
+  void refillCache();
 };
 }  // namespace tesseract_environment
 
@@ -0,0 +1,116 @@
+/**
+ * @file environment_snapshot.h
+ * @brief An immutable snapshot of the environment used for lock free reads
+ *
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_ENVIRONMENT_SNAPSHOT_H
+#define TESSERACT_ENVIRONMENT_ENVIRONMENT_SNAPSHOT_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/allowed_collision_matrix.h>
+#include <tesseract_common/collision_margin_data.h>
+#include <tesseract_scene_graph/fwd.h>
+#include <tesseract_scene_graph/scene_state.h>
+
+namespace tesseract_environment
+{
+/**
+ * @brief A read-only view of the environment which is published every time the environment changes
+ * @details The environment replaces the snapshot instead of modifying it, so a snapshot obtained from
+ * Environment::getSnapshot is always consistent and may be read without holding the environment lock. The data which
+ * only changes when a command is applied is shared between snapshots of the same revision.
+ */
+struct EnvironmentSnapshot
+{
+  using ConstPtr = std::shared_ptr<const EnvironmentSnapshot>;
+
+  /** @brief Identifies if the environment was initialized */
+  bool initialized{ false };
+
+  /** @brief The environment revision */
+  int revision{ 0 };
+
+  /** @brief The environment revision after initialization */
+  int init_revision{ 0 };
+
+  /** @brief The current state of the environment */
+  tesseract_scene_graph::SceneState state;
+
+  /** @brief The environment timestamp */
+  std::chrono::system_clock::time_point timestamp;
+
+  /** @brief The current state timestamp */
+  std::chrono::system_clock::time_point current_state_timestamp;
+
+  /** @brief The joint names in the order of the state solver */
+  std::shared_ptr<const std::vector<std::string>> joint_names{ std::make_shared<const std::vector<std::string>>() };
+
+  /** @brief The active joint names in the order of the state solver */
+  std::shared_ptr<const std::vector<std::string>> active_joint_names{
+    std::make_shared<const std::vector<std::string>>()
+  };
+
+  /** @brief The link names in the order of the state solver */
+  std::shared_ptr<const std::vector<std::string>> link_names{ std::make_shared<const std::vector<std::string>>() };
+
+  /** @brief The active link names in the order of the state solver */
+  std::shared_ptr<const std::vector<std::string>> active_link_names{
+    std::make_shared<const std::vector<std::string>>()
+  };
+
+  /** @brief The static link names in the order of the state solver */
+  std::shared_ptr<const std::vector<std::string>> static_link_names{
+    std::make_shared<const std::vector<std::string>>()
+  };
+
+  /** @brief The scene graph links by name */
+  std::shared_ptr<const std::unordered_map<std::string, std::shared_ptr<const tesseract_scene_graph::Link>>> links{
+    std::make_shared<const std::unordered_map<std::string, std::shared_ptr<const tesseract_scene_graph::Link>>>()
+  };
+
+  /** @brief The scene graph joints by name */
+  std::shared_ptr<const std::unordered_map<std::string, std::shared_ptr<const tesseract_scene_graph::Joint>>> joints{
+    std::make_shared<const std::unordered_map<std::string, std::shared_ptr<const tesseract_scene_graph::Joint>>>()
+  };
+
+  /** @brief The collision margin data */
+  std::shared_ptr<const tesseract_common::CollisionMarginData> collision_margin_data{
+    std::make_shared<const tesseract_common::CollisionMarginData>()
+  };
+
+  /** @brief The allowed collision matrix */
+  std::shared_ptr<const tesseract_common::CompiledAllowedCollisionMatrix> compiled_acm{
+    std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>()
+  };
+};
+
+}  // namespace tesseract_environment
+
+#endif  // TESSERACT_ENVIRONMENT_ENVIRONMENT_SNAPSHOT_H
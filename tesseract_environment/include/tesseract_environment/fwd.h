@@ -30,6 +30,7 @@ namespace tesseract_environment
 {
 class Environment;
 class EnvironmentCache;
+struct EnvironmentSnapshot;
 class EnvironmentMonitorInterface;
 class EnvironmentMonitor;
 enum class MonitoredEnvironmentMode;
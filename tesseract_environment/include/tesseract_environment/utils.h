@@ -122,6 +122,20 @@ void checkTrajectoryState(tesseract_collision::ContactResultMap& contact_results
                           const tesseract_common::TransformMap& state,
                           const tesseract_collision::ContactRequest& contact_request);
 
+/**
+ * @brief Should perform a discrete collision check a state only passing contact_request to the manager
+ * @details The results are written directly to the flat container so checking a state does not allocate once the
+ * container is warmed up.
+ * @param contact_results The contact results to populate. It does not get cleared
+ * @param manager A discrete contact manager
+ * @param state First environment state
+ * @param contact_request Contact request passed to the manager
+ */
+void checkTrajectoryState(tesseract_collision::FlatContactResultMap& contact_results,
+                          tesseract_collision::DiscreteContactManager& manager,
+                          const tesseract_common::TransformMap& state,
+                          const tesseract_collision::ContactRequest& contact_request);
+
 /**
  * @brief Should perform a continuous collision check over the trajectory and stop on first collision.
  * @param contacts A vector of ContactMap where each index corresponds to a segment in the trajectory. The length should
@@ -190,5 +204,93 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
                      const tesseract_common::TrajArray& traj,
                      const tesseract_collision::CollisionCheckConfig& config);
 
+/**
+ * @brief Should perform a continuous collision check over the trajectory in parallel.
+ * @details The trajectory is split into chunks which are checked on separate threads, each using its own clone of the
+ * provided manager. The per step results are merged in order so the output matches the serial checkTrajectory. If the
+ * contact test type is FIRST, all workers stop once a collision has been found in an earlier chunk.
+ * @param contacts A vector of ContactMap where each index corresponds to a segment in the trajectory. The length should
+ * be trajectory size minus one.
+ * @param manager A continuous contact manager which is cloned for each thread
+ * @param state_solver The environment state solver
+ * @param joint_names JointNames corresponding to the values in traj (must be in same order)
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param num_threads The number of threads to use. If zero, the hardware concurrency is used.
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const tesseract_collision::ContinuousContactManager& manager,
+                     const tesseract_scene_graph::StateSolver& state_solver,
+                     const std::vector<std::string>& joint_names,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     std::size_t num_threads);
+
+/**
+ * @brief Should perform a continuous collision check over the trajectory in parallel.
+ * @details The trajectory is split into chunks which are checked on separate threads, each using its own clone of the
+ * provided manager. The per step results are merged in order so the output matches the serial checkTrajectory. If the
+ * contact test type is FIRST, all workers stop once a collision has been found in an earlier chunk.
+ * @param contacts A vector of ContactMap where each index corresponds to a segment in the trajectory. The length should
+ * be trajectory size minus one.
+ * @param manager A continuous contact manager which is cloned for each thread
+ * @param manip The kinematic joint group
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param num_threads The number of threads to use. If zero, the hardware concurrency is used.
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const tesseract_collision::ContinuousContactManager& manager,
+                     const tesseract_kinematics::JointGroup& manip,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     std::size_t num_threads);
+
+/**
+ * @brief Should perform a discrete collision check over the trajectory in parallel.
+ * @details The trajectory is split into chunks which are checked on separate threads, each using its own clone of the
+ * provided manager. The per step results are merged in order so the output matches the serial checkTrajectory. If the
+ * contact test type is FIRST, all workers stop once a collision has been found in an earlier chunk.
+ * @param contacts A vector of ContactMap where each index corresponds to a segment in the trajectory, except the last
+ * which is the end state. The length should be the same size as the input trajectory.
+ * @param manager A discrete contact manager which is cloned for each thread
+ * @param state_solver The environment state solver
+ * @param joint_names JointNames corresponding to the values in traj (must be in same order)
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param num_threads The number of threads to use. If zero, the hardware concurrency is used.
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const tesseract_collision::DiscreteContactManager& manager,
+                     const tesseract_scene_graph::StateSolver& state_solver,
+                     const std::vector<std::string>& joint_names,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     std::size_t num_threads);
+
+/**
+ * @brief Should perform a discrete collision check over the trajectory in parallel.
+ * @details The trajectory is split into chunks which are checked on separate threads, each using its own clone of the
+ * provided manager. The per step results are merged in order so the output matches the serial checkTrajectory. If the
+ * contact test type is FIRST, all workers stop once a collision has been found in an earlier chunk.
+ * @param contacts A vector of ContactMap where each index corresponds to a segment in the trajectory, except the last
+ * which is the end state. The length should be the same size as the input trajectory.
+ * @param manager A discrete contact manager which is cloned for each thread
+ * @param manip The kinematic joint group
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param num_threads The number of threads to use. If zero, the hardware concurrency is used.
+ * @return True if collision was found, otherwise false.
+ */
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const tesseract_collision::DiscreteContactManager& manager,
+                     const tesseract_kinematics::JointGroup& manip,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     std::size_t num_threads);
+
 }  // namespace tesseract_environment
 #endif  // TESSERACT_ENVIRONMENT_CORE_UTILS_H
@@ -26,6 +26,7 @@
 
 #include <tesseract_environment/environment.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/shared_ptr.hpp>
@@ -36,6 +37,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_environment/utils.h>
 #include <tesseract_environment/events.h>
+#include <tesseract_environment/environment_snapshot.h>
 #include <tesseract_environment/command.h>
 #include <tesseract_environment/commands.h>
 
@@ -63,6 +65,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/manipulator_info.h>
 #include <tesseract_common/resource_locator.h>
+#include <tesseract_common/allowed_collision_matrix.h>
 
 #include <tesseract_state_solver/mutable_state_solver.h>
 #include <tesseract_state_solver/ofkt/ofkt_state_solver.h>
@@ -176,6 +179,24 @@ struct Environment::Implementation
    */
   std::function<bool(const std::string&, const std::string&)> is_contact_allowed_fn;
 
+  /**
+   * @brief A read-only snapshot of the scene graph allowed collision matrix used by is_contact_allowed_fn
+   * @note This is intentionally not serialized it will auto updated
+   */
+  std::shared_ptr<const tesseract_common::CompiledAllowedCollisionMatrix> compiled_acm{
+    std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>()
+  };
+
+  /** @brief Indicates the allowed collision matrix has changed and compiled_acm must be rebuilt */
+  bool compiled_acm_dirty{ true };
+
+  /**
+   * @brief The function stored in is_contact_allowed_fn which compiled_acm is published to
+   * @details Contact managers handed out earlier share it, so they use the rebuilt matrix on their next contact test.
+   * @note This is intentionally not serialized it will auto updated
+   */
+  tesseract_common::CompiledIsContactAllowedFn compiled_contact_allowed_fn;
+
   /**
    * @brief A vector of user defined callbacks for locating tool center point
    * @todo This needs to be switched to class so it may be serialized
@@ -260,6 +281,12 @@ struct Environment::Implementation
       kinematic_group_cache{};
   mutable std::shared_mutex kinematic_group_cache_mutex;
 
+  /**
+   * @brief The read-only snapshot of the environment which is replaced using atomic operations
+   * @note This is intentionally not serialized it will auto updated
+   */
+  std::shared_ptr<const EnvironmentSnapshot> snapshot{ std::make_shared<const EnvironmentSnapshot>() };
+
   bool operator==(const Implementation& rhs) const;
 
   bool initHelper(const std::vector<std::shared_ptr<const Command>>& commands);
@@ -268,22 +295,27 @@ struct Environment::Implementation
 
   void setState(const std::vector<std::string>& joint_names, const Eigen::Ref<const Eigen::VectorXd>& joint_values);
 
-  Eigen::VectorXd getCurrentJointValues() const;
-
-  Eigen::VectorXd getCurrentJointValues(const std::vector<std::string>& joint_names) const;
-
   std::vector<std::string> getStaticLinkNames(const std::vector<std::string>& joint_names) const;
 
   void clear();
 
   bool reset();
 
-  /** This will update the contact managers transforms */
-  void currentStateChanged();
+  /**
+   * @brief This will update the contact managers transforms
+   * @param update_all_links If false, only links whose transform changed in the state solver are updated
+   */
+  void currentStateChanged(bool update_all_links = false);
 
   /** This will notify the state solver that the environment has changed */
   void environmentChanged();
 
+  /** @brief Publish a new snapshot, the data which only changes with the revision is shared with the last snapshot */
+  void publishSnapshot();
+
+  /** @brief Store the scene graph links and joints in the snapshot */
+  void snapshotSceneGraph(EnvironmentSnapshot& next) const;
+
   /** @brief @brief Passes a current state changed event to the callbacks */
   void triggerCurrentStateChangedCallbacks();
 
@@ -405,6 +437,8 @@ struct Environment::Implementation
     ar& boost::serialization::make_nvp(
         "current_state_timestamp",
         boost::serialization::make_binary_object(&current_state_timestamp, sizeof(current_state_timestamp)));
+
+    publishSnapshot();
   }
 
   template <class Archive>
@@ -487,11 +521,18 @@ std::unique_ptr<Environment::Implementation> Environment::Implementation::clone(
 
   cloned_env->group_joint_names_cache = group_joint_names_cache;
 
-  // NOLINTNEXTLINE
-  cloned_env->is_contact_allowed_fn = std::bind(&tesseract_scene_graph::SceneGraph::isCollisionAllowed,
-                                                cloned_env->scene_graph,
-                                                std::placeholders::_1,
-                                                std::placeholders::_2);
+  // The snapshot is immutable so it is shared with the clone, except for the links and joints owned by the scene graph
+  cloned_env->compiled_acm = compiled_acm;
+  cloned_env->compiled_acm_dirty = compiled_acm_dirty;
+  auto cloned_snapshot = std::make_shared<EnvironmentSnapshot>(*std::atomic_load(&snapshot));
+  if (cloned_snapshot->initialized)
+    cloned_env->snapshotSceneGraph(*cloned_snapshot);
+  cloned_env->snapshot = std::move(cloned_snapshot);
+
+  // The clone publishes to its own function so changes to it do not affect the managers of this environment
+  cloned_env->compiled_contact_allowed_fn = tesseract_common::CompiledIsContactAllowedFn(compiled_acm);
+  if (is_contact_allowed_fn != nullptr)
+    cloned_env->is_contact_allowed_fn = cloned_env->compiled_contact_allowed_fn;
 
   if (discrete_manager)
   {
@@ -527,9 +568,8 @@ bool Environment::Implementation::initHelper(const std::vector<std::shared_ptr<c
   scene_graph = std::make_shared<tesseract_scene_graph::SceneGraph>(
       std::static_pointer_cast<const AddSceneGraphCommand>(commands.at(0))->getSceneGraph()->getName());
 
-  is_contact_allowed_fn = [this](const std::string& l1, const std::string& l2) {
-    return scene_graph->isCollisionAllowed(l1, l2);
-  };
+  compiled_contact_allowed_fn = tesseract_common::CompiledIsContactAllowedFn(compiled_acm);
+  is_contact_allowed_fn = compiled_contact_allowed_fn;
 
   if (!applyCommandsHelper(commands))
   {
@@ -558,27 +598,6 @@ void Environment::Implementation::setState(const std::vector<std::string>& joint
   currentStateChanged();
 }
 
-Eigen::VectorXd Environment::Implementation::getCurrentJointValues() const
-{
-  Eigen::VectorXd jv;
-  std::vector<std::string> active_joint_names = state_solver->getActiveJointNames();
-  jv.resize(static_cast<long int>(active_joint_names.size()));
-  for (auto j = 0U; j < active_joint_names.size(); ++j)
-    jv(j) = current_state.joints.at(active_joint_names[j]);
-
-  return jv;
-}
-
-Eigen::VectorXd Environment::Implementation::getCurrentJointValues(const std::vector<std::string>& joint_names) const
-{
-  Eigen::VectorXd jv;
-  jv.resize(static_cast<long int>(joint_names.size()));
-  for (auto j = 0U; j < joint_names.size(); ++j)
-    jv(j) = current_state.joints.at(joint_names[j]);
-
-  return jv;
-}
-
 std::vector<std::string>
 Environment::Implementation::getStaticLinkNames(const std::vector<std::string>& joint_names) const
 {
@@ -609,7 +628,11 @@ void Environment::Implementation::clear()
   current_state = tesseract_scene_graph::SceneState();
   commands.clear();
   is_contact_allowed_fn = nullptr;
+  compiled_acm = std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>();
+  compiled_acm_dirty = true;
+  compiled_contact_allowed_fn = tesseract_common::CompiledIsContactAllowedFn(compiled_acm);
   collision_margin_data = tesseract_collision::CollisionMarginData();
+  std::atomic_store(&snapshot, std::make_shared<const EnvironmentSnapshot>());
   kinematics_information.clear();
   contact_managers_plugin_info.clear();
 
@@ -656,26 +679,51 @@ bool Environment::Implementation::reset()
   return initHelper(init_command);
 }
 
-void Environment::Implementation::currentStateChanged()
+void Environment::Implementation::currentStateChanged(bool update_all_links)
 {
   timestamp = std::chrono::system_clock::now();
   current_state_timestamp = timestamp;
   current_state = state_solver->getState();
 
+  // Only push the links which moved so the contact managers skip the broadphase update of everything else
+  std::vector<std::string> changed_link_names;
+  if (update_all_links)
+  {
+    changed_link_names.reserve(current_state.link_transforms.size());
+    for (const auto& tf : current_state.link_transforms)
+      changed_link_names.push_back(tf.first);
+  }
+  else
+  {
+    changed_link_names = state_solver->getChangedLinkNames();
+  }
+  state_solver->clearChangedLinkNames();
+
+  tesseract_common::VectorIsometry3d changed_link_transforms;
+  changed_link_transforms.reserve(changed_link_names.size());
+  for (const auto& link_name : changed_link_names)
+    changed_link_transforms.push_back(current_state.link_transforms.at(link_name));
+
   std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex);
   if (discrete_manager != nullptr)
-    discrete_manager->setCollisionObjectsTransform(current_state.link_transforms);
+    discrete_manager->setCollisionObjectsTransform(changed_link_names, changed_link_transforms);
 
   std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex);
   if (continuous_manager != nullptr)
   {
     std::vector<std::string> active_link_names = state_solver->getActiveLinkNames();
-    for (const auto& tf : current_state.link_transforms)
+    for (std::size_t i = 0; i < changed_link_names.size(); ++i)
     {
-      if (std::find(active_link_names.begin(), active_link_names.end(), tf.first) != active_link_names.end())
-        continuous_manager->setCollisionObjectsTransform(tf.first, tf.second, tf.second);
+      const std::string& link_name = changed_link_names[i];
+      if (std::find(active_link_names.begin(), active_link_names.end(), link_name) != active_link_names.end())
+      {
+        continuous_manager->setCollisionObjectsTransform(
+            link_name, changed_link_transforms[i], changed_link_transforms[i]);
+      }
       else
-        continuous_manager->setCollisionObjectsTransform(tf.first, tf.second);
+      {
+        continuous_manager->setCollisionObjectsTransform(link_name, changed_link_transforms[i]);
+      }
     }
   }
 
@@ -685,6 +733,65 @@ void Environment::Implementation::currentStateChanged()
     joint_group_cache.clear();
     kinematic_group_cache.clear();
   }
+
+  publishSnapshot();
+}
+
+void Environment::Implementation::publishSnapshot()
+{
+  std::shared_ptr<const EnvironmentSnapshot> last = std::atomic_load(&snapshot);
+
+  auto next = std::make_shared<EnvironmentSnapshot>();
+  next->initialized = initialized;
+  next->revision = revision;
+  next->init_revision = init_revision;
+  next->state = current_state;
+  next->timestamp = timestamp;
+  next->current_state_timestamp = current_state_timestamp;
+
+  if (last->initialized == initialized && last->revision == revision && last->init_revision == init_revision)
+  {
+    next->joint_names = last->joint_names;
+    next->active_joint_names = last->active_joint_names;
+    next->link_names = last->link_names;
+    next->active_link_names = last->active_link_names;
+    next->static_link_names = last->static_link_names;
+    next->links = last->links;
+    next->joints = last->joints;
+    next->collision_margin_data = last->collision_margin_data;
+    next->compiled_acm = last->compiled_acm;
+  }
+  else if (state_solver != nullptr)
+  {
+    using Names = const std::vector<std::string>;
+    next->joint_names = std::make_shared<Names>(state_solver->getJointNames());
+    next->active_joint_names = std::make_shared<Names>(state_solver->getActiveJointNames());
+    next->link_names = std::make_shared<Names>(state_solver->getLinkNames());
+    next->active_link_names = std::make_shared<Names>(state_solver->getActiveLinkNames());
+    next->static_link_names = std::make_shared<Names>(state_solver->getStaticLinkNames());
+    snapshotSceneGraph(*next);
+    next->collision_margin_data = std::make_shared<const tesseract_common::CollisionMarginData>(collision_margin_data);
+    next->compiled_acm = compiled_acm;
+  }
+
+  std::atomic_store(&snapshot, std::shared_ptr<const EnvironmentSnapshot>(std::move(next)));
+}
+
+void Environment::Implementation::snapshotSceneGraph(EnvironmentSnapshot& next) const
+{
+  if (scene_graph == nullptr)
+    return;
+
+  auto links = std::make_shared<std::unordered_map<std::string, tesseract_scene_graph::Link::ConstPtr>>();
+  for (const auto& link : scene_graph->getLinks())
+    links->emplace(link->getName(), link);
+
+  auto joints = std::make_shared<std::unordered_map<std::string, tesseract_scene_graph::Joint::ConstPtr>>();
+  for (const auto& joint : scene_graph->getJoints())
+    joints->emplace(joint->getName(), joint);
+
+  next.links = std::move(links);
+  next.joints = std::move(joints);
 }
 
 void Environment::Implementation::environmentChanged()
@@ -692,6 +799,18 @@ void Environment::Implementation::environmentChanged()
   timestamp = std::chrono::system_clock::now();
   std::vector<std::string> active_link_names = state_solver->getActiveLinkNames();
 
+  // Only rebuild the allowed collision matrix snapshot if a command modified it
+  if (compiled_acm_dirty)
+  {
+    compiled_acm =
+        std::make_shared<const tesseract_common::CompiledAllowedCollisionMatrix>(*scene_graph->getAllowedCollisionMatrix());
+    compiled_acm_dirty = false;
+
+    // Every manager sharing the function, including those handed out earlier, picks up the new matrix on its next
+    // contact test. The managers also share ownership of the matrix so they stay valid after the environment is gone.
+    compiled_contact_allowed_fn.publish(compiled_acm);
+  }
+
   {
     std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex);
     if (discrete_manager != nullptr)
@@ -709,7 +828,8 @@ void Environment::Implementation::environmentChanged()
     group_joint_names_cache.clear();
   }
 
-  currentStateChanged();
+  // Collision objects may have been added or replaced so push every link transform
+  currentStateChanged(true);
 }
 
 void Environment::Implementation::triggerCurrentStateChangedCallbacks()
@@ -1111,6 +1231,7 @@ bool Environment::Implementation::removeLinkHelper(const std::string& name)
   std::vector<std::string> child_link_names = scene_graph->getLinkChildrenNames(name);
 
   scene_graph->removeLink(name, true);
+  compiled_acm_dirty = true;
 
   std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex);
   std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex);
@@ -1775,6 +1896,7 @@ bool Environment::Implementation::applyModifyAllowedCollisionsCommand(
     }
   }
 
+  compiled_acm_dirty = true;
   ++revision;
   commands.push_back(cmd);
 
@@ -1785,6 +1907,7 @@ bool Environment::Implementation::applyRemoveAllowedCollisionLinkCommand(
     const std::shared_ptr<const RemoveAllowedCollisionLinkCommand>& cmd)
 {
   scene_graph->removeAllowedCollision(cmd->getLinkName());
+  compiled_acm_dirty = true;
 
   ++revision;
   commands.push_back(cmd);
@@ -1832,6 +1955,8 @@ bool Environment::Implementation::applyAddSceneGraphCommand(std::shared_ptr<cons
       throw std::runtime_error("Environment, failed to insert scene graph into state solver.");
   }
 
+  compiled_acm_dirty = true;
+
   // Now need to get list of added links to add to the contact manager
   std::vector<tesseract_scene_graph::Link::ConstPtr> post_links = scene_graph->getLinks();
   assert(post_links.size() > pre_links.size());
@@ -2270,20 +2395,17 @@ void Environment::clear()
 
 bool Environment::isInitialized() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).initialized;
+  return getSnapshot()->initialized;
 }
 
 int Environment::getRevision() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).revision;
+  return getSnapshot()->revision;
 }
 
 int Environment::getInitRevision() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).init_revision;
+  return getSnapshot()->init_revision;
 }
 
 std::vector<std::shared_ptr<const Command>> Environment::getCommandHistory() const
@@ -2443,27 +2565,24 @@ tesseract_scene_graph::SceneState Environment::getState(const std::vector<std::s
 
 tesseract_scene_graph::SceneState Environment::getState() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).current_state;
+  return getSnapshot()->state;
 }
 
 std::chrono::system_clock::time_point Environment::getTimestamp() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).timestamp;
+  return getSnapshot()->timestamp;
 }
 
 std::chrono::system_clock::time_point Environment::getCurrentStateTimestamp() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).current_state_timestamp;
+  return getSnapshot()->current_state_timestamp;
 }
 
 std::shared_ptr<const tesseract_scene_graph::Link> Environment::getLink(const std::string& name) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  tesseract_scene_graph::Link::ConstPtr link = std::as_const<Implementation>(*impl_).scene_graph->getLink(name);
-  return link;
+  std::shared_ptr<const EnvironmentSnapshot> snapshot = getSnapshot();
+  auto it = snapshot->links->find(name);
+  return (it != snapshot->links->end()) ? it->second : nullptr;
 }
 
 std::shared_ptr<const tesseract_scene_graph::JointLimits>
@@ -2493,32 +2612,40 @@ std::shared_ptr<const tesseract_common::AllowedCollisionMatrix> Environment::get
 
 std::vector<std::string> Environment::getJointNames() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).state_solver->getJointNames();
+  return *getSnapshot()->joint_names;
 }
 
 std::vector<std::string> Environment::getActiveJointNames() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).state_solver->getActiveJointNames();
+  return *getSnapshot()->active_joint_names;
 }
 
 std::shared_ptr<const tesseract_scene_graph::Joint> Environment::getJoint(const std::string& name) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).scene_graph->getJoint(name);
+  std::shared_ptr<const EnvironmentSnapshot> snapshot = getSnapshot();
+  auto it = snapshot->joints->find(name);
+  return (it != snapshot->joints->end()) ? it->second : nullptr;
 }
 
 Eigen::VectorXd Environment::getCurrentJointValues() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).getCurrentJointValues();
+  std::shared_ptr<const EnvironmentSnapshot> snapshot = getSnapshot();
+  const std::vector<std::string>& active_joint_names = *snapshot->active_joint_names;
+  Eigen::VectorXd jv(static_cast<Eigen::Index>(active_joint_names.size()));
+  for (auto j = 0U; j < active_joint_names.size(); ++j)
+    jv(j) = snapshot->state.joints.at(active_joint_names[j]);
+
+  return jv;
 }
 
 Eigen::VectorXd Environment::getCurrentJointValues(const std::vector<std::string>& joint_names) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).getCurrentJointValues(joint_names);
+  std::shared_ptr<const EnvironmentSnapshot> snapshot = getSnapshot();
+  Eigen::VectorXd jv(static_cast<Eigen::Index>(joint_names.size()));
+  for (auto j = 0U; j < joint_names.size(); ++j)
+    jv(j) = snapshot->state.joints.at(joint_names[j]);
+
+  return jv;
 }
 
 std::string Environment::getRootLinkName() const
@@ -2529,14 +2656,12 @@ std::string Environment::getRootLinkName() const
 
 std::vector<std::string> Environment::getLinkNames() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).state_solver->getLinkNames();
+  return *getSnapshot()->link_names;
 }
 
 std::vector<std::string> Environment::getActiveLinkNames() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).state_solver->getActiveLinkNames();
+  return *getSnapshot()->active_link_names;
 }
 
 std::vector<std::string> Environment::getActiveLinkNames(const std::vector<std::string>& joint_names) const
@@ -2547,8 +2672,7 @@ std::vector<std::string> Environment::getActiveLinkNames(const std::vector<std::
 
 std::vector<std::string> Environment::getStaticLinkNames() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).state_solver->getStaticLinkNames();
+  return *getSnapshot()->static_link_names;
 }
 
 std::vector<std::string> Environment::getStaticLinkNames(const std::vector<std::string>& joint_names) const
@@ -2559,21 +2683,26 @@ std::vector<std::string> Environment::getStaticLinkNames(const std::vector<std::
 
 tesseract_common::VectorIsometry3d Environment::getLinkTransforms() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).state_solver->getLinkTransforms();
+  std::shared_ptr<const EnvironmentSnapshot> snapshot = getSnapshot();
+  tesseract_common::VectorIsometry3d link_tfs;
+  link_tfs.reserve(snapshot->link_names->size());
+  for (const auto& link_name : *snapshot->link_names)
+    link_tfs.push_back(snapshot->state.link_transforms.at(link_name));
+
+  return link_tfs;
 }
 
 Eigen::Isometry3d Environment::getLinkTransform(const std::string& link_name) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).state_solver->getLinkTransform(link_name);
+  return getSnapshot()->state.link_transforms.at(link_name);
 }
 
 Eigen::Isometry3d Environment::getRelativeLinkTransform(const std::string& from_link_name,
                                                         const std::string& to_link_name) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).state_solver->getRelativeLinkTransform(from_link_name, to_link_name);
+  std::shared_ptr<const EnvironmentSnapshot> snapshot = getSnapshot();
+  const tesseract_common::TransformMap& link_transforms = snapshot->state.link_transforms;
+  return link_transforms.at(from_link_name).inverse() * link_transforms.at(to_link_name);
 }
 
 std::unique_ptr<tesseract_scene_graph::StateSolver> Environment::getStateSolver() const
@@ -2652,8 +2781,7 @@ void Environment::clearCachedContinuousContactManager() const
 
 tesseract_common::CollisionMarginData Environment::getCollisionMarginData() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return std::as_const<Implementation>(*impl_).collision_margin_data;
+  return *getSnapshot()->collision_margin_data;
 }
 
 std::shared_lock<std::shared_mutex> Environment::lockRead() const
@@ -2661,6 +2789,11 @@ std::shared_lock<std::shared_mutex> Environment::lockRead() const
   return std::shared_lock<std::shared_mutex>(mutex_);
 }
 
+std::shared_ptr<const EnvironmentSnapshot> Environment::getSnapshot() const
+{
+  return std::atomic_load(&std::as_const<Implementation>(*impl_).snapshot);
+}
+
 bool Environment::operator==(const Environment& rhs) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
@@ -2675,6 +2808,58 @@ Environment::UPtr Environment::clone() const
   return std::make_unique<Environment>(std::as_const<Implementation>(*impl_).clone());
 }
 
+bool Environment::update(const std::shared_ptr<const Environment>& env)
+{
+  if (env == nullptr || env.get() == this)
+    return false;
+
+  // Both environments are never locked at the same time to avoid a lock order inversion
+  bool initialized{ false };
+  int init_revision{ 0 };
+  std::vector<std::shared_ptr<const Command>> commands;
+  tesseract_scene_graph::SceneState current_state;
+  std::chrono::system_clock::time_point timestamp;
+  std::chrono::system_clock::time_point current_state_timestamp;
+  {
+    std::shared_lock<std::shared_mutex> lock(env->mutex_);
+    const auto& impl = std::as_const<Implementation>(*env->impl_);
+    initialized = impl.initialized;
+    init_revision = impl.init_revision;
+    commands = impl.commands;
+    current_state = impl.current_state;
+    timestamp = impl.timestamp;
+    current_state_timestamp = impl.current_state_timestamp;
+  }
+
+  bool success{ false };
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (!impl_->initialized || !initialized || impl_->init_revision != init_revision ||
+        impl_->commands.size() > commands.size())
+      return false;
+
+    // Commands are immutable and shared between clones so comparing pointers is enough to detect divergence
+    if (!std::equal(impl_->commands.begin(), impl_->commands.end(), commands.begin()))
+      return false;
+
+    std::vector<std::shared_ptr<const Command>> pending(
+        commands.begin() + static_cast<std::ptrdiff_t>(impl_->commands.size()), commands.end());
+    success = pending.empty() || impl_->applyCommandsHelper(pending);
+    if (success)
+    {
+      impl_->setState(current_state.joints);
+      impl_->timestamp = timestamp;
+      impl_->current_state_timestamp = current_state_timestamp;
+      impl_->publishSnapshot();
+    }
+  }
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  impl_->triggerCallbacks();
+
+  return success;
+}
+
 template <class Archive>
 void Environment::save(Archive& ar, const unsigned int /*version*/) const
 {
@@ -24,8 +24,14 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_environment/environment_cache.h>
 #include <tesseract_environment/environment.h>
+#include <tesseract_environment/events.h>
 #include <tesseract_kinematics/core/joint_group.h>
 #include <tesseract_kinematics/core/kinematic_group.h>
 
@@ -36,6 +42,53 @@ DefaultEnvironmentCache::DefaultEnvironmentCache(std::shared_ptr<const Environme
 {
 }
 
+DefaultEnvironmentCache::DefaultEnvironmentCache(std::shared_ptr<Environment> env,
+                                                 std::size_t cache_size,
+                                                 bool background_refill)
+  : env_(env), cache_size_(cache_size)
+{
+  if (!background_refill)
+    return;
+
+  event_env_ = std::move(env);
+
+  // The callback is called while the environment is locked so it only notifies the worker thread. It is registered
+  // before the worker starts so no command applied in between is missed.
+  event_env_->addEventCallback(std::hash<DefaultEnvironmentCache*>{}(this), [this](const Event& event) {
+    if (event.type == Events::COMMAND_APPLIED)
+      requestRefill();
+  });
+
+  try
+  {
+    refill_thread_ = std::thread(&DefaultEnvironmentCache::refillWorker, this);
+  }
+  catch (...)
+  {
+    event_env_->removeEventCallback(std::hash<DefaultEnvironmentCache*>{}(this));
+    throw;
+  }
+
+  requestRefill();
+}
+
+DefaultEnvironmentCache::~DefaultEnvironmentCache()
+{
+  if (event_env_ == nullptr)
+    return;
+
+  event_env_->removeEventCallback(std::hash<DefaultEnvironmentCache*>{}(this));
+
+  {
+    std::lock_guard<std::mutex> lock(refill_mutex_);
+    refill_stop_ = true;
+  }
+  refill_cv_.notify_one();
+
+  if (refill_thread_.joinable())
+    refill_thread_.join();
+}
+
 void DefaultEnvironmentCache::setCacheSize(long size)
 {
   std::unique_lock<std::shared_mutex> lock(cache_mutex_);
@@ -54,6 +107,33 @@ std::unique_ptr<Environment> DefaultEnvironmentCache::getCachedEnvironment() con
 {
   tesseract_scene_graph::SceneState current_state = env_->getState();
 
+  if (event_env_ != nullptr)
+  {
+    const int rev = env_->getRevision();
+
+    std::unique_ptr<Environment> t;
+    bool low{ true };
+    {
+      std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+      if (rev == cache_env_revision_ && !cache_.empty())
+      {
+        t = std::move(cache_.back());
+        cache_.pop_back();
+        low = (cache_.size() <= 2);
+      }
+    }
+
+    if (low)
+      requestRefill();
+
+    // The cache is out of date so return a single clone instead of waiting on the worker thread
+    if (t == nullptr)
+      return env_->clone();
+
+    t->setState(current_state.joints);
+    return t;
+  }
+
   std::unique_lock<std::shared_mutex> lock(cache_mutex_);
   refreshCacheHelper();  // This is to make sure the cached items are updated if needed
   assert(!cache_.empty());
@@ -68,17 +148,31 @@ std::unique_ptr<Environment> DefaultEnvironmentCache::getCachedEnvironment() con
 
 void DefaultEnvironmentCache::refreshCacheHelper() const
 {
-  std::unique_ptr<Environment> env;
+  // The environment must not change while the cached environments are caught up or cloned
   auto lock_read = env_->lockRead();
-  int rev = env_->getRevision();
-  if (rev != cache_env_revision_ || cache_.empty())
+  const int rev = env_->getRevision();
+  bool discarded{ false };
+  if (rev != cache_env_revision_ && !cache_.empty())
   {
-    env = env_->clone();
-    cache_env_revision_ = rev;
+    // Catch up the cached environments by applying only the new commands instead of creating new clones
+    for (auto& cache : cache_)
+    {
+      if (!cache->update(env_) || cache->getRevision() != rev)
+        cache = nullptr;
+    }
+
+    const std::size_t size = cache_.size();
+    cache_.erase(std::remove(cache_.begin(), cache_.end(), nullptr), cache_.end());
+    discarded = (cache_.size() != size);
+    if (!cache_.empty())
+      cache_env_revision_ = rev;
   }
 
-  if (env != nullptr)
+  if (rev != cache_env_revision_ || cache_.empty())
   {
+    std::unique_ptr<Environment> env = env_->clone();
+    cache_env_revision_ = env->getRevision();
+
     cache_.clear();
     for (std::size_t i = 0; i < cache_size_; ++i)
       cache_.push_back(env->clone());
@@ -88,6 +182,101 @@ void DefaultEnvironmentCache::refreshCacheHelper() const
     for (std::size_t i = (cache_.size() - 1); i < cache_size_; ++i)
       cache_.push_back(cache_.front()->clone());
   }
+  else if (discarded)
+  {
+    // Replace the cached environments which could not be caught up
+    while (cache_.size() < cache_size_)
+      cache_.push_back(cache_.front()->clone());
+  }
+}
+
+bool DefaultEnvironmentCache::isBackgroundRefillEnabled() const { return (event_env_ != nullptr); }
+
+void DefaultEnvironmentCache::requestRefill() const
+{
+  {
+    std::lock_guard<std::mutex> lock(refill_mutex_);
+    refill_requested_ = true;
+  }
+  refill_cv_.notify_one();
+}
+
+void DefaultEnvironmentCache::refillWorker()
+{
+  std::unique_lock<std::mutex> lock(refill_mutex_);
+  while (true)
+  {
+    refill_cv_.wait(lock, [this]() { return refill_stop_ || refill_requested_; });
+    if (refill_stop_)
+      break;
+
+    refill_requested_ = false;
+    lock.unlock();
+    refillCache();
+    lock.lock();
+  }
+}
+
+void DefaultEnvironmentCache::refillCache()
+{
+  int rev{ 0 };
+  std::deque<std::unique_ptr<Environment>> stale;
+  {
+    std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+    rev = env_->getRevision();
+    if (rev != cache_env_revision_)
+    {
+      stale.swap(cache_);
+      cache_env_revision_ = rev;
+    }
+  }
+
+  // Catch up the stale environments by applying only the new commands instead of creating new clones
+  for (auto& cache : stale)
+  {
+    if (!cache->update(env_) || cache->getRevision() != rev)
+      continue;
+
+    std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+    if (rev != cache_env_revision_)
+      return;
+
+    if (cache_.size() < cache_size_)
+      cache_.push_back(std::move(cache));
+  }
+
+  // Only a single clone is made while the environment is locked, the rest are cloned from this copy
+  std::unique_ptr<Environment> env;
+  while (true)
+  {
+    {
+      std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+      if (rev != cache_env_revision_ || cache_.size() >= cache_size_)
+        return;
+    }
+
+    // Stop early if the cache is being destroyed or the environment changed again
+    {
+      std::lock_guard<std::mutex> lock(refill_mutex_);
+      if (refill_stop_ || refill_requested_)
+        return;
+    }
+
+    if (env == nullptr)
+    {
+      env = env_->clone();
+      if (env->getRevision() != rev)
+        return;
+    }
+
+    std::unique_ptr<Environment> clone = env->clone();
+
+    std::unique_lock<std::shared_mutex> lock(cache_mutex_);
+    if (rev != cache_env_revision_)
+      return;
+
+    cache_.push_back(std::move(clone));
+  }
 }
 
 }  // namespace tesseract_environment
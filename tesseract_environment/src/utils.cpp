@@ -27,6 +27,12 @@
 #include <tesseract_collision/core/utils.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <iostream>
+#include <iterator>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <limits>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -116,6 +122,17 @@ void checkTrajectoryState(tesseract_collision::ContactResultMap& contact_results
   manager.contactTest(contact_results, contact_request);
 }
 
+void checkTrajectoryState(tesseract_collision::FlatContactResultMap& contact_results,
+                          tesseract_collision::DiscreteContactManager& manager,
+                          const tesseract_common::TransformMap& state,
+                          const tesseract_collision::ContactRequest& contact_request)
+{
+  for (const auto& link_name : manager.getActiveCollisionObjects())
+    manager.setCollisionObjectsTransform(link_name, state.at(link_name));
+
+  manager.contactTest(contact_results, contact_request);
+}
+
 void checkTrajectoryState(tesseract_collision::ContactResultMap& contact_results,
                           tesseract_collision::ContinuousContactManager& manager,
                           const tesseract_common::TransformMap& state,
@@ -127,6 +144,22 @@ void checkTrajectoryState(tesseract_collision::ContactResultMap& contact_results
   manager.contactTest(contact_results, contact_request);
 }
 
+/**
+ * @brief Check a discrete state using the flat results, only copying them to the contact results if there are any
+ * @details Most states are collision free so this avoids the allocations of the ContactResultMap for those states
+ */
+static void checkTrajectoryStateFlat(tesseract_collision::ContactResultMap& contact_results,
+                                     tesseract_collision::FlatContactResultMap& flat_results,
+                                     tesseract_collision::DiscreteContactManager& manager,
+                                     const tesseract_common::TransformMap& state,
+                                     const tesseract_collision::ContactRequest& contact_request)
+{
+  flat_results.clear();
+  checkTrajectoryState(flat_results, manager, state, contact_request);
+  contact_results.clear();
+  flat_results.toContactResultMap(contact_results);
+}
+
 void printContinuousDebugInfo(const std::vector<std::string>& joint_names,
                               const Eigen::VectorXd& swp0,
                               const Eigen::VectorXd& swp1,
@@ -510,13 +543,13 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
   /** @brief Making this thread_local does not help because it is not called enough during planning */
   tesseract_collision::ContactResultMap state_results;
   tesseract_collision::ContactResultMap sub_state_results;
+  tesseract_collision::FlatContactResultMap flat_state_results;
 
   bool found = false;
   if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::START_ONLY)
   {
     tesseract_common::TransformMap state = state_fn(traj.row(0));
-    sub_state_results.clear();
-    tesseract_environment::checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
+    checkTrajectoryStateFlat(sub_state_results, flat_state_results, manager, state, config.contact_request);
 
     if (!sub_state_results.empty())
     {
@@ -534,8 +567,7 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
   if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::END_ONLY)
   {
     tesseract_common::TransformMap state = state_fn(traj.row(traj.rows() - 1));
-    sub_state_results.clear();
-    tesseract_environment::checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
+    checkTrajectoryStateFlat(sub_state_results, flat_state_results, manager, state, config.contact_request);
 
     if (!sub_state_results.empty())
     {
@@ -566,8 +598,7 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
     auto sub_segment_last_index = static_cast<int>(traj.rows() - 1);
     state_results.clear();
     tesseract_common::TransformMap state = state_fn(traj.row(0));
-    sub_state_results.clear();
-    checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
+    checkTrajectoryStateFlat(sub_state_results, flat_state_results, manager, state, config.contact_request);
 
     if (debug_logging)
     {
@@ -640,8 +671,7 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
           }
 
           tesseract_common::TransformMap state = state_fn(subtraj.row(iSubStep));
-          sub_state_results.clear();
-          checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
+          checkTrajectoryStateFlat(sub_state_results, flat_state_results, manager, state, config.contact_request);
           if (!sub_state_results.empty())
           {
             found = true;
@@ -693,8 +723,7 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
               config.check_program_mode != tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
           {
             tesseract_common::TransformMap state = state_fn(traj.row(iStep));
-            sub_state_results.clear();
-            checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
+            checkTrajectoryStateFlat(sub_state_results, flat_state_results, manager, state, config.contact_request);
             if (!sub_state_results.empty())
             {
               found = true;
@@ -719,8 +748,7 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
               config.check_program_mode != tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
           {
             tesseract_common::TransformMap state = state_fn(traj.row(iStep + 1));
-            sub_state_results.clear();
-            checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
+            checkTrajectoryStateFlat(sub_state_results, flat_state_results, manager, state, config.contact_request);
             if (!sub_state_results.empty())
             {
               found = true;
@@ -756,8 +784,7 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
         }
 
         tesseract_common::TransformMap state = state_fn(traj.row(iStep));
-        sub_state_results.clear();
-        checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
+        checkTrajectoryStateFlat(sub_state_results, flat_state_results, manager, state, config.contact_request);
         if (!sub_state_results.empty())
         {
           found = true;
@@ -788,8 +815,7 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
           }
 
           tesseract_common::TransformMap state = state_fn(traj.row(iStep + 1));
-          sub_state_results.clear();
-          checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
+          checkTrajectoryStateFlat(sub_state_results, flat_state_results, manager, state, config.contact_request);
           if (!sub_state_results.empty())
           {
             found = true;
@@ -849,8 +875,7 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
       state_results.clear();
 
       tesseract_common::TransformMap state = state_fn(traj.row(iStep));
-      sub_state_results.clear();
-      checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
+      checkTrajectoryStateFlat(sub_state_results, flat_state_results, manager, state, config.contact_request);
       if (!sub_state_results.empty())
       {
         found = true;
@@ -902,4 +927,212 @@ bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contact
   return checkTrajectory(contacts, manager, state_fn, joint_names, traj, config);
 }
 
+/**
+ * @brief Get the collision check program mode to use for a chunk of the trajectory
+ * @param mode The program mode of the full trajectory
+ * @param first_chunk Indicate if the chunk contains the start of the trajectory
+ * @param last_chunk Indicate if the chunk contains the end of the trajectory
+ * @param discrete Indicate if a discrete contact manager is being used
+ * @return The program mode for the chunk
+ */
+static tesseract_collision::CollisionCheckProgramType
+getChunkProgramMode(tesseract_collision::CollisionCheckProgramType mode,
+                    bool first_chunk,
+                    bool last_chunk,
+                    bool discrete)
+{
+  using tesseract_collision::CollisionCheckProgramType;
+  bool exclude_start = (mode == CollisionCheckProgramType::ALL_EXCEPT_START ||
+                        mode == CollisionCheckProgramType::INTERMEDIATE_ONLY);
+  bool exclude_end =
+      (mode == CollisionCheckProgramType::ALL_EXCEPT_END || mode == CollisionCheckProgramType::INTERMEDIATE_ONLY);
+
+  // Only the first chunk owns the start state and only the last chunk owns the end state. Discrete chunks share their
+  // boundary state with the next chunk, so it is excluded here and checked as the start state of the next chunk.
+  exclude_start = first_chunk && exclude_start;
+  exclude_end = (last_chunk) ? exclude_end : discrete;
+
+  if (exclude_start && exclude_end)
+    return CollisionCheckProgramType::INTERMEDIATE_ONLY;
+
+  if (exclude_start)
+    return CollisionCheckProgramType::ALL_EXCEPT_START;
+
+  if (exclude_end)
+    return CollisionCheckProgramType::ALL_EXCEPT_END;
+
+  return CollisionCheckProgramType::ALL;
+}
+
+/**
+ * @brief Perform a collision check over the trajectory, splitting it into chunks which are checked in parallel
+ * @details Each worker thread owns a clone of the provided manager. Chunks are handed out in trajectory order and the
+ * results are merged in order so the output is identical to the serial checkTrajectory.
+ */
+template <typename ManagerType>
+bool checkTrajectoryParallel(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                             const ManagerType& manager,
+                             const CalcStateFn& state_fn,
+                             const std::vector<std::string>& joint_names,
+                             const tesseract_common::TrajArray& traj,
+                             const tesseract_collision::CollisionCheckConfig& config,
+                             std::size_t num_threads)
+{
+  constexpr bool discrete = std::is_same_v<ManagerType, tesseract_collision::DiscreteContactManager>;
+
+  if (num_threads == 0)
+    num_threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+  const auto num_segments = static_cast<std::size_t>(std::max<Eigen::Index>(0, traj.rows() - 1));
+  if (num_threads == 1 || num_segments < 2 ||
+      config.check_program_mode == tesseract_collision::CollisionCheckProgramType::START_ONLY ||
+      config.check_program_mode == tesseract_collision::CollisionCheckProgramType::END_ONLY)
+  {
+    auto serial_manager = manager.clone();
+    return checkTrajectory(contacts, *serial_manager, state_fn, joint_names, traj, config);
+  }
+
+  // Use more chunks than threads so workers can exit early when ContactTestType::FIRST is used
+  const std::size_t num_chunks = std::min(num_segments, num_threads * 4);
+  num_threads = std::min(num_threads, num_chunks);
+
+  std::vector<std::vector<tesseract_collision::ContactResultMap>> chunk_contacts(num_chunks);
+  std::vector<char> chunk_found(num_chunks, 0);
+
+  const bool stop_on_first = (config.contact_request.type == tesseract_collision::ContactTestType::FIRST);
+  std::atomic<std::size_t> next_chunk{ 0 };
+  std::atomic<std::size_t> first_found_chunk{ std::numeric_limits<std::size_t>::max() };
+
+  std::mutex exception_mutex;
+  std::exception_ptr exception;
+
+  auto worker = [&]() {
+    try
+    {
+      auto worker_manager = manager.clone();
+      for (std::size_t chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++)
+      {
+        // Chunks are handed out in order, so if an earlier chunk is in collision all remaining chunks can be skipped
+        if (stop_on_first && chunk > first_found_chunk.load())
+          break;
+
+        const std::size_t start_segment = (chunk * num_segments) / num_chunks;
+        const std::size_t end_segment = ((chunk + 1) * num_segments) / num_chunks;
+        const auto sub_traj_start = static_cast<Eigen::Index>(start_segment);
+        const auto sub_traj_rows = static_cast<Eigen::Index>(end_segment - start_segment + 1);
+        const tesseract_common::TrajArray sub_traj = traj.middleRows(sub_traj_start, sub_traj_rows);
+
+        tesseract_collision::CollisionCheckConfig chunk_config = config;
+        chunk_config.check_program_mode =
+            getChunkProgramMode(config.check_program_mode, (chunk == 0), (chunk == num_chunks - 1), discrete);
+
+        bool found =
+            checkTrajectory(chunk_contacts[chunk], *worker_manager, state_fn, joint_names, sub_traj, chunk_config);
+        chunk_found[chunk] = static_cast<char>(found);
+
+        if (found && stop_on_first)
+        {
+          std::size_t current = first_found_chunk.load();
+          while (chunk < current && !first_found_chunk.compare_exchange_weak(current, chunk))
+          {
+          }
+        }
+      }
+    }
+    catch (...)
+    {
+      std::scoped_lock lock(exception_mutex);
+      if (!exception)
+        exception = std::current_exception();
+
+      // Make the remaining workers exit
+      next_chunk = num_chunks;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (std::size_t i = 1; i < num_threads; ++i)
+    threads.emplace_back(worker);
+
+  worker();
+
+  for (auto& t : threads)
+    t.join();
+
+  if (exception)
+    std::rethrow_exception(exception);
+
+  contacts.clear();
+  contacts.reserve(static_cast<std::size_t>(traj.rows()));
+
+  bool found = false;
+  for (std::size_t chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    std::move(chunk_contacts[chunk].begin(), chunk_contacts[chunk].end(), std::back_inserter(contacts));
+    found = found || (chunk_found[chunk] != 0);
+
+    if (found && stop_on_first)
+      break;
+  }
+
+  return found;
+}
+
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const tesseract_collision::ContinuousContactManager& manager,
+                     const tesseract_scene_graph::StateSolver& state_solver,
+                     const std::vector<std::string>& joint_names,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     std::size_t num_threads)
+{
+  CalcStateFn state_fn = [&joint_names, &state_solver](const Eigen::VectorXd& state) {
+    return state_solver.getState(joint_names, state).link_transforms;
+  };
+
+  return checkTrajectoryParallel(contacts, manager, state_fn, joint_names, traj, config, num_threads);
+}
+
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const tesseract_collision::ContinuousContactManager& manager,
+                     const tesseract_kinematics::JointGroup& manip,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     std::size_t num_threads)
+{
+  CalcStateFn state_fn = [&manip](const Eigen::VectorXd& state) { return manip.calcFwdKin(state); };
+
+  const std::vector<std::string> joint_names = manip.getJointNames();
+  return checkTrajectoryParallel(contacts, manager, state_fn, joint_names, traj, config, num_threads);
+}
+
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const tesseract_collision::DiscreteContactManager& manager,
+                     const tesseract_scene_graph::StateSolver& state_solver,
+                     const std::vector<std::string>& joint_names,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     std::size_t num_threads)
+{
+  CalcStateFn state_fn = [&joint_names, &state_solver](const Eigen::VectorXd& state) {
+    return state_solver.getState(joint_names, state).link_transforms;
+  };
+
+  return checkTrajectoryParallel(contacts, manager, state_fn, joint_names, traj, config, num_threads);
+}
+
+bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                     const tesseract_collision::DiscreteContactManager& manager,
+                     const tesseract_kinematics::JointGroup& manip,
+                     const tesseract_common::TrajArray& traj,
+                     const tesseract_collision::CollisionCheckConfig& config,
+                     std::size_t num_threads)
+{
+  CalcStateFn state_fn = [&manip](const Eigen::VectorXd& state) { return manip.calcFwdKin(state); };
+
+  const std::vector<std::string> joint_names = manip.getJointNames();
+  return checkTrajectoryParallel(contacts, manager, state_fn, joint_names, traj, config, num_threads);
+}
+
 }  // namespace tesseract_environment
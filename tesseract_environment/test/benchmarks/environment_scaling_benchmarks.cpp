@@ -0,0 +1,324 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <octomap/octomap.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract_scene_graph/graph.h>
+#include <tesseract_scene_graph/link.h>
+#include <tesseract_srdf/srdf_model.h>
+#include <tesseract_state_solver/state_solver.h>
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_geometry/geometries.h>
+#include <tesseract_geometry/mesh_parser.h>
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/environment_cache.h>
+#include <tesseract_environment/commands.h>
+#include <tesseract_common/resource_locator.h>
+#include <tesseract_urdf/urdf_parser.h>
+
+using namespace tesseract_scene_graph;
+using namespace tesseract_collision;
+using namespace tesseract_environment;
+
+/**
+ * @brief Heap usage tracked by the global operator new and delete below
+ * @details Only allocations made through operator new are tracked, memory allocated directly with malloc (for example
+ * Eigen aligned allocations) is not included.
+ */
+static std::atomic<std::size_t> g_allocated_bytes{ 0 };
+static std::atomic<std::size_t> g_allocation_count{ 0 };
+static std::atomic<long long> g_live_bytes{ 0 };
+
+/** @brief The header stores the allocation size and keeps the returned pointer aligned */
+static constexpr std::size_t ALLOCATION_HEADER_SIZE = alignof(std::max_align_t);
+
+void* operator new(std::size_t size)
+{
+  void* ptr = std::malloc(size + ALLOCATION_HEADER_SIZE);  // NOLINT
+  if (ptr == nullptr)
+    throw std::bad_alloc();
+
+  *static_cast<std::size_t*>(ptr) = size;
+  g_allocated_bytes += size;
+  g_allocation_count += 1;
+  g_live_bytes += static_cast<long long>(size);
+  return static_cast<char*>(ptr) + ALLOCATION_HEADER_SIZE;  // NOLINT
+}
+
+void operator delete(void* ptr) noexcept
+{
+  if (ptr == nullptr)
+    return;
+
+  void* base = static_cast<char*>(ptr) - ALLOCATION_HEADER_SIZE;  // NOLINT
+  g_live_bytes -= static_cast<long long>(*static_cast<std::size_t*>(base));
+  std::free(base);  // NOLINT
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept { operator delete(ptr); }
+
+/** @brief Records the heap allocated through operator new between construction and the report */
+class HeapUsage
+{
+public:
+  HeapUsage() : allocated_bytes_(g_allocated_bytes), allocation_count_(g_allocation_count), live_bytes_(g_live_bytes)
+  {
+  }
+
+  /** @brief Add the allocation counters per iteration and the memory retained by the results to the benchmark */
+  void report(benchmark::State& state, long long retained_bytes) const
+  {
+    state.counters["alloc_bytes"] = benchmark::Counter(static_cast<double>(g_allocated_bytes - allocated_bytes_),
+                                                       benchmark::Counter::kAvgIterations,
+                                                       benchmark::Counter::kIs1024);
+    state.counters["allocs"] = benchmark::Counter(static_cast<double>(g_allocation_count - allocation_count_),
+                                                  benchmark::Counter::kAvgIterations);
+    state.counters["retained_bytes"] = benchmark::Counter(
+        static_cast<double>(retained_bytes), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+  }
+
+  /** @brief The number of bytes allocated and not yet freed since construction */
+  long long liveBytes() const { return g_live_bytes - live_bytes_; }
+
+private:
+  std::size_t allocated_bytes_;
+  std::size_t allocation_count_;
+  long long live_bytes_;
+};
+
+/**
+ * @brief Measure the heap retained by the object returned from a function
+ * @param fn The function that creates the object
+ * @return The number of bytes still allocated while the object is alive
+ */
+template <typename Fn>
+long long getRetainedBytes(Fn fn)
+{
+  HeapUsage usage;
+  auto obj = fn();
+  benchmark::DoNotOptimize(obj);
+  return usage.liveBytes();
+}
+
+SceneGraph::Ptr getSceneGraph(const tesseract_common::ResourceLocator& locator)
+{
+  std::string path = "package://tesseract_support/urdf/lbr_iiwa_14_r820.urdf";
+
+  return tesseract_urdf::parseURDFFile(locator.locateResource(path)->getFilePath(), locator);
+}
+
+tesseract_srdf::SRDFModel::Ptr getSRDFModel(const SceneGraph& scene_graph,
+                                            const tesseract_common::ResourceLocator& locator)
+{
+  std::string path = "package://tesseract_support/urdf/lbr_iiwa_14_r820.srdf";
+
+  auto srdf = std::make_shared<tesseract_srdf::SRDFModel>();
+  srdf->initFile(scene_graph, locator.locateResource(path)->getFilePath(), locator);
+
+  return srdf;
+}
+
+/** @brief Create a dense cubic octree with the provided number of cells along each axis */
+tesseract_geometry::Octree::Ptr createOctree(int cells, double resolution)
+{
+  auto octree = std::make_shared<octomap::OcTree>(resolution);
+  for (int x = 0; x < cells; ++x)
+  {
+    for (int y = 0; y < cells; ++y)
+    {
+      for (int z = 0; z < cells; ++z)
+      {
+        octree->updateNode(octomap::point3d(static_cast<float>(x * resolution),
+                                            static_cast<float>(y * resolution),
+                                            static_cast<float>(z * resolution)),
+                           true);
+      }
+    }
+  }
+
+  return std::make_shared<tesseract_geometry::Octree>(octree, tesseract_geometry::OctreeSubType::BOX);
+}
+
+/**
+ * @brief Create an environment from the iiwa URDF with additional workcell links attached to the world
+ * @details Every workcell link has a mesh collision geometry and every eighth link also has an octree.
+ * @param locator The resource locator
+ * @param num_links The number of workcell links to add
+ */
+Environment::Ptr createWorkcellEnvironment(const tesseract_common::ResourceLocator& locator, long num_links)
+{
+  SceneGraph::Ptr scene_graph = getSceneGraph(locator);
+  auto srdf = getSRDFModel(*scene_graph, locator);
+  auto env = std::make_shared<Environment>();
+  env->init(*scene_graph, srdf);
+
+  auto meshes = tesseract_geometry::createMeshFromResource<tesseract_geometry::Mesh>(
+      locator.locateResource("package://tesseract_support/meshes/sphere_p25m.stl"));
+  tesseract_geometry::Octree::Ptr octree = createOctree(10, 0.05);
+
+  Commands commands;
+  for (long i = 0; i < num_links; ++i)
+  {
+    Link link("workcell_link_" + std::to_string(i));
+
+    auto collision = std::make_shared<Collision>();
+    collision->origin.translation() = Eigen::Vector3d(2.0 + static_cast<double>(i % 16) * 0.6,
+                                                      -4.0 + static_cast<double>((i / 16) % 16) * 0.6,
+                                                      static_cast<double>(i / 256) * 0.6);
+    collision->geometry = meshes.front();
+    link.collision.push_back(collision);
+
+    if (i % 8 == 0)
+    {
+      auto octree_collision = std::make_shared<Collision>();
+      octree_collision->origin = collision->origin;
+      octree_collision->geometry = octree;
+      link.collision.push_back(octree_collision);
+    }
+
+    commands.push_back(std::make_shared<AddLinkCommand>(link));
+  }
+
+  if (!commands.empty())
+    env->applyCommands(commands);
+
+  return env;
+}
+
+/** @brief Benchmark that checks the Environment clone method */
+static void BM_ENVIRONMENT_CLONE(benchmark::State& state, Environment::Ptr env)
+{
+  long long retained_bytes = getRetainedBytes([&env]() { return env->clone(); });
+
+  HeapUsage usage;
+  Environment::Ptr clone;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(clone = env->clone());
+  }
+  usage.report(state, retained_bytes);
+}
+
+/** @brief Benchmark that checks getting an environment from the cache when the environment is unchanged */
+static void BM_ENVIRONMENT_CACHE_GET(benchmark::State& state, Environment::Ptr env)
+{
+  DefaultEnvironmentCache cache(env);
+  cache.refreshCache();
+  long long retained_bytes = getRetainedBytes([&cache]() { return cache.getCachedEnvironment(); });
+
+  HeapUsage usage;
+  std::unique_ptr<Environment> cached_env;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(cached_env = cache.getCachedEnvironment());
+  }
+  usage.report(state, retained_bytes);
+}
+
+/** @brief Benchmark that checks getting an environment from the cache right after the environment changed */
+static void BM_ENVIRONMENT_CACHE_GET_AFTER_CHANGE(benchmark::State& state, Environment::Ptr env)
+{
+  Environment::Ptr modified_env = env->clone();
+  DefaultEnvironmentCache cache(modified_env);
+  cache.refreshCache();
+
+  HeapUsage usage;
+  std::unique_ptr<Environment> cached_env;
+  double margin{ 0 };
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    margin = (margin > 0) ? 0 : 0.01;
+    modified_env->applyCommand(std::make_shared<ChangeCollisionMarginsCommand>(margin));
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(cached_env = cache.getCachedEnvironment());
+  }
+  usage.report(state, 0);
+}
+
+/** @brief Benchmark that checks getting an environment from a background refilled cache right after a change */
+static void BM_ENVIRONMENT_BACKGROUND_CACHE_GET_AFTER_CHANGE(benchmark::State& state, Environment::Ptr env)
+{
+  Environment::Ptr modified_env = env->clone();
+  DefaultEnvironmentCache cache(modified_env, 5, true);
+
+  HeapUsage usage;
+  std::unique_ptr<Environment> cached_env;
+  double margin{ 0 };
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    margin = (margin > 0) ? 0 : 0.01;
+    modified_env->applyCommand(std::make_shared<ChangeCollisionMarginsCommand>(margin));
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(cached_env = cache.getCachedEnvironment());
+  }
+  usage.report(state, 0);
+}
+
+/** @brief Benchmark that checks getting a discrete contact manager from the environment */
+static void BM_GET_DISCRETE_CONTACT_MANAGER(benchmark::State& state, Environment::Ptr env)
+{
+  long long retained_bytes = getRetainedBytes([&env]() { return env->getDiscreteContactManager(); });
+
+  HeapUsage usage;
+  DiscreteContactManager::Ptr manager;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(manager = env->getDiscreteContactManager());
+  }
+  usage.report(state, retained_bytes);
+}
+
+/** @brief Benchmark that checks getting a state solver from the environment */
+static void BM_GET_STATE_SOLVER(benchmark::State& state, Environment::Ptr env)
+{
+  long long retained_bytes = getRetainedBytes([&env]() { return env->getStateSolver(); });
+
+  HeapUsage usage;
+  StateSolver::Ptr state_solver;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(state_solver = env->getStateSolver());
+  }
+  usage.report(state, retained_bytes);
+}
+
+int main(int argc, char** argv)
+{
+  tesseract_common::GeneralResourceLocator locator;
+
+  using BenchmarkFunc = std::function<void(benchmark::State&, Environment::Ptr)>;
+  const std::vector<std::pair<std::string, BenchmarkFunc>> benchmarks = {
+    { "BM_ENVIRONMENT_CLONE", BM_ENVIRONMENT_CLONE },
+    { "BM_ENVIRONMENT_CACHE_GET", BM_ENVIRONMENT_CACHE_GET },
+    { "BM_ENVIRONMENT_CACHE_GET_AFTER_CHANGE", BM_ENVIRONMENT_CACHE_GET_AFTER_CHANGE },
+    { "BM_ENVIRONMENT_BACKGROUND_CACHE_GET_AFTER_CHANGE", BM_ENVIRONMENT_BACKGROUND_CACHE_GET_AFTER_CHANGE },
+    { "BM_GET_DISCRETE_CONTACT_MANAGER", BM_GET_DISCRETE_CONTACT_MANAGER },
+    { "BM_GET_STATE_SOLVER", BM_GET_STATE_SOLVER }
+  };
+
+  //////////////////////////////////////
+  // Workcells of increasing size
+  //////////////////////////////////////
+
+  for (long num_links : { 0L, 16L, 64L, 256L })
+  {
+    Environment::Ptr env = createWorkcellEnvironment(locator, num_links);
+    for (const auto& bm : benchmarks)
+    {
+      std::string name = bm.first + "/links:" + std::to_string(num_links);
+      benchmark::RegisterBenchmark(name.c_str(), bm.second, env)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -6,15 +6,18 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <tesseract_urdf/urdf_parser.h>
 #include <tesseract_common/resource_locator.h>
 #include <tesseract_common/utils.h>
+#include <tesseract_common/clone_cache.h>
 #include <tesseract_geometry/impl/box.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_environment/environment.h>
 #include <tesseract_environment/environment_cache.h>
 #include <tesseract_environment/commands/add_link_command.h>
+#include <tesseract_environment/commands/change_collision_margins_command.h>
 
 #include <tesseract_scene_graph/graph.h>
 #include <tesseract_scene_graph/link.h>
+#include <tesseract_scene_graph/scene_state.h>
 
 #include <tesseract_srdf/srdf_model.h>
 
@@ -97,6 +100,100 @@ TEST(TesseractEnvironmentCache, defaultEnvironmentCacheTest)  // NOLINT
   cache.refreshCache();
 }
 
+TEST(TesseractEnvironmentCache, environmentUpdateTest)  // NOLINT
+{
+  tesseract_common::GeneralResourceLocator locator;
+  auto scene_graph = getSceneGraph(locator);
+  EXPECT_TRUE(scene_graph != nullptr);
+
+  auto srdf = getSRDFModel(*scene_graph, locator);
+  EXPECT_TRUE(srdf != nullptr);
+
+  auto env = std::make_shared<Environment>();
+  bool success = env->init(*scene_graph, srdf);
+  EXPECT_TRUE(success);
+
+  Environment::UPtr clone = env->clone();
+  EXPECT_FALSE(clone->update(nullptr));
+
+  // Nothing has changed so this only copies the current state
+  EXPECT_TRUE(clone->update(env));
+  EXPECT_EQ(clone->getRevision(), 3);
+
+  addLink(*env);
+  tesseract_common::CollisionMarginData margin_data(0.1);
+  EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeCollisionMarginsCommand>(margin_data)));
+  env->setState({ "boxbot_x_joint" }, Eigen::VectorXd::Constant(1, 0.5));
+
+  // Only the new commands are applied to the clone
+  EXPECT_TRUE(clone->update(env));
+  EXPECT_EQ(clone->getRevision(), 5);
+  EXPECT_EQ(clone->getCommandHistory(), env->getCommandHistory());
+  EXPECT_TRUE(clone->getLink("link_n1") != nullptr);
+  EXPECT_NEAR(clone->getCollisionMarginData().getDefaultCollisionMargin(), 0.1, 1e-8);
+  EXPECT_NEAR(clone->getState().joints.at("boxbot_x_joint"), 0.5, 1e-8);
+  EXPECT_TRUE(*clone == *env);
+
+  // The clone has diverged from the environment so it can not be updated
+  Environment::UPtr diverged = env->clone();
+  EXPECT_TRUE(diverged->applyCommand(std::make_shared<ChangeCollisionMarginsCommand>(margin_data)));
+  EXPECT_FALSE(diverged->update(env));
+
+  // The clone cache uses the update when the environment changes
+  tesseract_common::CloneCache<Environment> clone_cache(env, 3);
+  EXPECT_TRUE(clone_cache.supports_update);
+  addLink(*env);
+  clone_cache.updateCache();
+  EXPECT_EQ(clone_cache.getCurrentCacheSize(), 3);
+  auto cached_env = clone_cache.clone();
+  EXPECT_EQ(cached_env->getRevision(), env->getRevision());
+}
+
+TEST(TesseractEnvironmentCache, defaultEnvironmentCacheBackgroundRefillTest)  // NOLINT
+{
+  tesseract_common::GeneralResourceLocator locator;
+  auto scene_graph = getSceneGraph(locator);
+  EXPECT_TRUE(scene_graph != nullptr);
+
+  auto srdf = getSRDFModel(*scene_graph, locator);
+  EXPECT_TRUE(srdf != nullptr);
+
+  auto env = std::make_shared<Environment>();
+  bool success = env->init(*scene_graph, srdf);
+  EXPECT_TRUE(success);
+
+  {
+    DefaultEnvironmentCache cache(env, 5, true);
+    EXPECT_TRUE(cache.isBackgroundRefillEnabled());
+    EXPECT_EQ(cache.getCacheSize(), 5);
+    EXPECT_EQ(env->getEventCallbacks().size(), 1);
+
+    for (int i = 0; i < 20; ++i)
+    {
+      Environment::UPtr cached_env = cache.getCachedEnvironment();
+      EXPECT_TRUE(cached_env != nullptr);
+      EXPECT_EQ(cached_env->getRevision(), 3);
+    }
+
+    addLink(*env);
+
+    for (int i = 0; i < 10; ++i)
+    {
+      Environment::UPtr cached_env = cache.getCachedEnvironment();
+      EXPECT_TRUE(cached_env != nullptr);
+      EXPECT_EQ(cached_env->getRevision(), 4);
+      EXPECT_TRUE(cached_env->getLink("link_n1") != nullptr);
+    }
+  }
+
+  // The event callback is removed when the cache is destroyed
+  EXPECT_TRUE(env->getEventCallbacks().empty());
+
+  DefaultEnvironmentCache cache(env, 5, false);
+  EXPECT_FALSE(cache.isBackgroundRefillEnabled());
+  EXPECT_TRUE(env->getEventCallbacks().empty());
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
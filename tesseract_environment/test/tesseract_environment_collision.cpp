@@ -11,6 +11,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_environment/environment.h>
 #include <tesseract_environment/commands/add_link_command.h>
+#include <tesseract_environment/commands/modify_allowed_collisions_command.h>
 
 #include <tesseract_scene_graph/graph.h>
 #include <tesseract_scene_graph/link.h>
@@ -245,6 +246,106 @@ TEST(TesseractEnvironmentCollisionUnit, runEnvironmentClearContinuousCollisionTe
   EXPECT_FALSE(collision.empty());
 }
 
+TEST(TesseractEnvironmentCollisionUnit, runEnvironmentModifyAllowedCollisionsTest)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+
+  ContactRequest request(ContactTestType::ALL);
+  std::vector<std::string> active_links = { "link_n1" };
+
+  DiscreteContactManager::Ptr manager = env->getDiscreteContactManager();
+  manager->setActiveCollisionObjects(active_links);
+  manager->setCollisionMarginData(CollisionMarginData(0.0));
+
+  tesseract_collision::ContactResultMap collision;
+  manager->contactTest(collision, request);
+  ASSERT_FALSE(collision.empty());
+
+  const tesseract_common::LinkNamesPair pair = collision.begin()->first;
+  const std::size_t id1 = manager->registerCollisionObjectId(pair.first);
+  const std::size_t id2 = manager->registerCollisionObjectId(pair.second);
+  collision.clear();
+  manager->contactTest(collision, id1, id2, request);
+  EXPECT_FALSE(collision.empty());
+
+  // Allow every pair in collision on the live environment
+  tesseract_common::AllowedCollisionMatrix acm;
+  manager->contactTest(collision, request);
+  for (const auto& c : collision)
+    acm.addAllowedCollision(c.first.first, c.first.second, "Test");
+
+  EXPECT_TRUE(
+      env->applyCommand(std::make_shared<ModifyAllowedCollisionsCommand>(acm, ModifyAllowedCollisionsType::ADD)));
+
+  // A manager retrieved after the change must not use the previously cached contact allowed state
+  DiscreteContactManager::Ptr new_manager = env->getDiscreteContactManager();
+  new_manager->setActiveCollisionObjects(active_links);
+  new_manager->setCollisionMarginData(CollisionMarginData(0.0));
+  collision.clear();
+  new_manager->contactTest(collision, request);
+  EXPECT_TRUE(collision.empty());
+
+  const std::size_t new_id1 = new_manager->registerCollisionObjectId(pair.first);
+  const std::size_t new_id2 = new_manager->registerCollisionObjectId(pair.second);
+  new_manager->contactTest(collision, new_id1, new_id2, request);
+  EXPECT_TRUE(collision.empty());
+
+  // A manager retrieved before the change uses the changed allowed collision matrix, by name and by id
+  manager->contactTest(collision, request);
+  EXPECT_TRUE(collision.empty());
+  manager->contactTest(collision, id1, id2, request);
+  EXPECT_TRUE(collision.empty());
+
+  // A clone of the environment does not share later changes with the managers of the original
+  auto cloned_env = env->clone();
+  DiscreteContactManager::Ptr cloned_manager = cloned_env->getDiscreteContactManager();
+  cloned_manager->setActiveCollisionObjects(active_links);
+  cloned_manager->setCollisionMarginData(CollisionMarginData(0.0));
+
+  // Remove the allowed collisions again
+  EXPECT_TRUE(
+      env->applyCommand(std::make_shared<ModifyAllowedCollisionsCommand>(acm, ModifyAllowedCollisionsType::REMOVE)));
+
+  DiscreteContactManager::Ptr last_manager = env->getDiscreteContactManager();
+  last_manager->setActiveCollisionObjects(active_links);
+  last_manager->setCollisionMarginData(CollisionMarginData(0.0));
+  for (const auto& m : { manager, new_manager, last_manager })
+  {
+    collision.clear();
+    m->contactTest(collision, request);
+    EXPECT_FALSE(collision.empty());
+  }
+
+  collision.clear();
+  manager->contactTest(collision, id1, id2, request);
+  EXPECT_FALSE(collision.empty());
+  collision.clear();
+  new_manager->contactTest(collision, new_id1, new_id2, request);
+  EXPECT_FALSE(collision.empty());
+
+  collision.clear();
+  cloned_manager->contactTest(collision, request);
+  EXPECT_TRUE(collision.empty());
+
+  // A manager given a different contact allowed function no longer follows the environment
+  manager->setIsContactAllowedFn([](const std::string&, const std::string&) { return false; });
+  EXPECT_TRUE(
+      env->applyCommand(std::make_shared<ModifyAllowedCollisionsCommand>(acm, ModifyAllowedCollisionsType::ADD)));
+  collision.clear();
+  manager->contactTest(collision, request);
+  EXPECT_FALSE(collision.empty());
+  collision.clear();
+  new_manager->contactTest(collision, request);
+  EXPECT_TRUE(collision.empty());
+
+  // The managers stay valid after the environment is destroyed
+  env.reset();
+  collision.clear();
+  new_manager->contactTest(collision, request);
+  EXPECT_TRUE(collision.empty());
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
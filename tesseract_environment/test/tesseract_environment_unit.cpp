@@ -36,6 +36,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_collision/core/types.h>
 
 #include <tesseract_environment/environment.h>
+#include <tesseract_environment/environment_snapshot.h>
 #include <tesseract_environment/command.h>
 #include <tesseract_environment/commands.h>
 #include <tesseract_environment/utils.h>
@@ -2358,6 +2359,87 @@ TEST(TesseractEnvironmentUnit, EnvMultithreadedApplyCommandsTest)  // NOLINT
   }
 }
 
+TEST(TesseractEnvironmentUnit, EnvSnapshotUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+
+  EnvironmentSnapshot::ConstPtr snapshot = env->getSnapshot();
+  EXPECT_TRUE(snapshot->initialized);
+  EXPECT_EQ(snapshot->revision, env->getRevision());
+  EXPECT_EQ(snapshot->init_revision, env->getInitRevision());
+  EXPECT_EQ(*snapshot->joint_names, env->getStateSolver()->getJointNames());
+  EXPECT_EQ(*snapshot->active_joint_names, env->getStateSolver()->getActiveJointNames());
+  EXPECT_EQ(*snapshot->link_names, env->getStateSolver()->getLinkNames());
+  EXPECT_EQ(*snapshot->active_link_names, env->getStateSolver()->getActiveLinkNames());
+  EXPECT_EQ(*snapshot->static_link_names, env->getStateSolver()->getStaticLinkNames());
+  EXPECT_EQ(snapshot->state, env->getStateSolver()->getState());
+
+  // Changing the state publishes a new snapshot which shares the data that only changes with the revision
+  const std::vector<std::string> joint_names = env->getActiveJointNames();
+  env->setState(joint_names, Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.1));
+  EnvironmentSnapshot::ConstPtr state_snapshot = env->getSnapshot();
+  EXPECT_NE(snapshot, state_snapshot);
+  EXPECT_EQ(snapshot->revision, state_snapshot->revision);
+  EXPECT_EQ(snapshot->link_names, state_snapshot->link_names);
+  EXPECT_EQ(snapshot->compiled_acm, state_snapshot->compiled_acm);
+  EXPECT_NEAR(state_snapshot->state.joints.at(joint_names[0]), 0.1, 1e-8);
+  EXPECT_NEAR(snapshot->state.joints.at(joint_names[0]), 0, 1e-8);
+  EXPECT_TRUE(env->getCurrentJointValues().isApprox(Eigen::VectorXd::Constant(7, 0.1), 1e-8));
+  EXPECT_TRUE(env->getLinkTransform("tool0").isApprox(state_snapshot->state.link_transforms.at("tool0"), 1e-8));
+
+  // Applying a command publishes a new snapshot with a new revision
+  EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeCollisionMarginsCommand>(0.5)));
+  EnvironmentSnapshot::ConstPtr command_snapshot = env->getSnapshot();
+  EXPECT_EQ(command_snapshot->revision, state_snapshot->revision + 1);
+  EXPECT_NE(command_snapshot->collision_margin_data, state_snapshot->collision_margin_data);
+  EXPECT_NEAR(command_snapshot->collision_margin_data->getDefaultCollisionMargin(), 0.5, 1e-8);
+  EXPECT_NEAR(env->getCollisionMarginData().getDefaultCollisionMargin(), 0.5, 1e-8);
+  EXPECT_NEAR(command_snapshot->state.joints.at(joint_names[0]), 0.1, 1e-8);
+
+  // Links and joints are read from the snapshot
+  EXPECT_EQ(snapshot->links, state_snapshot->links);
+  EXPECT_EQ(snapshot->joints, state_snapshot->joints);
+  EXPECT_EQ(command_snapshot->links->size(), env->getSceneGraph()->getLinks().size());
+  EXPECT_EQ(command_snapshot->joints->size(), env->getSceneGraph()->getJoints().size());
+  EXPECT_EQ(env->getLink("tool0"), env->getSceneGraph()->getLink("tool0"));
+  EXPECT_EQ(env->getJoint(joint_names[0]), env->getSceneGraph()->getJoint(joint_names[0]));
+  EXPECT_EQ(env->getLink("does_not_exist"), nullptr);
+  EXPECT_EQ(env->getJoint("does_not_exist"), nullptr);
+
+  // A clone reports the links and joints owned by its own scene graph
+  auto cloned_env = env->clone();
+  EXPECT_NE(cloned_env->getLink("tool0"), env->getLink("tool0"));
+  EXPECT_EQ(cloned_env->getLink("tool0"), cloned_env->getSceneGraph()->getLink("tool0"));
+  EXPECT_EQ(cloned_env->getJoint(joint_names[0]), cloned_env->getSceneGraph()->getJoint(joint_names[0]));
+
+  // Readers always see a consistent state while the state is being changed
+#pragma omp parallel for num_threads(4) shared(env)
+  for (long i = 0; i < 4; ++i)  // NOLINT
+  {
+    for (int idx = 0; idx < 100; idx++)
+    {
+      if (i == 0)
+      {
+        const double value = 0.001 * idx;
+        env->setState(joint_names, Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), value));
+        continue;
+      }
+
+      EnvironmentSnapshot::ConstPtr read_snapshot = env->getSnapshot();
+      const double value = read_snapshot->state.joints.at(joint_names[0]);
+      for (const auto& joint_name : joint_names)
+        EXPECT_NEAR(read_snapshot->state.joints.at(joint_name), value, 1e-12);
+    }
+  }
+
+  env->clear();
+  EXPECT_FALSE(env->getSnapshot()->initialized);
+  EXPECT_TRUE(env->getLinkNames().empty());
+  EXPECT_EQ(env->getLink("tool0"), nullptr);
+  EXPECT_TRUE(command_snapshot->initialized);
+}
+
 TEST(TesseractEnvironmentUnit, EnvClone)  // NOLINT
 {
   // Get the environment
@@ -4669,6 +4751,158 @@ TEST(TesseractEnvironmentUnit, checkTrajectoryUnit)  // NOLINT
   }
 }
 
+TEST(TesseractEnvironmentUnit, checkTrajectoryParallelUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+
+  // Add sphere to environment
+  Link link_sphere("sphere_attached");
+
+  Visual::Ptr visual = std::make_shared<Visual>();
+  visual->origin = Eigen::Isometry3d::Identity();
+  visual->origin.translation() = Eigen::Vector3d(0.5, 0, 0.55);
+  visual->geometry = std::make_shared<tesseract_geometry::Sphere>(0.15);
+  link_sphere.visual.push_back(visual);
+
+  Collision::Ptr collision = std::make_shared<Collision>();
+  collision->origin = visual->origin;
+  collision->geometry = visual->geometry;
+  link_sphere.collision.push_back(collision);
+
+  Joint joint_sphere("joint_sphere_attached");
+  joint_sphere.parent_link_name = "base_link";
+  joint_sphere.child_link_name = link_sphere.getName();
+  joint_sphere.type = JointType::FIXED;
+
+  EXPECT_TRUE(env->applyCommand(std::make_shared<tesseract_environment::AddLinkCommand>(link_sphere, joint_sphere)));
+
+  auto joint_group = env->getJointGroup("manipulator");
+  std::vector<std::string> joint_names = joint_group->getJointNames();
+
+  Eigen::VectorXd joint_start_pos(7);
+  joint_start_pos << -0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  Eigen::VectorXd joint_end_pos(7);
+  joint_end_pos << 0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  // Intermediate states are in collision
+  tesseract_common::TrajArray traj(21, joint_start_pos.size());
+  for (int i = 0; i < joint_start_pos.size(); ++i)
+    traj.col(i) = Eigen::VectorXd::LinSpaced(21, joint_start_pos(i), joint_end_pos(i));
+
+  auto discrete_manager = env->getDiscreteContactManager();
+  auto continuous_manager = env->getContinuousContactManager();
+  auto state_solver = env->getStateSolver();
+
+  auto compareContacts = [](const std::vector<tesseract_collision::ContactResultMap>& serial,
+                            const std::vector<tesseract_collision::ContactResultMap>& parallel) {
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (std::size_t i = 0; i < serial.size(); ++i)
+    {
+      EXPECT_EQ(serial[i].size(), parallel[i].size());
+      EXPECT_EQ(serial[i].count(), parallel[i].count());
+      for (const auto& pair : serial[i])
+      {
+        auto it = parallel[i].find(pair.first);
+        ASSERT_TRUE(it != parallel[i].end());
+        ASSERT_EQ(pair.second.size(), it->second.size());
+        for (std::size_t j = 0; j < pair.second.size(); ++j)
+        {
+          const tesseract_collision::ContactResult& expected = pair.second[j];
+          const tesseract_collision::ContactResult& result = it->second[j];
+          EXPECT_EQ(expected.link_names, result.link_names);
+          EXPECT_NEAR(expected.distance, result.distance, 1e-6);
+          EXPECT_LT((expected.nearest_points[0] - result.nearest_points[0]).norm(), 1e-6);
+          EXPECT_LT((expected.nearest_points[1] - result.nearest_points[1]).norm(), 1e-6);
+          EXPECT_NEAR(expected.cc_time[0], result.cc_time[0], 1e-6);
+          EXPECT_NEAR(expected.cc_time[1], result.cc_time[1], 1e-6);
+        }
+      }
+    }
+  };
+
+  using tesseract_environment::checkTrajectory;
+
+  const std::vector<CollisionCheckProgramType> modes{ CollisionCheckProgramType::ALL,
+                                                      CollisionCheckProgramType::ALL_EXCEPT_START,
+                                                      CollisionCheckProgramType::ALL_EXCEPT_END,
+                                                      CollisionCheckProgramType::START_ONLY,
+                                                      CollisionCheckProgramType::END_ONLY,
+                                                      CollisionCheckProgramType::INTERMEDIATE_ONLY };
+
+  const std::vector<tesseract_collision::ContactTestType> test_types{ tesseract_collision::ContactTestType::ALL,
+                                                                      tesseract_collision::ContactTestType::FIRST };
+
+  for (const auto& test_type : test_types)
+  {
+    for (const auto& mode : modes)
+    {
+      for (const auto& type : { CollisionEvaluatorType::DISCRETE, CollisionEvaluatorType::LVS_DISCRETE })
+      {
+        tesseract_collision::CollisionCheckConfig config;
+        config.type = type;
+        config.check_program_mode = mode;
+        config.contact_request.type = test_type;
+        config.longest_valid_segment_length = 0.01;
+
+        std::vector<tesseract_collision::ContactResultMap> serial_contacts;
+        std::vector<tesseract_collision::ContactResultMap> parallel_contacts;
+        bool serial_found =
+            checkTrajectory(serial_contacts, *discrete_manager, *state_solver, joint_names, traj, config);
+        bool parallel_found =
+            checkTrajectory(parallel_contacts, *discrete_manager, *state_solver, joint_names, traj, config, 4);
+        EXPECT_EQ(serial_found, parallel_found);
+        compareContacts(serial_contacts, parallel_contacts);
+
+        parallel_contacts.clear();
+        parallel_found = checkTrajectory(parallel_contacts, *discrete_manager, *joint_group, traj, config, 4);
+        EXPECT_EQ(serial_found, parallel_found);
+        compareContacts(serial_contacts, parallel_contacts);
+      }
+
+      for (const auto& type : { CollisionEvaluatorType::CONTINUOUS, CollisionEvaluatorType::LVS_CONTINUOUS })
+      {
+        tesseract_collision::CollisionCheckConfig config;
+        config.type = type;
+        config.check_program_mode = mode;
+        config.contact_request.type = test_type;
+        config.longest_valid_segment_length = 0.01;
+
+        std::vector<tesseract_collision::ContactResultMap> serial_contacts;
+        std::vector<tesseract_collision::ContactResultMap> parallel_contacts;
+        bool serial_found =
+            checkTrajectory(serial_contacts, *continuous_manager, *state_solver, joint_names, traj, config);
+        bool parallel_found =
+            checkTrajectory(parallel_contacts, *continuous_manager, *state_solver, joint_names, traj, config, 4);
+        EXPECT_EQ(serial_found, parallel_found);
+        compareContacts(serial_contacts, parallel_contacts);
+
+        parallel_contacts.clear();
+        parallel_found = checkTrajectory(parallel_contacts, *continuous_manager, *joint_group, traj, config, 4);
+        EXPECT_EQ(serial_found, parallel_found);
+        compareContacts(serial_contacts, parallel_contacts);
+      }
+    }
+  }
+
+  // Failures are propagated from the worker threads
+  {
+    tesseract_collision::CollisionCheckConfig config;
+    config.type = CollisionEvaluatorType::CONTINUOUS;
+    std::vector<tesseract_collision::ContactResultMap> contacts;
+    // NOLINTNEXTLINE
+    EXPECT_ANY_THROW(checkTrajectory(contacts, *discrete_manager, *state_solver, joint_names, traj, config, 4));
+  }
+  {
+    tesseract_collision::CollisionCheckConfig config;
+    config.type = CollisionEvaluatorType::DISCRETE;
+    std::vector<tesseract_collision::ContactResultMap> contacts;
+    // NOLINTNEXTLINE
+    EXPECT_ANY_THROW(checkTrajectory(contacts, *continuous_manager, *joint_group, traj, config, 4));
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
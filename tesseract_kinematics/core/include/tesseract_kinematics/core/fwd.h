@@ -32,7 +32,9 @@ class ForwardKinematics;
 class InverseKinematics;
 class JointGroup;
 struct KinGroupIKInput;
+struct KinGroupIKHandle;
 class KinematicGroup;
+class IKSolutionCache;
 class InvKinFactory;
 class FwdKinFactory;
 class KinematicsPluginFactory;
@@ -0,0 +1,181 @@
+/**
+ * @file ik_solution_cache.h
+ * @brief A least recently used cache of inverse kinematics solutions keyed by quantized target poses.
+ *
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_KINEMATICS_IK_SOLUTION_CACHE_H
+#define TESSERACT_KINEMATICS_IK_SOLUTION_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/eigen_types.h>
+#include <tesseract_kinematics/core/types.h>
+
+namespace tesseract_kinematics
+{
+/**
+ * @brief A thread safe least recently used cache of inverse kinematics solutions
+ * @details Entries are stored per set of tip link poses, where the poses are expressed in the inverse kinematics solver
+ * working frame. Each pose is quantized using the translation and rotation resolution to find the entry, and the entry
+ * also stores the exact poses it was solved for. A lookup is a hit when the exact poses match and a near hit when only
+ * the quantized poses match, in which case the cached solutions are only suitable as a seed.
+ *
+ * The solutions are only valid for the solver which produced them, so a cache is bound to the first solver identity it
+ * is used with and rejects any other solver until it is cleared. Lookups and insertions also provide the solver
+ * identity, so a solver which still holds the cache after it was cleared and bound to another solver always misses
+ * and never inserts.
+ *
+ * The tip link names are assigned an index the first time they are inserted, so creating the lookup key does not copy
+ * any strings and does not allocate once the thread has performed a lookup with the same number of tip links.
+ */
+class IKSolutionCache
+{
+public:
+  using Ptr = std::shared_ptr<IKSolutionCache>;
+  using ConstPtr = std::shared_ptr<const IKSolutionCache>;
+  using UPtr = std::unique_ptr<IKSolutionCache>;
+  using ConstUPtr = std::unique_ptr<const IKSolutionCache>;
+
+  /** @brief The result of a cache lookup */
+  enum class Result
+  {
+    MISS,
+    NEAR_HIT,
+    HIT
+  };
+
+  /**
+   * @brief Construct a cache
+   * @param capacity The maximum number of entries, the least recently used entry is evicted when it is exceeded
+   * @param translation_resolution The quantization of the translation in meters
+   * @param rotation_resolution The quantization of the rotation as a unit quaternion component
+   */
+  IKSolutionCache(std::size_t capacity, double translation_resolution = 1e-3, double rotation_resolution = 1e-3);
+
+  /**
+   * @brief Find the solutions of the tip link poses
+   * @param solutions Populated with the cached solutions on a hit or a near hit
+   * @param tip_link_poses The tip link poses relative to the inverse kinematics solver working frame
+   * @param solver_id The identity of the solver, this is a miss if it is not the identity the cache is bound to
+   * @return The result of the lookup
+   */
+  Result find(IKSolutions& solutions, const tesseract_common::TransformMap& tip_link_poses, std::size_t solver_id = 0);
+
+  /**
+   * @brief Store the solutions of the tip link poses, replacing an entry with the same quantized poses
+   * @param tip_link_poses The tip link poses relative to the inverse kinematics solver working frame
+   * @param solutions The solutions of the tip link poses
+   * @param solver_id The identity of the solver, nothing is stored if it is not the identity the cache is bound to
+   */
+  void insert(const tesseract_common::TransformMap& tip_link_poses, IKSolutions solutions, std::size_t solver_id = 0);
+
+  /**
+   * @brief Bind the cache to a solver identity
+   * @details This will throw if the cache is already bound to a different solver identity
+   * @param solver_id The identity of the solver, must not be zero
+   */
+  void bindSolver(std::size_t solver_id);
+
+  /**
+   * @brief Get the identity of the solver the cache is bound to
+   * @return The solver identity, zero if the cache is not bound
+   */
+  std::size_t getSolverId() const;
+
+  /**
+   * @brief Remove all entries and the solver binding, the hit and miss counters are not reset
+   * @details Until the cache is bound again only lookups and insertions without a solver identity are accepted
+   */
+  void clear();
+
+  /** @brief Reset the hit and miss counters */
+  void resetCounters();
+
+  /** @brief The number of entries */
+  std::size_t size() const;
+
+  /** @brief The maximum number of entries */
+  std::size_t capacity() const;
+
+  /** @brief The number of lookups where the exact poses were found */
+  std::size_t getHits() const;
+
+  /** @brief The number of lookups where only the quantized poses were found */
+  std::size_t getNearHits() const;
+
+  /** @brief The number of lookups where the quantized poses were not found */
+  std::size_t getMisses() const;
+
+private:
+  /** @brief For each tip link ordered by index, the tip link index followed by the quantized pose */
+  struct Key
+  {
+    std::vector<long long> values;
+
+    bool operator==(const Key& other) const;
+  };
+
+  struct KeyHash
+  {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  struct Entry
+  {
+    Key key;
+    tesseract_common::TransformMap tip_link_poses;
+    IKSolutions solutions;
+  };
+
+  std::size_t capacity_;
+  double translation_resolution_;
+  double rotation_resolution_;
+  std::size_t solver_id_{ 0 };
+  std::list<Entry> entries_; /**< @brief The entries ordered from most to least recently used */
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> lookup_;
+  std::unordered_map<std::string, long long> tip_link_indices_;
+  std::size_t hits_{ 0 };
+  std::size_t near_hits_{ 0 };
+  std::size_t misses_{ 0 };
+  mutable std::mutex mutex_;
+
+  /**
+   * @brief Quantize the tip link poses, this must be called while holding the mutex
+   * @param key The key to populate, its memory is reused
+   * @param tip_link_poses The tip link poses relative to the inverse kinematics solver working frame
+   * @param add_tip_links If true unknown tip links are assigned an index, otherwise they fail the key creation
+   * @return False if a tip link is unknown and add_tip_links is false, otherwise true
+   */
+  bool createKey(Key& key, const tesseract_common::TransformMap& tip_link_poses, bool add_tip_links);
+};
+
+}  // namespace tesseract_kinematics
+
+#endif  // TESSERACT_KINEMATICS_IK_SOLUTION_CACHE_H
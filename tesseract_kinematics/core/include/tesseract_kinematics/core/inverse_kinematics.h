@@ -75,6 +75,19 @@ public:
   virtual IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                                  const Eigen::Ref<const Eigen::VectorXd>& seed) const = 0;
 
+  /**
+   * @brief Calculates joint solutions given the pose of the single tip link
+   * @details This gives the same solutions as calcInvKin with a map holding the pose of the tip link, but the solutions
+   * are written into the provided vector so solvers which override this can reuse its memory. The default
+   * implementation builds the map and calls calcInvKin. This will throw if the solver has more than one tip link.
+   * @param solutions Populated with the solutions, if empty it failed to find a solution (including uninitialized)
+   * @param tip_link_pose The pose of the tip link relative to the working frame
+   * @param seed Vector of seed joint angles (size must match number of joints in kinematic object)
+   */
+  virtual void calcInvKin(IKSolutions& solutions,
+                          const Eigen::Isometry3d& tip_link_pose,
+                          const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+
   /**
    * @brief Get list of joint names for kinematic object
    * @return A vector of joint names, joint_list_
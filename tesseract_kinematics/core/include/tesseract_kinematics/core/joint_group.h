@@ -53,6 +53,26 @@ public:
   using UPtr = std::unique_ptr<JointGroup>;
   using ConstUPtr = std::unique_ptr<const JointGroup>;
 
+  /**
+   * @brief Memory used by the batched kinematics calls
+   * @details Passing the same workspace to repeated calls avoids allocating it on every call. A workspace must not be
+   * shared between threads.
+   */
+  struct Workspace
+  {
+    /** @brief The joint angles reordered for the state solver */
+    tesseract_common::TrajArray solver_joint_angles;
+
+    /** @brief The link transforms of every state solver link */
+    tesseract_common::VectorIsometry3d solver_link_transforms;
+
+    /** @brief The joint values reordered for the state solver */
+    Eigen::VectorXd solver_joint_values;
+
+    /** @brief The jacobians with columns in the order of the state solver */
+    Eigen::MatrixXd solver_jacobians;
+  };
+
   virtual ~JointGroup();
   JointGroup(const JointGroup& other);
   JointGroup& operator=(const JointGroup& other);
@@ -79,6 +99,30 @@ public:
    */
   tesseract_common::TransformMap calcFwdKin(const Eigen::Ref<const Eigen::VectorXd>& joint_angles) const;
 
+  /**
+   * @brief Calculates the link transforms for a set of joint states
+   * @details The link transforms are stored state by state in the order of getLinkNames, so the transform of link j
+   * for state i is located at i * getLinkNames().size() + j. The vector is only resized if it does not already have
+   * the required size.
+   * @param link_transforms The link transforms to populate
+   * @param joint_angles The joint angles where each row is a state (columns must match number of joints)
+   */
+  void calcFwdKin(tesseract_common::VectorIsometry3d& link_transforms,
+                  const Eigen::Ref<const tesseract_common::TrajArray>& joint_angles) const;
+
+  /**
+   * @brief Calculates the link transforms for a set of joint states using the provided workspace
+   * @details This is the same as the overload without a workspace but does not allocate when the workspace is reused
+   * for the same number of states, provided the state solver's getStates does not allocate as is the case for the
+   * KDL and OFKT state solvers.
+   * @param link_transforms The link transforms to populate
+   * @param joint_angles The joint angles where each row is a state (columns must match number of joints)
+   * @param workspace The workspace to use for intermediate results
+   */
+  void calcFwdKin(tesseract_common::VectorIsometry3d& link_transforms,
+                  const Eigen::Ref<const tesseract_common::TrajArray>& joint_angles,
+                  Workspace& workspace) const;
+
   /**
    * @brief Calculated jacobian of robot given joint angles
    * @param joint_angles Input vector of joint angles
@@ -122,6 +166,40 @@ public:
                                const std::string& link_name,
                                const Eigen::Vector3d& link_point) const;
 
+  /**
+   * @brief Calculate the jacobians of multiple links given joint angles
+   * @details The link transforms are only calculated once for all links
+   * @param jacobians The jacobians to populate where rows 6 * i to 6 * i + 5 are the jacobian of link i relative to the
+   * joint group base link, this must be 6 * link_names.size() by numJoints()
+   * @param joint_angles Input vector of joint angles
+   * @param link_names The frames that the jacobians are calculated for
+   * @param link_points The points on each link that the jacobians are calculated for. If empty the jacobians are
+   * calculated at the link origins, otherwise it must be the same size as link_names.
+   */
+  void calcJacobians(Eigen::Ref<Eigen::MatrixXd> jacobians,
+                     const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
+                     const std::vector<std::string>& link_names,
+                     const tesseract_common::VectorVector3d& link_points = {}) const;
+
+  /**
+   * @brief Calculate the jacobians of multiple links given joint angles using the provided workspace
+   * @details This is the same as the overload without a workspace but does not allocate when the workspace is reused
+   * for the same number of links, provided the state solver's getJacobians does not allocate as is the case for the
+   * KDL and OFKT state solvers.
+   * @param jacobians The jacobians to populate where rows 6 * i to 6 * i + 5 are the jacobian of link i relative to the
+   * joint group base link, this must be 6 * link_names.size() by numJoints()
+   * @param joint_angles Input vector of joint angles
+   * @param link_names The frames that the jacobians are calculated for
+   * @param link_points The points on each link that the jacobians are calculated for. If empty the jacobians are
+   * calculated at the link origins, otherwise it must be the same size as link_names.
+   * @param workspace The workspace to use for intermediate results
+   */
+  void calcJacobians(Eigen::Ref<Eigen::MatrixXd> jacobians,
+                     const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
+                     const std::vector<std::string>& link_names,
+                     const tesseract_common::VectorVector3d& link_points,
+                     Workspace& workspace) const;
+
   /**
    * @brief Get list of joint names for kinematic object
    * @return A vector of joint names
@@ -212,6 +290,7 @@ protected:
   tesseract_common::KinematicLimits limits_;
   std::vector<Eigen::Index> redundancy_indices_;
   std::vector<Eigen::Index> jacobian_map_;
+  std::vector<Eigen::Index> link_state_map_; /**< @brief The state solver link index of each link, -1 if static */
 };
 
 }  // namespace tesseract_kinematics
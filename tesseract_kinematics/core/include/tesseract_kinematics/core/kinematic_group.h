@@ -38,6 +38,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 namespace tesseract_kinematics
 {
 class InverseKinematics;
+class IKSolutionCache;
 /**
  * @brief Structure containing the data required to solve inverse kinematics
  * @details This structure provides the ability to specify IK targets for arbitrary tool links and defined with respect
@@ -72,6 +73,41 @@ struct KinGroupIKInput
 };
 using KinGroupIKInputs = tesseract_common::AlignedVector<KinGroupIKInput>;
 
+/**
+ * @brief A precompiled inverse kinematics request for a fixed working frame and tip link
+ * @details This is created by KinematicGroup::createIKHandle, which resolves the frames and their static
+ * transformations once so each KinematicGroup::calcInvKin call using the handle only requires the target pose and seed.
+ * The handle holds the reusable buffers of the request, so it must not be used by multiple threads at the same time,
+ * and it must only be used with the kinematic group that created it or a copy of that kinematic group.
+ */
+struct KinGroupIKHandle
+{
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  /** @brief The link name the target poses are relative to */
+  std::string working_frame;
+
+  /** @brief The tip link name the target poses are for */
+  std::string tip_link_name;
+
+  /** @brief The transformation from the inverse kinematics solver working frame to the working frame */
+  Eigen::Isometry3d wf_to_user_wf{ Eigen::Isometry3d::Identity() };
+
+  /** @brief The transformation from the tip link to the inverse kinematics solver tip link */
+  Eigen::Isometry3d user_tl_to_tl{ Eigen::Isometry3d::Identity() };
+
+  /** @brief The inverse kinematics solver input which contains the solver tip link */
+  tesseract_common::TransformMap ik_inputs;
+
+  /** @brief The seed in the inverse kinematics solver joint order */
+  Eigen::VectorXd ordered_seed;
+
+  /** @brief The buffer used to reorder the solutions into the kinematic group joint order */
+  Eigen::VectorXd ordered_solution;
+};
+
 class KinematicGroup : public JointGroup
 {
 public:
@@ -105,7 +141,8 @@ public:
 
   /**
    * @brief Calculates joint solutions given a pose.
-   * @details If redundant solutions are needed see utility function getRedundantSolutions.
+   * @details If redundant solutions are needed see utility function getRedundantSolutions. If an inverse kinematics
+   * cache is set, an exact hit returns the cached solutions and the seed is ignored (see setIKCache).
    * @param tip_link_poses The input information to solve inverse kinematics for. There must be an input for each link
    * provided in getTipLinkNames
    * @param seed Vector of seed joint angles (size must match number of joints in robot chain)
@@ -115,7 +152,8 @@ public:
 
   /**
    * @brief Calculates joint solutions given a pose.
-   * @details If redundant solutions are needed see utility function getRedundantSolutions.
+   * @details If redundant solutions are needed see utility function getRedundantSolutions. If an inverse kinematics
+   * cache is set, an exact hit returns the cached solutions and the seed is ignored (see setIKCache).
    * @param tip_link_pose The input information to solve inverse kinematics for. This is a convenience function for
    * when only one tip link exists
    * @param seed Vector of seed joint angles (size must match number of joints in robot chain)
@@ -123,6 +161,46 @@ public:
    */
   IKSolutions calcInvKin(const KinGroupIKInput& tip_link_pose, const Eigen::Ref<const Eigen::VectorXd>& seed) const;
 
+  /**
+   * @brief Create a precompiled inverse kinematics request
+   * @details This is only supported when the inverse kinematics solver has a single tip link
+   * @param working_frame The link name the target poses are relative to, this must be listed in
+   * getAllValidWorkingFrames()
+   * @param tip_link_name The tip link name, this must be listed in getAllPossibleTipLinkNames()
+   * @return The inverse kinematics request handle
+   */
+  KinGroupIKHandle createIKHandle(const std::string& working_frame, const std::string& tip_link_name) const;
+
+  /**
+   * @brief Calculates joint solutions given a pose using a precompiled inverse kinematics request
+   * @details This gives the same solutions as calcInvKin with a KinGroupIKInput but it does not look up any frames
+   * and it reuses the buffers of the handle. If an inverse kinematics cache is set, an exact hit returns the cached
+   * solutions and the seed is ignored (see setIKCache).
+   * @param handle The inverse kinematics request created by createIKHandle
+   * @param pose The target pose of the handle tip link relative to the handle working frame
+   * @param seed Vector of seed joint angles (size must match number of joints in robot chain)
+   * @return A vector of solutions, If empty it failed to find a solution (including uninitialized)
+   */
+  IKSolutions calcInvKin(KinGroupIKHandle& handle,
+                         const Eigen::Isometry3d& pose,
+                         const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+
+  /**
+   * @brief Calculates joint solutions given a pose using a precompiled inverse kinematics request
+   * @details This is the same as the overload returning the solutions, but the solutions are written into the provided
+   * vector. Without an inverse kinematics cache the pose is passed to InverseKinematics::calcInvKin with a single tip
+   * link pose, so solvers which override it (e.g. OPW) reuse the memory of the provided solutions. With a cache the
+   * solutions are copied from or into the cache.
+   * @param solutions Populated with the solutions, if empty it failed to find a solution (including uninitialized)
+   * @param handle The inverse kinematics request created by createIKHandle
+   * @param pose The target pose of the handle tip link relative to the handle working frame
+   * @param seed Vector of seed joint angles (size must match number of joints in robot chain)
+   */
+  void calcInvKin(IKSolutions& solutions,
+                  KinGroupIKHandle& handle,
+                  const Eigen::Isometry3d& pose,
+                  const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+
   /** @brief Returns all possible working frames in which goal poses can be defined
    * @details The inverse kinematics solver requires that all poses be defined relative to a single working frame.
    * However if this working frame is static, a pose can be defined in another static frame in the environment and
@@ -143,6 +221,26 @@ public:
    */
   std::vector<std::string> getAllPossibleTipLinkNames() const;
 
+  /**
+   * @brief Set the cache used to store the inverse kinematics solver results
+   * @details On a hit the solver is skipped and on a near hit the cached solution is used as the solver seed instead of
+   * the provided seed. A hit ignores the provided seed, so for a solver whose solutions depend on the seed (e.g.
+   * numerical solvers) a hit returns the solutions found from the seed used when the entry was stored. The solver
+   * results are cached before they are harmonized and filtered by the joint limits, so the cache remains valid when the
+   * limits change. Failed solves are not cached. Copies of this kinematic group share the cache and the solver
+   * identity. The cache is bound to the solver identity of this kinematic group, so this will throw if the cache is
+   * used by a different kinematic group, including one rebuilt for the same manipulator. Once the cache is cleared,
+   * this kinematic group misses and does not insert until setIKCache is called again.
+   * @param cache The cache, if nullptr caching is disabled
+   */
+  void setIKCache(std::shared_ptr<IKSolutionCache> cache);
+
+  /**
+   * @brief Get the cache used to store the inverse kinematics solver results
+   * @return The cache, nullptr if caching is disabled
+   */
+  std::shared_ptr<IKSolutionCache> getIKCache() const;
+
 private:
   std::vector<std::string> joint_names_;
   bool reorder_required_{ false };
@@ -151,6 +249,23 @@ private:
   Eigen::Isometry3d inv_to_fwd_base_{ Eigen::Isometry3d::Identity() };
   std::vector<std::string> working_frames_;
   std::unordered_map<std::string, std::string> inv_tip_links_map_;
+  std::shared_ptr<IKSolutionCache> ik_cache_;
+  std::size_t solver_id_{ 0 }; /**< @brief Identifies the solver of this kinematic group and its copies */
+
+  /**
+   * @brief Solve inverse kinematics for poses in the solver working frame, returning the solver results
+   * @param ik_inputs The solver tip link poses relative to the solver working frame
+   * @param solver_seed The seed in the solver joint order
+   */
+  IKSolutions calcSolverInvKin(const tesseract_common::TransformMap& ik_inputs,
+                               const Eigen::Ref<const Eigen::VectorXd>& solver_seed) const;
+
+  /**
+   * @brief Reorder the solver results into the group joint order, harmonize them and remove those outside the limits
+   * @param solutions The solver results which are filtered in place
+   * @param ordered_solution The buffer used to reorder the solutions
+   */
+  void filterSolutions(IKSolutions& solutions, Eigen::VectorXd& ordered_solution) const;
 };
 
 }  // namespace tesseract_kinematics
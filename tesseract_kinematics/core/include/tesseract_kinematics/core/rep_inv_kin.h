@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_scene_graph/fwd.h>
 #include <tesseract_kinematics/core/inverse_kinematics.h>
+#include <tesseract_kinematics/core/utils.h>
 
 namespace tesseract_kinematics
 {
@@ -46,7 +47,7 @@ class ForwardKinematics;
  * In this kinematic arrangement the base link is the tip link of the external positioner and the tip link is the
  * tip link of the manipulator. Therefore all provided target poses are expected to the tip link of the positioner.
  */
-class REPInvKin : public InverseKinematics
+class REPInvKin : public InverseKinematics, public PositionerSamplingSettings
 {
 public:
   // LCOV_EXCL_START
@@ -102,6 +103,7 @@ public:
             const Eigen::VectorXd& positioner_sample_resolution,
             std::string solver_name = DEFAULT_REP_INV_KIN_SOLVER_NAME);
 
+  using InverseKinematics::calcInvKin;
   IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                          const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
 
@@ -138,16 +140,16 @@ private:
   IKSolutions calcInvKinHelper(const tesseract_common::TransformMap& tip_link_poses,
                                const Eigen::Ref<const Eigen::VectorXd>& seed) const;
 
-  void nested_ik(IKSolutions& solutions,
-                 int loop_level,
-                 const std::vector<Eigen::VectorXd>& dof_range,
-                 const tesseract_common::TransformMap& tip_link_poses,
-                 Eigen::VectorXd& positioner_pose,
-                 const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+  /** @brief Calculate the manipulator target pose relative to the manipulator base for a positioner sample */
+  Eigen::Isometry3d calcRobotTargetPose(const ForwardKinematics& positioner_fwd_kin,
+                                        const tesseract_common::TransformMap& tip_link_poses,
+                                        const Eigen::Ref<const Eigen::VectorXd>& positioner_pose) const;
 
   void ikAt(IKSolutions& solutions,
+            const InverseKinematics& manip_inv_kin,
+            const ForwardKinematics& positioner_fwd_kin,
             const tesseract_common::TransformMap& tip_link_poses,
-            Eigen::VectorXd& positioner_pose,
+            const Eigen::Ref<const Eigen::VectorXd>& positioner_pose,
             const Eigen::Ref<const Eigen::VectorXd>& seed) const;
 };
 }  // namespace tesseract_kinematics
@@ -30,11 +30,15 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Core>
 #include <Eigen/Geometry>
+#include <functional>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/eigen_types.h>
 #include <tesseract_common/utils.h>
 #include <tesseract_common/kinematic_limits.h>
+#include <tesseract_scene_graph/fwd.h>
+#include <tesseract_kinematics/core/types.h>
 
 namespace tesseract_kinematics
 {
@@ -43,6 +47,7 @@ using VectorX = Eigen::Matrix<FloatType, Eigen::Dynamic, 1>;
 
 class JointGroup;
 class ForwardKinematics;
+class InverseKinematics;
 
 /**
  * @brief Numerically calculate a jacobian. This is mainly used for testing
@@ -174,97 +179,246 @@ struct Manipulability
 Manipulability calcManipulability(const Eigen::Ref<const Eigen::MatrixXd>& jacobian);
 
 /**
- * @brief This a recursive function for calculating all permutations of the redundant solutions.
- * @details This should not be used directly, use getRedundantSolutions function.
+ * @brief Solve the inverse kinematics at a single positioner sample
+ * @param solutions The solutions found at the sample are appended to this
+ * @param positioner_values The positioner joint values of the sample
  */
-template <typename FloatType>
-inline void getRedundantSolutionsHelper(std::vector<VectorX<FloatType>>& redundant_sols,
-                                        const Eigen::Ref<const Eigen::VectorXd>& sol,
-                                        const Eigen::MatrixX2d& limits,
-                                        std::vector<Eigen::Index>::const_iterator current_index,
-                                        std::vector<Eigen::Index>::const_iterator end_index)
+using PositionerSampleIKFn =
+    std::function<void(IKSolutions& solutions, const Eigen::Ref<const Eigen::VectorXd>& positioner_values)>;
+
+/**
+ * @brief Solve the inverse kinematics at every sample of a positioner sampling grid
+ * @details The samples are visited in the order of nested loops over the positioner joints, where the last joint
+ * changes the fastest. When more than one thread is used the samples are split into chunks which are solved on
+ * separate threads and merged in sample order, so the solutions are identical to the serial result.
+ * @param dof_range The sample values of each positioner joint
+ * @param create_fn Creates the function used to solve the samples of a thread. It is called once per thread with the
+ * thread index, where zero is the calling thread, so every other thread can use its own clone of the solvers.
+ * @param num_threads The number of threads to use. If zero, the hardware concurrency is used.
+ * @param max_solutions Only the solutions of the first samples up to this number are returned and the remaining
+ * samples are skipped. If zero, every sample is solved.
+ * @param sample_mask A flag for each sample in sample order identifying if it should be solved. If empty, every sample
+ * is solved.
+ * @return The solutions of all samples in sample order
+ */
+IKSolutions sampleInvKin(const std::vector<Eigen::VectorXd>& dof_range,
+                         const std::function<PositionerSampleIKFn(std::size_t thread)>& create_fn,
+                         std::size_t num_threads = 1,
+                         std::size_t max_solutions = 0,
+                         const std::vector<char>& sample_mask = {});
+
+/**
+ * @brief Solve the inverse kinematics at a single positioner sample with the provided kinematics
+ * @param solutions The solutions found at the sample are appended to this
+ * @param manip_inv_kin The manipulator inverse kinematics
+ * @param positioner_fwd_kin The positioner forward kinematics
+ * @param positioner_values The positioner joint values of the sample
+ */
+using PositionerKinematicsIKFn = std::function<void(IKSolutions& solutions,
+                                                    const InverseKinematics& manip_inv_kin,
+                                                    const ForwardKinematics& positioner_fwd_kin,
+                                                    const Eigen::Ref<const Eigen::VectorXd>& positioner_values)>;
+
+/**
+ * @brief Create the sampleInvKin function which creates the sample function of each thread
+ * @details The calling thread uses the provided kinematics and every other thread uses its own clones, which are
+ * created every time the returned function is called by sampleInvKin.
+ * @param manip_inv_kin The manipulator inverse kinematics, which must outlive the returned function
+ * @param positioner_fwd_kin The positioner forward kinematics, which must outlive the returned function
+ * @param ik_fn Solves a sample with the kinematics of the thread
+ * @return The function passed to sampleInvKin
+ */
+std::function<PositionerSampleIKFn(std::size_t thread)>
+createPositionerSampleIKFn(const InverseKinematics& manip_inv_kin,
+                           const ForwardKinematics& positioner_fwd_kin,
+                           PositionerKinematicsIKFn ik_fn);
+
+/**
+ * @brief The settings used by sampleInvKin which are shared by the inverse kinematics solvers sampling a positioner
+ * @see REPInvKin, ROPInvKin
+ */
+class PositionerSamplingSettings
 {
-  double val{ 0 };
-  for (; current_index != end_index; ++current_index)
+public:
+  /**
+   * @brief Set the number of threads used to sample the positioner
+   * @details Every thread other than the calling thread solves its samples with its own clone of the manipulator and
+   * positioner kinematics. The threads and clones are created by every call to calcInvKin, so more than one thread
+   * only pays off when the positioner has enough samples to amortize them. The solutions are always returned in sample
+   * order.
+   * @param num_threads The number of threads. If zero, the hardware concurrency is used. The default is one.
+   */
+  void setNumThreads(std::size_t num_threads);
+
+  /**
+   * @brief Get the number of threads used to sample the positioner
+   * @return The number of threads, zero if the hardware concurrency is used
+   */
+  std::size_t getNumThreads() const;
+
+  /**
+   * @brief Set the maximum number of solutions returned
+   * @details Sampling stops once the solutions of the first samples reach this number
+   * @param max_solutions The maximum number of solutions. If zero, every sample is solved. The default is zero.
+   */
+  void setMaxSolutions(std::size_t max_solutions);
+
+  /**
+   * @brief Get the maximum number of solutions returned
+   * @return The maximum number of solutions, zero if every sample is solved
+   */
+  std::size_t getMaxSolutions() const;
+
+  /**
+   * @brief Set the stride of the coarse positioner sampling cells used to skip samples which are out of reach
+   * @details Before solving, the target position is calculated at the corners and center of coarse cells spanning this
+   * number of samples along each positioner joint, and the samples of cells which are out of the manipulator reach are
+   * skipped. Every sample already skips the inverse kinematics when its target is out of reach, so this only saves the
+   * positioner forward kinematics of the skipped samples. No reachable sample is skipped because this is only
+   * supported when every positioner joint is prismatic, so this will throw if the stride is not zero and the
+   * positioner has a revolute or continuous joint.
+   * @see calcReachableSamples
+   * @param stride The number of samples spanned by a coarse cell. If zero, every sample is checked. The default is
+   * zero.
+   */
+  void setCoarseSampleStride(std::size_t stride);
+
+  /**
+   * @brief Get the stride of the coarse positioner sampling cells
+   * @return The number of samples spanned by a coarse cell, zero if every sample is checked
+   */
+  std::size_t getCoarseSampleStride() const;
+
+protected:
+  PositionerSamplingSettings() = default;
+  ~PositionerSamplingSettings() = default;
+  PositionerSamplingSettings(const PositionerSamplingSettings&) = default;
+  PositionerSamplingSettings& operator=(const PositionerSamplingSettings&) = default;
+  PositionerSamplingSettings(PositionerSamplingSettings&&) = default;
+  PositionerSamplingSettings& operator=(PositionerSamplingSettings&&) = default;
+
+  /**
+   * @brief Set the positioner joints, which decide if the coarse sampling is supported
+   * @param scene_graph The scene graph containing the positioner joints
+   * @param joint_names The positioner joint names
+   */
+  void setPositionerJoints(const tesseract_scene_graph::SceneGraph& scene_graph,
+                           const std::vector<std::string>& joint_names);
+
+private:
+  std::size_t num_threads_{ 1 };
+  std::size_t max_solutions_{ 0 };
+  std::size_t coarse_sample_stride_{ 0 };
+  bool positioner_prismatic_{ false }; /**< @brief Indicates if every positioner joint is prismatic */
+};
+
+/**
+ * @brief Calculate the target position relative to the manipulator base for a positioner sample
+ * @param positioner_values The positioner joint values of the sample
+ * @return The target position relative to the manipulator base
+ */
+using PositionerTargetPositionFn =
+    std::function<Eigen::Vector3d(const Eigen::Ref<const Eigen::VectorXd>& positioner_values)>;
+
+/**
+ * @brief Identify the positioner samples where the target may be within reach of the manipulator
+ * @details The sampling grid is divided into coarse cells which span coarse_stride samples of each joint, and the
+ * target position is only calculated at the corners and the center of each cell. The samples of a cell are kept if
+ * the distance to the center position minus the largest distance from the center to a corner position is within reach.
+ * This bound never rejects a reachable sample when the target position is an affine function of the positioner
+ * joints, like for prismatic joints. For revolute joints the target may leave the sphere within a cell, so it must
+ * only be used when every positioner joint is prismatic.
+ * @param dof_range The sample values of each positioner joint
+ * @param coarse_stride The number of samples spanned by a coarse cell along each joint, must be greater than zero
+ * @param reach The manipulator reach
+ * @param target_position_fn Calculates the target position relative to the manipulator base
+ * @return A flag for each sample in sample order identifying if the target may be within reach
+ */
+std::vector<char> calcReachableSamples(const std::vector<Eigen::VectorXd>& dof_range,
+                                       std::size_t coarse_stride,
+                                       double reach,
+                                       const PositionerTargetPositionFn& target_position_fn);
+
+/**
+ * @brief Move a redundancy capable joint of the working solution to its next redundant value
+ * @details This should not be used directly, use getRedundantSolutions function. The values below the solution are
+ * visited first followed by the values above the solution. When all values have been visited the joint is reset to
+ * its solution value.
+ * @return True if the joint was moved to a new value, otherwise false
+ */
+template <int N>
+inline bool nextRedundantValue(Eigen::Matrix<double, N, 1>& current,
+                               const Eigen::Matrix<double, N, 1>& sol,
+                               const Eigen::MatrixX2d& limits,
+                               Eigen::Index joint)
+{
+  double val = current[joint];
+  if (val <= sol[joint])
   {
-    if (std::isinf(limits(*current_index, 0)))
+    if (std::isinf(limits(joint, 0)))
     {
-      std::stringstream ss;
-      ss << "Lower limit of joint " << *current_index << " is infinite; no redundant solutions will be generated"
-         << std::endl;
-      CONSOLE_BRIDGE_logWarn(ss.str().c_str());
+      if (val == sol[joint])
+      {
+        std::stringstream ss;
+        ss << "Lower limit of joint " << joint << " is infinite; no redundant solutions will be generated" << std::endl;
+        CONSOLE_BRIDGE_logWarn(ss.str().c_str());
+      }
     }
     else
     {
-      val = sol[*current_index];
-      while ((val -= (2.0 * M_PI)) > limits(*current_index, 0) ||
-             tesseract_common::almostEqualRelativeAndAbs(val, limits(*current_index, 0)))
+      while ((val -= (2.0 * M_PI)) > limits(joint, 0) ||
+             tesseract_common::almostEqualRelativeAndAbs(val, limits(joint, 0)))
       {
         // It not guaranteed that the provided solution is within limits so this check is needed
-        if (val < limits(*current_index, 1) ||
-            tesseract_common::almostEqualRelativeAndAbs(val, limits(*current_index, 1)))
+        if (val < limits(joint, 1) || tesseract_common::almostEqualRelativeAndAbs(val, limits(joint, 1)))
         {
-          Eigen::VectorXd new_sol = sol;
-          new_sol[*current_index] = val;
-
-          if (tesseract_common::satisfiesLimits<double>(new_sol, limits))
-          {
-            tesseract_common::enforceLimits<double>(new_sol, limits);
-            redundant_sols.push_back(new_sol.template cast<FloatType>());
-          }
-
-          getRedundantSolutionsHelper<FloatType>(redundant_sols, new_sol, limits, current_index + 1, end_index);
+          current[joint] = val;
+          return true;
         }
       }
     }
 
-    if (std::isinf(limits(*current_index, 1)))
+    val = sol[joint];
+    if (std::isinf(limits(joint, 1)))
     {
       std::stringstream ss;
-      ss << "Upper limit of joint " << *current_index << " is infinite; no redundant solutions will be generated"
-         << std::endl;
+      ss << "Upper limit of joint " << joint << " is infinite; no redundant solutions will be generated" << std::endl;
       CONSOLE_BRIDGE_logWarn(ss.str().c_str());
     }
-    else
+  }
+
+  if (!std::isinf(limits(joint, 1)))
+  {
+    while ((val += (2.0 * M_PI)) < limits(joint, 1) ||
+           tesseract_common::almostEqualRelativeAndAbs(val, limits(joint, 1)))
     {
-      val = sol[*current_index];
-      while ((val += (2.0 * M_PI)) < limits(*current_index, 1) ||
-             tesseract_common::almostEqualRelativeAndAbs(val, limits(*current_index, 1)))
+      // It not guaranteed that the provided solution is within limits so this check is needed
+      if (val > limits(joint, 0) || tesseract_common::almostEqualRelativeAndAbs(val, limits(joint, 0)))
       {
-        // It not guaranteed that the provided solution is within limits so this check is needed
-        if (val > limits(*current_index, 0) ||
-            tesseract_common::almostEqualRelativeAndAbs(val, limits(*current_index, 0)))
-        {
-          Eigen::VectorXd new_sol = sol;
-          new_sol[*current_index] = val;
-
-          if (tesseract_common::satisfiesLimits<double>(new_sol, limits))
-          {
-            tesseract_common::enforceLimits<double>(new_sol, limits);
-            redundant_sols.push_back(new_sol.template cast<FloatType>());
-          }
-
-          getRedundantSolutionsHelper<FloatType>(redundant_sols, new_sol, limits, current_index + 1, end_index);
-        }
+        current[joint] = val;
+        return true;
       }
     }
   }
+
+  current[joint] = sol[joint];
+  return false;
 }
 
 /**
- * @brief Kinematics only return solution between PI and -PI. Provided the limits it will append redundant solutions.
- * @details The list of redundant solutions does not include the provided solutions.
- * @param sol The solution to calculate redundant solutions about
- * @param limits The joint limits of the robot
- * @param redundancy_capable_joints The indices of the redundancy capable joints
+ * @brief This an iterative function for calculating all permutations of the redundant solutions.
+ * @details This should not be used directly, use getRedundantSolutions function. The permutations are enumerated depth
+ * first using a stack of the redundancy capable joints which are offset from the solution, so the only storage
+ * required is the working solution and the stack.
  */
-template <typename FloatType>
-inline std::vector<VectorX<FloatType>> getRedundantSolutions(const Eigen::Ref<const VectorX<FloatType>>& sol,
-                                                             const Eigen::MatrixX2d& limits,
-                                                             const std::vector<Eigen::Index>& redundancy_capable_joints)
+template <typename FloatType, int N, typename Container>
+inline void getRedundantSolutionsHelper(Container& redundant_sols,
+                                        const Eigen::Matrix<double, N, 1>& sol,
+                                        const Eigen::MatrixX2d& limits,
+                                        const std::vector<Eigen::Index>& redundancy_capable_joints)
 {
   if (redundancy_capable_joints.empty())
-    return {};
+    return;
 
   for (const Eigen::Index& idx : redundancy_capable_joints)
   {
@@ -277,15 +431,93 @@ inline std::vector<VectorX<FloatType>> getRedundantSolutions(const Eigen::Ref<co
     }
   }
 
+  const auto num_joints = static_cast<Eigen::Index>(redundancy_capable_joints.size());
+  if (N != Eigen::Dynamic && num_joints > N)
+    throw std::runtime_error("The number of redundant joints is greater than the joint state size");
+
+  const Eigen::Matrix<double, N, 1> max_diff = Eigen::Matrix<double, N, 1>::Constant(sol.size(), 1e-6);
+  const Eigen::Matrix<double, N, 1> max_rel_diff =
+      Eigen::Matrix<double, N, 1>::Constant(sol.size(), std::numeric_limits<double>::epsilon());
+
+  Eigen::Matrix<double, N, 1> current = sol;
+  Eigen::Matrix<Eigen::Index, N, 1> stack;
+  stack.resize((N == Eigen::Dynamic) ? num_joints : N);
+
+  // Each stack entry is an index into the redundancy capable joints which is currently offset from the solution
+  Eigen::Index depth{ 0 };
+  Eigen::Index i{ 0 };
+  while (true)
+  {
+    if (i < num_joints)
+    {
+      if (nextRedundantValue<N>(current, sol, limits, redundancy_capable_joints[static_cast<std::size_t>(i)]))
+      {
+        if (tesseract_common::satisfiesLimits<double>(current, limits, max_diff, max_rel_diff))
+        {
+          Eigen::Matrix<double, N, 1> new_sol = current;
+          tesseract_common::enforceLimits<double>(new_sol, limits);
+          redundant_sols.push_back(new_sol.template cast<FloatType>());
+        }
+
+        // Offset the remaining joints from the new solution
+        stack[depth++] = i++;
+      }
+      else
+      {
+        ++i;
+      }
+    }
+    else if (depth > 0)
+    {
+      // Move the most recently offset joint to its next value
+      i = stack[--depth];
+    }
+    else
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Kinematics only return solution between PI and -PI. Provided the limits it will append redundant solutions.
+ * @details The list of redundant solutions does not include the provided solutions.
+ * @param sol The solution to calculate redundant solutions about
+ * @param limits The joint limits of the robot
+ * @param redundancy_capable_joints The indices of the redundancy capable joints
+ */
+template <typename FloatType>
+inline std::vector<VectorX<FloatType>> getRedundantSolutions(const Eigen::Ref<const VectorX<FloatType>>& sol,
+                                                             const Eigen::MatrixX2d& limits,
+                                                             const std::vector<Eigen::Index>& redundancy_capable_joints)
+{
   std::vector<VectorX<FloatType>> redundant_sols;
-  getRedundantSolutionsHelper<FloatType>(redundant_sols,
-                                         sol.template cast<double>(),
-                                         limits,
-                                         redundancy_capable_joints.begin(),
-                                         redundancy_capable_joints.end());
+  getRedundantSolutionsHelper<FloatType, Eigen::Dynamic>(
+      redundant_sols, sol.template cast<double>(), limits, redundancy_capable_joints);
   return redundant_sols;
 }
 
+/**
+ * @brief Kinematics only return solution between PI and -PI. Provided the limits it will append redundant solutions.
+ * @details This is the fixed size variant which does not allocate memory when the caller provided storage has enough
+ * capacity. The list of redundant solutions does not include the provided solutions and they are appended to the
+ * existing contents, so the redundant solutions of several solutions can be accumulated in the same storage.
+ * @param redundant_sols The storage the redundant solutions are appended to
+ * @param sol The solution to calculate redundant solutions about
+ * @param limits The joint limits of the robot
+ * @param redundancy_capable_joints The indices of the redundancy capable joints
+ */
+template <typename FloatType, int N>
+inline void getRedundantSolutions(tesseract_common::AlignedVector<Eigen::Matrix<FloatType, N, 1>>& redundant_sols,
+                                  const Eigen::Matrix<FloatType, N, 1>& sol,
+                                  const Eigen::MatrixX2d& limits,
+                                  const std::vector<Eigen::Index>& redundancy_capable_joints)
+{
+  static_assert(N != Eigen::Dynamic, "Use the dynamic size getRedundantSolutions overload");
+  getRedundantSolutionsHelper<FloatType, N>(
+      redundant_sols, sol.template cast<double>().eval(), limits, redundancy_capable_joints);
+}
+
 /**
  * @brief Given a vector of floats, this check if they are finite
  *
@@ -0,0 +1,230 @@
+/**
+ * @file ik_solution_cache.cpp
+ * @brief A least recently used cache of inverse kinematics solutions keyed by quantized target poses.
+ *
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/functional/hash.hpp>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/core/ik_solution_cache.h>
+
+namespace tesseract_kinematics
+{
+bool IKSolutionCache::Key::operator==(const Key& other) const
+{
+  return (values == other.values);
+}
+
+std::size_t IKSolutionCache::KeyHash::operator()(const Key& key) const
+{
+  return boost::hash_range(key.values.begin(), key.values.end());
+}
+
+IKSolutionCache::IKSolutionCache(std::size_t capacity, double translation_resolution, double rotation_resolution)
+  : capacity_(capacity), translation_resolution_(translation_resolution), rotation_resolution_(rotation_resolution)
+{
+  if (capacity_ == 0)
+    throw std::runtime_error("IKSolutionCache: capacity must be greater than zero");
+
+  if (translation_resolution_ <= 0 || rotation_resolution_ <= 0)
+    throw std::runtime_error("IKSolutionCache: resolutions must be greater than zero");
+}
+
+IKSolutionCache::Result IKSolutionCache::find(IKSolutions& solutions,
+                                              const tesseract_common::TransformMap& tip_link_poses,
+                                              std::size_t solver_id)
+{
+  // The key is thread local so its memory is reused by the next lookup
+  thread_local Key key;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (solver_id != solver_id_ || !createKey(key, tip_link_poses, false))
+  {
+    ++misses_;
+    return Result::MISS;
+  }
+
+  auto it = lookup_.find(key);
+  if (it == lookup_.end())
+  {
+    ++misses_;
+    return Result::MISS;
+  }
+
+  // Move the entry to the front of the list since it is now the most recently used
+  entries_.splice(entries_.begin(), entries_, it->second);
+  solutions = it->second->solutions;
+
+  for (const auto& tip_link_pose : tip_link_poses)
+  {
+    if (it->second->tip_link_poses.at(tip_link_pose.first).matrix() != tip_link_pose.second.matrix())
+    {
+      ++near_hits_;
+      return Result::NEAR_HIT;
+    }
+  }
+
+  ++hits_;
+  return Result::HIT;
+}
+
+void IKSolutionCache::insert(const tesseract_common::TransformMap& tip_link_poses,
+                             IKSolutions solutions,
+                             std::size_t solver_id)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (solver_id != solver_id_)
+    return;
+
+  Key key;
+  createKey(key, tip_link_poses, true);
+  auto it = lookup_.find(key);
+  if (it != lookup_.end())
+  {
+    entries_.splice(entries_.begin(), entries_, it->second);
+    it->second->tip_link_poses = tip_link_poses;
+    it->second->solutions = std::move(solutions);
+    return;
+  }
+
+  if (entries_.size() == capacity_)
+  {
+    lookup_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+
+  entries_.push_front(Entry{ key, tip_link_poses, std::move(solutions) });
+  lookup_[std::move(key)] = entries_.begin();
+}
+
+void IKSolutionCache::bindSolver(std::size_t solver_id)
+{
+  if (solver_id == 0)
+    throw std::runtime_error("IKSolutionCache: solver identity must not be zero");
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (solver_id_ != 0 && solver_id_ != solver_id)
+    throw std::runtime_error("IKSolutionCache: the cache is bound to a different solver");
+
+  solver_id_ = solver_id;
+}
+
+std::size_t IKSolutionCache::getSolverId() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return solver_id_;
+}
+
+void IKSolutionCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  solver_id_ = 0;
+  lookup_.clear();
+  entries_.clear();
+  tip_link_indices_.clear();
+}
+
+void IKSolutionCache::resetCounters()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  hits_ = 0;
+  near_hits_ = 0;
+  misses_ = 0;
+}
+
+std::size_t IKSolutionCache::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+std::size_t IKSolutionCache::capacity() const { return capacity_; }
+
+std::size_t IKSolutionCache::getHits() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return hits_;
+}
+
+std::size_t IKSolutionCache::getNearHits() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return near_hits_;
+}
+
+std::size_t IKSolutionCache::getMisses() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return misses_;
+}
+
+bool IKSolutionCache::createKey(Key& key, const tesseract_common::TransformMap& tip_link_poses, bool add_tip_links)
+{
+  // The tip links are ordered by index so the key does not depend on the iteration order of the map
+  thread_local std::vector<std::pair<long long, const Eigen::Isometry3d*>> tip_links;
+  tip_links.clear();
+  for (const auto& tip_link_pose : tip_link_poses)
+  {
+    auto it = tip_link_indices_.find(tip_link_pose.first);
+    if (it == tip_link_indices_.end())
+    {
+      if (!add_tip_links)
+        return false;
+
+      const auto index = static_cast<long long>(tip_link_indices_.size());
+      it = tip_link_indices_.emplace(tip_link_pose.first, index).first;
+    }
+
+    tip_links.emplace_back(it->second, &tip_link_pose.second);
+  }
+
+  std::sort(tip_links.begin(), tip_links.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+  key.values.clear();
+  key.values.reserve(8 * tip_links.size());
+  for (const auto& tip_link : tip_links)
+  {
+    key.values.push_back(tip_link.first);
+
+    const Eigen::Isometry3d& pose = *tip_link.second;
+    const Eigen::Vector3d& translation = pose.translation();
+    for (Eigen::Index i = 0; i < 3; ++i)
+      key.values.push_back(std::llround(translation(i) / translation_resolution_));
+
+    // q and -q are the same rotation so the quaternion is made unique by requiring a positive w
+    Eigen::Quaterniond q(pose.linear());
+    if (q.w() < 0)
+      q.coeffs() = -q.coeffs();
+
+    for (Eigen::Index i = 0; i < 4; ++i)
+      key.values.push_back(std::llround(q.coeffs()(i) / rotation_resolution_));
+  }
+
+  return true;
+}
+
+}  // namespace tesseract_kinematics
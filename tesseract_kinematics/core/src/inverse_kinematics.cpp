@@ -24,9 +24,27 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_kinematics/core/inverse_kinematics.h>
 
 namespace tesseract_kinematics
 {
 InverseKinematics::~InverseKinematics() = default;
+
+void InverseKinematics::calcInvKin(IKSolutions& solutions,
+                                   const Eigen::Isometry3d& tip_link_pose,
+                                   const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  std::vector<std::string> tip_link_names = getTipLinkNames();
+  if (tip_link_names.size() != 1)
+    throw std::runtime_error("InverseKinematics: a single tip link pose requires a solver with a single tip link");
+
+  tesseract_common::TransformMap tip_link_poses;
+  tip_link_poses[tip_link_names.front()] = tip_link_pose;
+  solutions = calcInvKin(tip_link_poses, seed);
 }
+}  // namespace tesseract_kinematics
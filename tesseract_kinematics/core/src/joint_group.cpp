@@ -62,9 +62,13 @@ JointGroup::JointGroup(std::string name,
         std::distance(solver_jn.begin(), std::find(solver_jn.begin(), solver_jn.end(), joint_name)));
 
   std::vector<std::string> active_link_names = state_solver_->getActiveLinkNames();
+  std::shared_ptr<const tesseract_scene_graph::SceneStateLayout> layout = state_solver_->getCompactStateLayout();
   for (const auto& link : scene_graph.getLinks())
   {
     link_names_.push_back(link->getName());
+    auto layout_it = layout->link_indices.find(link->getName());
+    link_state_map_.push_back(
+        (layout_it == layout->link_indices.end()) ? -1 : static_cast<Eigen::Index>(layout_it->second));
     auto it = std::find(active_link_names.begin(), active_link_names.end(), link->getName());
     if (it == active_link_names.end())
     {
@@ -120,6 +124,7 @@ JointGroup& JointGroup::operator=(const JointGroup& other)
   limits_ = other.limits_;
   redundancy_indices_ = other.redundancy_indices_;
   jacobian_map_ = other.jacobian_map_;
+  link_state_map_ = other.link_state_map_;
   return *this;
 }
 
@@ -130,6 +135,52 @@ tesseract_common::TransformMap JointGroup::calcFwdKin(const Eigen::Ref<const Eig
   return state;
 }
 
+void JointGroup::calcFwdKin(tesseract_common::VectorIsometry3d& link_transforms,
+                            const Eigen::Ref<const tesseract_common::TrajArray>& joint_angles) const
+{
+  Workspace workspace;
+  calcFwdKin(link_transforms, joint_angles, workspace);
+}
+
+void JointGroup::calcFwdKin(tesseract_common::VectorIsometry3d& link_transforms,
+                            const Eigen::Ref<const tesseract_common::TrajArray>& joint_angles,
+                            Workspace& workspace) const
+{
+  assert(joint_angles.cols() == numJoints());
+
+  // The state solver expects the joints in the order of its active joint names
+  tesseract_common::TrajArray& solver_joint_angles = workspace.solver_joint_angles;
+  solver_joint_angles.resize(joint_angles.rows(), joint_angles.cols());
+  for (Eigen::Index i = 0; i < numJoints(); ++i)
+    solver_joint_angles.col(jacobian_map_[static_cast<std::size_t>(i)]) = joint_angles.col(i);
+
+  state_solver_->getStates(workspace.solver_link_transforms, solver_joint_angles);
+  const tesseract_common::VectorIsometry3d& solver_link_transforms = workspace.solver_link_transforms;
+
+  const std::size_t num_links = link_names_.size();
+  const std::size_t num_solver_links = state_solver_->getCompactStateLayout()->link_names.size();
+  const std::size_t size = static_cast<std::size_t>(joint_angles.rows()) * num_links;
+  if (link_transforms.size() != size)
+    link_transforms.resize(size);
+
+  for (std::size_t j = 0; j < num_links; ++j)
+  {
+    const Eigen::Index solver_idx = link_state_map_[j];
+    if (solver_idx < 0)
+    {
+      const Eigen::Isometry3d& static_tf = static_link_transforms_.at(link_names_[j]);
+      for (std::size_t i = 0; i < static_cast<std::size_t>(joint_angles.rows()); ++i)
+        link_transforms[(i * num_links) + j] = static_tf;
+    }
+    else
+    {
+      for (std::size_t i = 0; i < static_cast<std::size_t>(joint_angles.rows()); ++i)
+        link_transforms[(i * num_links) + j] =
+            solver_link_transforms[(i * num_solver_links) + static_cast<std::size_t>(solver_idx)];
+    }
+  }
+}
+
 Eigen::MatrixXd JointGroup::calcJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
                                          const std::string& link_name) const
 {
@@ -264,6 +315,39 @@ bool JointGroup::checkJoints(const Eigen::Ref<const Eigen::VectorXd>& vec) const
   return true;
 }
 
+void JointGroup::calcJacobians(Eigen::Ref<Eigen::MatrixXd> jacobians,
+                               const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
+                               const std::vector<std::string>& link_names,
+                               const tesseract_common::VectorVector3d& link_points) const
+{
+  Workspace workspace;
+  calcJacobians(jacobians, joint_angles, link_names, link_points, workspace);
+}
+
+void JointGroup::calcJacobians(Eigen::Ref<Eigen::MatrixXd> jacobians,
+                               const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
+                               const std::vector<std::string>& link_names,
+                               const tesseract_common::VectorVector3d& link_points,
+                               Workspace& workspace) const
+{
+  assert(joint_angles.size() == numJoints());
+  assert(jacobians.rows() == 6 * static_cast<Eigen::Index>(link_names.size()));
+  assert(jacobians.cols() == numJoints());
+
+  // The state solver expects the joints in the order of its active joint names
+  Eigen::VectorXd& solver_joint_angles = workspace.solver_joint_values;
+  solver_joint_angles.resize(numJoints());
+  for (Eigen::Index i = 0; i < numJoints(); ++i)
+    solver_joint_angles(jacobian_map_[static_cast<std::size_t>(i)]) = joint_angles(i);
+
+  Eigen::MatrixXd& solver_jacobians = workspace.solver_jacobians;
+  solver_jacobians.resize(jacobians.rows(), numJoints());
+  state_solver_->getJacobians(solver_jacobians, solver_joint_angles, link_names, link_points);
+
+  for (Eigen::Index i = 0; i < numJoints(); ++i)
+    jacobians.col(i) = solver_jacobians.col(jacobian_map_[static_cast<std::size_t>(i)]);
+}
+
 std::vector<std::string> JointGroup::getJointNames() const { return joint_names_; }
 
 std::vector<std::string> JointGroup::getLinkNames() const { return link_names_; }
@@ -25,11 +25,13 @@
  */
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_kinematics/core/kinematic_group.h>
 #include <tesseract_kinematics/core/inverse_kinematics.h>
+#include <tesseract_kinematics/core/ik_solution_cache.h>
 #include <tesseract_kinematics/core/utils.h>
 #include <tesseract_common/utils.h>
 
@@ -38,6 +40,16 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_kinematics
 {
+namespace
+{
+/** @brief Create a process unique solver identity, zero is reserved for an unbound cache */
+std::size_t createSolverId()
+{
+  static std::atomic<std::size_t> next_solver_id{ 1 };
+  return next_solver_id++;
+}
+}  // namespace
+
 KinGroupIKInput::KinGroupIKInput(const Eigen::Isometry3d& p, std::string wf, std::string tl)
   : pose(p), working_frame(std::move(wf)), tip_link_name(std::move(tl))
 {
@@ -51,6 +63,7 @@ KinematicGroup::KinematicGroup(std::string name,
   : JointGroup(std::move(name), joint_names, scene_graph, scene_state)
   , joint_names_(std::move(joint_names))
   , inv_kin_(std::move(inv_kin))
+  , solver_id_(createSolverId())
 {
   std::vector<std::string> inv_kin_joint_names = inv_kin_->getJointNames();
 
@@ -115,6 +128,8 @@ KinematicGroup& KinematicGroup::operator=(const KinematicGroup& other)
   inv_to_fwd_base_ = other.inv_to_fwd_base_;
   working_frames_ = other.working_frames_;
   inv_tip_links_map_ = other.inv_tip_links_map_;
+  ik_cache_ = other.ik_cache_;
+  solver_id_ = other.solver_id_;
   return *this;
 }
 
@@ -151,40 +166,23 @@ IKSolutions KinematicGroup::calcInvKin(const KinGroupIKInputs& tip_link_poses,
   }
 
   // format seed for inverse kinematic solver
+  IKSolutions solutions;
   if (reorder_required_)
   {
     Eigen::VectorXd ordered_seed = seed;
     for (Eigen::Index i = 0; i < inv_kin_->numJoints(); ++i)
       ordered_seed(inv_kin_joint_map_[static_cast<std::size_t>(i)]) = seed(i);
 
-    IKSolutions solutions = inv_kin_->calcInvKin(ik_inputs, ordered_seed);
-    IKSolutions solutions_filtered;
-    solutions_filtered.reserve(solutions.size());
-    for (const auto& solution : solutions)
-    {
-      Eigen::VectorXd ordered_sol = solution;
-      for (Eigen::Index i = 0; i < inv_kin_->numJoints(); ++i)
-        ordered_sol(i) = solution(inv_kin_joint_map_[static_cast<std::size_t>(i)]);
-
-      tesseract_kinematics::harmonizeTowardMedian<double>(ordered_sol, redundancy_indices_, limits_.joint_limits);
-      if (tesseract_common::satisfiesLimits<double>(ordered_sol, limits_.joint_limits))
-        solutions_filtered.push_back(ordered_sol);
-    }
-
-    return solutions_filtered;
+    solutions = calcSolverInvKin(ik_inputs, ordered_seed);
   }
-
-  IKSolutions solutions = inv_kin_->calcInvKin(ik_inputs, seed);
-  IKSolutions solutions_filtered;
-  solutions_filtered.reserve(solutions.size());
-  for (auto& solution : solutions)
+  else
   {
-    tesseract_kinematics::harmonizeTowardMedian<double>(solution, redundancy_indices_, limits_.joint_limits);
-    if (tesseract_common::satisfiesLimits<double>(solution, limits_.joint_limits))
-      solutions_filtered.push_back(solution);
+    solutions = calcSolverInvKin(ik_inputs, seed);
   }
 
-  return solutions_filtered;
+  Eigen::VectorXd ordered_solution;
+  filterSolutions(solutions, ordered_solution);
+  return solutions;
 }
 
 IKSolutions KinematicGroup::calcInvKin(const KinGroupIKInput& tip_link_pose,
@@ -193,6 +191,128 @@ IKSolutions KinematicGroup::calcInvKin(const KinGroupIKInput& tip_link_pose,
   return calcInvKin(KinGroupIKInputs{ tip_link_pose }, seed);  // NOLINT
 }
 
+KinGroupIKHandle KinematicGroup::createIKHandle(const std::string& working_frame,
+                                                const std::string& tip_link_name) const
+{
+  if (std::find(working_frames_.begin(), working_frames_.end(), working_frame) == working_frames_.end())
+    throw std::runtime_error("KinematicGroup: '" + working_frame + "' is not a valid working frame");
+
+  auto it = inv_tip_links_map_.find(tip_link_name);
+  if (it == inv_tip_links_map_.end())
+    throw std::runtime_error("KinematicGroup: '" + tip_link_name + "' is not a valid tip link");
+
+  if (inv_kin_->getTipLinkNames().size() != 1)
+    throw std::runtime_error("KinematicGroup: IK handles require an inverse kinematics solver with a single tip link");
+
+  KinGroupIKHandle handle;
+  handle.working_frame = working_frame;
+  handle.tip_link_name = tip_link_name;
+
+  const Eigen::Isometry3d& world_to_user_wf = state_.link_transforms.at(working_frame);
+  const Eigen::Isometry3d& world_to_wf = state_.link_transforms.at(inv_kin_->getWorkingFrame());
+  handle.wf_to_user_wf = world_to_wf.inverse() * world_to_user_wf;
+
+  const Eigen::Isometry3d& world_to_user_tl = state_.link_transforms.at(tip_link_name);
+  const Eigen::Isometry3d& world_to_tl = state_.link_transforms.at(it->second);
+  handle.user_tl_to_tl = (world_to_tl.inverse() * world_to_user_tl).inverse();
+
+  handle.ik_inputs[it->second] = Eigen::Isometry3d::Identity();
+  handle.ordered_seed.resize(inv_kin_->numJoints());
+  handle.ordered_solution.resize(inv_kin_->numJoints());
+  return handle;
+}
+
+IKSolutions KinematicGroup::calcInvKin(KinGroupIKHandle& handle,
+                                       const Eigen::Isometry3d& pose,
+                                       const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  IKSolutions solutions;
+  calcInvKin(solutions, handle, pose, seed);
+  return solutions;
+}
+
+void KinematicGroup::calcInvKin(IKSolutions& solutions,
+                                KinGroupIKHandle& handle,
+                                const Eigen::Isometry3d& pose,
+                                const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  assert(handle.ik_inputs.size() == 1);
+  assert(std::abs(1.0 - pose.matrix().determinant()) < 1e-6);  // NOLINT
+  Eigen::Isometry3d& ik_pose = handle.ik_inputs.begin()->second;
+  ik_pose = handle.wf_to_user_wf * pose * handle.user_tl_to_tl;
+
+  // Without a cache the pose is passed to the solver directly so the solutions are written into the provided vector
+  auto solve = [this, &solutions, &handle, &ik_pose](const Eigen::Ref<const Eigen::VectorXd>& solver_seed) {
+    if (ik_cache_ != nullptr)
+      solutions = calcSolverInvKin(handle.ik_inputs, solver_seed);
+    else
+      inv_kin_->calcInvKin(solutions, ik_pose, solver_seed);
+  };
+
+  if (reorder_required_)
+  {
+    for (Eigen::Index i = 0; i < inv_kin_->numJoints(); ++i)
+      handle.ordered_seed(inv_kin_joint_map_[static_cast<std::size_t>(i)]) = seed(i);
+
+    solve(handle.ordered_seed);
+  }
+  else
+  {
+    solve(seed);
+  }
+
+  filterSolutions(solutions, handle.ordered_solution);
+}
+
+IKSolutions KinematicGroup::calcSolverInvKin(const tesseract_common::TransformMap& ik_inputs,
+                                             const Eigen::Ref<const Eigen::VectorXd>& solver_seed) const
+{
+  IKSolutions cached;
+  IKSolutionCache::Result cache_result{ IKSolutionCache::Result::MISS };
+  if (ik_cache_ != nullptr)
+  {
+    cache_result = ik_cache_->find(cached, ik_inputs, solver_id_);
+    if (cache_result == IKSolutionCache::Result::HIT)
+      return cached;
+  }
+
+  // The cached solutions are already in the solver joint order. Numerical solvers may fail to converge from the cached
+  // seed, in which case the provided seed is used.
+  IKSolutions solutions;
+  if (cache_result == IKSolutionCache::Result::NEAR_HIT && !cached.empty())
+    solutions = inv_kin_->calcInvKin(ik_inputs, cached.front());
+
+  if (solutions.empty())
+    solutions = inv_kin_->calcInvKin(ik_inputs, solver_seed);
+
+  if (ik_cache_ != nullptr && !solutions.empty())
+    ik_cache_->insert(ik_inputs, solutions, solver_id_);
+
+  return solutions;
+}
+
+void KinematicGroup::filterSolutions(IKSolutions& solutions, Eigen::VectorXd& ordered_solution) const
+{
+  std::size_t num_valid{ 0 };
+  for (auto& solution : solutions)
+  {
+    if (reorder_required_)
+    {
+      ordered_solution.resize(solution.size());
+      for (Eigen::Index i = 0; i < inv_kin_->numJoints(); ++i)
+        ordered_solution(i) = solution(inv_kin_joint_map_[static_cast<std::size_t>(i)]);
+
+      solution = ordered_solution;
+    }
+
+    tesseract_kinematics::harmonizeTowardMedian<double>(solution, redundancy_indices_, limits_.joint_limits);
+    if (tesseract_common::satisfiesLimits<double>(solution, limits_.joint_limits))
+      solutions[num_valid++].swap(solution);
+  }
+
+  solutions.resize(num_valid);
+}
+
 std::vector<std::string> KinematicGroup::getAllValidWorkingFrames() const { return working_frames_; }
 
 std::vector<std::string> KinematicGroup::getAllPossibleTipLinkNames() const
@@ -204,4 +324,14 @@ std::vector<std::string> KinematicGroup::getAllPossibleTipLinkNames() const
 
   return ik_tip_links;
 }
+
+void KinematicGroup::setIKCache(std::shared_ptr<IKSolutionCache> cache)
+{
+  if (cache != nullptr)
+    cache->bindSolver(solver_id_);
+
+  ik_cache_ = std::move(cache);
+}
+
+std::shared_ptr<IKSolutionCache> KinematicGroup::getIKCache() const { return ik_cache_; }
 }  // namespace tesseract_kinematics
@@ -42,6 +42,9 @@ std::unique_ptr<InverseKinematics> REPInvKinFactory::create(const std::string& s
   double m_reach{ 0 };
   Eigen::MatrixX2d sample_range;
   Eigen::VectorXd sample_res;
+  std::size_t num_threads{ 1 };
+  std::size_t max_solutions{ 0 };
+  std::size_t coarse_sample_stride{ 0 };
 
   try
   {
@@ -162,6 +165,16 @@ std::unique_ptr<InverseKinematics> REPInvKinFactory::create(const std::string& s
     {
       throw std::runtime_error("REPInvKinFactory, missing 'manipulator' entry!");
     }
+
+    // Get optional sampling settings
+    if (YAML::Node n = config["num_threads"])
+      num_threads = n.as<std::size_t>();
+
+    if (YAML::Node n = config["max_solutions"])
+      max_solutions = n.as<std::size_t>();
+
+    if (YAML::Node n = config["coarse_sample_stride"])
+      coarse_sample_stride = n.as<std::size_t>();
   }
   catch (const std::exception& e)
   {
@@ -169,8 +182,22 @@ std::unique_ptr<InverseKinematics> REPInvKinFactory::create(const std::string& s
     return nullptr;
   }
 
-  return std::make_unique<REPInvKin>(
+  auto solver = std::make_unique<REPInvKin>(
       scene_graph, scene_state, std::move(inv_kin), m_reach, std::move(fwd_kin), sample_range, sample_res, solver_name);
+  solver->setNumThreads(num_threads);
+  solver->setMaxSolutions(max_solutions);
+
+  try
+  {
+    solver->setCoarseSampleStride(coarse_sample_stride);
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("REPInvKinFactory: Invalid 'coarse_sample_stride'! Details: %s", e.what());
+    return nullptr;
+  }
+
+  return solver;
 }
 
 TESSERACT_PLUGIN_ANCHOR_IMPL(REPInvKinFactoriesAnchor)
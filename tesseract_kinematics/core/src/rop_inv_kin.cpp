@@ -26,6 +26,7 @@
 
 #include <tesseract_kinematics/core/rop_inv_kin.h>
 #include <tesseract_kinematics/core/forward_kinematics.h>
+#include <tesseract_kinematics/core/utils.h>
 #include <tesseract_scene_graph/graph.h>
 #include <tesseract_scene_graph/joint.h>
 #include <tesseract_scene_graph/scene_state.h>
@@ -138,6 +139,8 @@ void ROPInvKin::init(const tesseract_scene_graph::SceneGraph& scene_graph,
   dof_ = positioner_fwd_kin_->numJoints() + manip_inv_kin_->numJoints();
 
   joint_names_ = positioner_fwd_kin_->getJointNames();
+  setPositionerJoints(scene_graph, joint_names_);
+
   const auto& manip_joints = manip_inv_kin_->getJointNames();
   joint_names_.insert(joint_names_.end(), manip_joints.begin(), manip_joints.end());
 
@@ -171,6 +174,7 @@ ROPInvKin& ROPInvKin::operator=(const ROPInvKin& other)
   joint_names_ = other.joint_names_;
   dof_ = other.dof_;
   dof_range_ = other.dof_range_;
+  PositionerSamplingSettings::operator=(other);
 
   return *this;
 }
@@ -178,48 +182,51 @@ ROPInvKin& ROPInvKin::operator=(const ROPInvKin& other)
 IKSolutions ROPInvKin::calcInvKinHelper(const tesseract_common::TransformMap& tip_link_poses,
                                         const Eigen::Ref<const Eigen::VectorXd>& seed) const
 {
-  Eigen::VectorXd positioner_pose(positioner_fwd_kin_->numJoints());
-  IKSolutions solutions;
-  nested_ik(solutions, 0, dof_range_, tip_link_poses, positioner_pose, seed);
-  return solutions;
-}
-
-void ROPInvKin::nested_ik(IKSolutions& solutions,
-                          int loop_level,
-                          const std::vector<Eigen::VectorXd>& dof_range,
-                          const tesseract_common::TransformMap& tip_link_poses,
-                          Eigen::VectorXd& positioner_pose,
-                          const Eigen::Ref<const Eigen::VectorXd>& seed) const
-{
-  if (loop_level >= positioner_fwd_kin_->numJoints())
+  auto ik_fn = [this, &tip_link_poses, &seed](IKSolutions& solutions,
+                                              const InverseKinematics& manip_inv_kin,
+                                              const ForwardKinematics& positioner_fwd_kin,
+                                              const Eigen::Ref<const Eigen::VectorXd>& positioner_pose) {
+    ikAt(solutions, manip_inv_kin, positioner_fwd_kin, tip_link_poses, positioner_pose, seed);
+  };
+  auto create_fn = createPositionerSampleIKFn(*manip_inv_kin_, *positioner_fwd_kin_, ik_fn);
+
+  std::vector<char> sample_mask;
+  if (getCoarseSampleStride() > 0)
   {
-    ikAt(solutions, tip_link_poses, positioner_pose, seed);
-    return;
+    auto target_position_fn = [this, &tip_link_poses](const Eigen::Ref<const Eigen::VectorXd>& positioner_pose) {
+      return Eigen::Vector3d(calcRobotTargetPose(*positioner_fwd_kin_, tip_link_poses, positioner_pose).translation());
+    };
+    sample_mask = calcReachableSamples(dof_range_, getCoarseSampleStride(), manip_reach_, target_position_fn);
   }
 
-  for (long i = 0; i < static_cast<long>(dof_range[static_cast<std::size_t>(loop_level)].size()); ++i)
-  {
-    positioner_pose(loop_level) = dof_range[static_cast<std::size_t>(loop_level)][i];
-    nested_ik(solutions, loop_level + 1, dof_range, tip_link_poses, positioner_pose, seed);
-  }
+  return sampleInvKin(dof_range_, create_fn, getNumThreads(), getMaxSolutions(), sample_mask);
+}
+
+Eigen::Isometry3d ROPInvKin::calcRobotTargetPose(const ForwardKinematics& positioner_fwd_kin,
+                                                const tesseract_common::TransformMap& tip_link_poses,
+                                                const Eigen::Ref<const Eigen::VectorXd>& positioner_pose) const
+{
+  tesseract_common::TransformMap positioner_poses = positioner_fwd_kin.calcFwdKin(positioner_pose);
+  Eigen::Isometry3d positioner_tf = positioner_poses[positioner_tip_link_] * positioner_to_robot_;
+  return positioner_tf.inverse() * tip_link_poses.at(manip_tip_link_);
 }
 
 void ROPInvKin::ikAt(IKSolutions& solutions,
+                     const InverseKinematics& manip_inv_kin,
+                     const ForwardKinematics& positioner_fwd_kin,
                      const tesseract_common::TransformMap& tip_link_poses,
-                     Eigen::VectorXd& positioner_pose,
+                     const Eigen::Ref<const Eigen::VectorXd>& positioner_pose,
                      const Eigen::Ref<const Eigen::VectorXd>& seed) const
 {
-  tesseract_common::TransformMap positioner_poses = positioner_fwd_kin_->calcFwdKin(positioner_pose);
-  Eigen::Isometry3d positioner_tf = positioner_poses[positioner_tip_link_] * positioner_to_robot_;
-  Eigen::Isometry3d robot_target_pose = positioner_tf.inverse() * tip_link_poses.at(manip_tip_link_);
+  Eigen::Isometry3d robot_target_pose = calcRobotTargetPose(positioner_fwd_kin, tip_link_poses, positioner_pose);
   if (robot_target_pose.translation().norm() > manip_reach_)
     return;
 
   tesseract_common::TransformMap robot_target_poses{ std::make_pair(manip_tip_link_, robot_target_pose) };
-  auto robot_dof = static_cast<Eigen::Index>(manip_inv_kin_->numJoints());
+  auto robot_dof = static_cast<Eigen::Index>(manip_inv_kin.numJoints());
   auto positioner_dof = static_cast<Eigen::Index>(positioner_pose.size());
 
-  IKSolutions robot_solution_set = manip_inv_kin_->calcInvKin(robot_target_poses, seed.tail(robot_dof));
+  IKSolutions robot_solution_set = manip_inv_kin.calcInvKin(robot_target_poses, seed.tail(robot_dof));
   if (robot_solution_set.empty())
     return;
 
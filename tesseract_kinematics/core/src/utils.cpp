@@ -27,11 +27,18 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_kinematics/core/utils.h>
 #include <tesseract_kinematics/core/joint_group.h>
 #include <tesseract_kinematics/core/forward_kinematics.h>
+#include <tesseract_kinematics/core/inverse_kinematics.h>
+#include <tesseract_scene_graph/graph.h>
+#include <tesseract_scene_graph/joint.h>
 
 namespace tesseract_kinematics
 {
@@ -237,4 +244,284 @@ Manipulability calcManipulability(const Eigen::Ref<const Eigen::MatrixXd>& jacob
 
   return manip;
 }
+
+IKSolutions sampleInvKin(const std::vector<Eigen::VectorXd>& dof_range,
+                         const std::function<PositionerSampleIKFn(std::size_t thread)>& create_fn,
+                         std::size_t num_threads,
+                         std::size_t max_solutions,
+                         const std::vector<char>& sample_mask)
+{
+  std::size_t num_samples{ 1 };
+  for (const auto& range : dof_range)
+    num_samples *= static_cast<std::size_t>(range.size());
+
+  assert(sample_mask.empty() || sample_mask.size() == num_samples);
+
+  // Solve the samples in the range [start, end), stopping once the maximum number of solutions is reached
+  auto solve = [&dof_range, &sample_mask, max_solutions](
+                   IKSolutions& solutions, const PositionerSampleIKFn& fn, std::size_t start, std::size_t end) {
+    Eigen::VectorXd positioner_values(static_cast<Eigen::Index>(dof_range.size()));
+    for (std::size_t sample = start; sample < end; ++sample)
+    {
+      if (max_solutions > 0 && solutions.size() >= max_solutions)
+        break;
+
+      if (!sample_mask.empty() && sample_mask[sample] == 0)
+        continue;
+
+      std::size_t index = sample;
+      for (std::size_t d = dof_range.size(); d-- > 0;)
+      {
+        const auto cnt = static_cast<std::size_t>(dof_range[d].size());
+        positioner_values(static_cast<Eigen::Index>(d)) = dof_range[d](static_cast<Eigen::Index>(index % cnt));
+        index /= cnt;
+      }
+
+      fn(solutions, positioner_values);
+    }
+  };
+
+  if (num_threads == 0)
+    num_threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+  IKSolutions solutions;
+  if (num_threads == 1 || num_samples < 2)
+  {
+    solve(solutions, create_fn(0), 0, num_samples);
+  }
+  else
+  {
+    // Use more chunks than threads so the work stays balanced when the samples have different numbers of solutions
+    const std::size_t num_chunks = std::min(num_samples, num_threads * 4);
+    num_threads = std::min(num_threads, num_chunks);
+
+    std::vector<IKSolutions> chunk_solutions(num_chunks);
+    std::vector<std::size_t> chunk_counts(num_chunks, 0);
+    std::atomic<std::size_t> next_chunk{ 0 };
+
+    std::mutex mutex;
+    std::exception_ptr exception;
+
+    // The merged result only keeps the first solutions, so once the solved chunks before a chunk hold enough solutions
+    // it and every chunk after it can be skipped
+    auto is_full = [&](std::size_t chunk) {
+      if (max_solutions == 0)
+        return false;
+
+      std::scoped_lock lock(mutex);
+      std::size_t count{ 0 };
+      for (std::size_t c = 0; c < chunk; ++c)
+        count += chunk_counts[c];
+
+      return (count >= max_solutions);
+    };
+
+    auto worker = [&](std::size_t thread) {
+      try
+      {
+        const PositionerSampleIKFn fn = create_fn(thread);
+        for (std::size_t chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++)
+        {
+          if (is_full(chunk))
+            break;
+
+          IKSolutions sols;
+          solve(sols, fn, (chunk * num_samples) / num_chunks, ((chunk + 1) * num_samples) / num_chunks);
+
+          std::scoped_lock lock(mutex);
+          chunk_counts[chunk] = sols.size();
+          chunk_solutions[chunk] = std::move(sols);
+        }
+      }
+      catch (...)
+      {
+        std::scoped_lock lock(mutex);
+        if (!exception)
+          exception = std::current_exception();
+
+        // Make the remaining workers exit
+        next_chunk = num_chunks;
+      }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    for (std::size_t i = 1; i < num_threads; ++i)
+      threads.emplace_back(worker, i);
+
+    worker(0);
+
+    for (auto& t : threads)
+      t.join();
+
+    if (exception)
+      std::rethrow_exception(exception);
+
+    for (auto& sols : chunk_solutions)
+    {
+      if (max_solutions > 0 && solutions.size() >= max_solutions)
+        break;
+
+      std::move(sols.begin(), sols.end(), std::back_inserter(solutions));
+    }
+  }
+
+  if (max_solutions > 0 && solutions.size() > max_solutions)
+    solutions.resize(max_solutions);
+
+  return solutions;
+}
+
+std::function<PositionerSampleIKFn(std::size_t thread)>
+createPositionerSampleIKFn(const InverseKinematics& manip_inv_kin,
+                           const ForwardKinematics& positioner_fwd_kin,
+                           PositionerKinematicsIKFn ik_fn)
+{
+  return [&manip_inv_kin, &positioner_fwd_kin, ik_fn = std::move(ik_fn)](std::size_t thread) -> PositionerSampleIKFn {
+    if (thread == 0)
+    {
+      return [&manip_inv_kin, &positioner_fwd_kin, &ik_fn](IKSolutions& solutions,
+                                                           const Eigen::Ref<const Eigen::VectorXd>& positioner_values) {
+        ik_fn(solutions, manip_inv_kin, positioner_fwd_kin, positioner_values);
+      };
+    }
+
+    std::shared_ptr<const InverseKinematics> thread_inv_kin = manip_inv_kin.clone();
+    std::shared_ptr<const ForwardKinematics> thread_fwd_kin = positioner_fwd_kin.clone();
+    return [thread_inv_kin, thread_fwd_kin, &ik_fn](IKSolutions& solutions,
+                                                    const Eigen::Ref<const Eigen::VectorXd>& positioner_values) {
+      ik_fn(solutions, *thread_inv_kin, *thread_fwd_kin, positioner_values);
+    };
+  };
+}
+
+void PositionerSamplingSettings::setNumThreads(std::size_t num_threads) { num_threads_ = num_threads; }
+
+std::size_t PositionerSamplingSettings::getNumThreads() const { return num_threads_; }
+
+void PositionerSamplingSettings::setMaxSolutions(std::size_t max_solutions) { max_solutions_ = max_solutions; }
+
+std::size_t PositionerSamplingSettings::getMaxSolutions() const { return max_solutions_; }
+
+void PositionerSamplingSettings::setCoarseSampleStride(std::size_t stride)
+{
+  if (stride > 0 && !positioner_prismatic_)
+    throw std::runtime_error("PositionerSamplingSettings: coarse sampling is only supported when every positioner "
+                             "joint is prismatic");
+
+  coarse_sample_stride_ = stride;
+}
+
+std::size_t PositionerSamplingSettings::getCoarseSampleStride() const { return coarse_sample_stride_; }
+
+void PositionerSamplingSettings::setPositionerJoints(const tesseract_scene_graph::SceneGraph& scene_graph,
+                                                     const std::vector<std::string>& joint_names)
+{
+  auto is_prismatic = [&scene_graph](const std::string& joint_name) {
+    auto joint = scene_graph.getJoint(joint_name);
+    return (joint != nullptr && joint->type == tesseract_scene_graph::JointType::PRISMATIC);
+  };
+  positioner_prismatic_ = std::all_of(joint_names.begin(), joint_names.end(), is_prismatic);
+}
+
+std::vector<char> calcReachableSamples(const std::vector<Eigen::VectorXd>& dof_range,
+                                       std::size_t coarse_stride,
+                                       double reach,
+                                       const PositionerTargetPositionFn& target_position_fn)
+{
+  assert(coarse_stride > 0);
+  const std::size_t num_joints = dof_range.size();
+
+  // The sample indices of the coarse cell corners along each joint, which always include the last sample
+  std::vector<std::vector<std::size_t>> nodes(num_joints);
+  std::vector<std::size_t> sample_strides(num_joints);
+  std::size_t num_samples{ 1 };
+  std::size_t num_nodes{ 1 };
+  std::size_t num_cells{ 1 };
+  for (std::size_t d = num_joints; d-- > 0;)
+  {
+    const auto cnt = static_cast<std::size_t>(dof_range[d].size());
+    if (cnt == 0)
+      return {};
+
+    for (std::size_t i = 0; i < cnt; i += coarse_stride)
+      nodes[d].push_back(i);
+
+    if (nodes[d].back() != cnt - 1)
+      nodes[d].push_back(cnt - 1);
+
+    sample_strides[d] = num_samples;
+    num_samples *= cnt;
+    num_nodes *= nodes[d].size();
+    num_cells *= std::max<std::size_t>(1, nodes[d].size() - 1);
+  }
+
+  // Calculate the target position at every cell corner
+  Eigen::VectorXd positioner_values(static_cast<Eigen::Index>(num_joints));
+  tesseract_common::VectorVector3d node_positions(num_nodes);
+  for (std::size_t n = 0; n < num_nodes; ++n)
+  {
+    std::size_t index = n;
+    for (std::size_t d = num_joints; d-- > 0;)
+    {
+      const std::size_t cnt = nodes[d].size();
+      positioner_values(static_cast<Eigen::Index>(d)) = dof_range[d](static_cast<Eigen::Index>(nodes[d][index % cnt]));
+      index /= cnt;
+    }
+    node_positions[n] = target_position_fn(positioner_values);
+  }
+
+  std::vector<char> reachable(num_samples, 0);
+  std::vector<std::size_t> lower(num_joints);
+  std::vector<std::size_t> upper(num_joints);
+  for (std::size_t c = 0; c < num_cells; ++c)
+  {
+    std::size_t index = c;
+    std::size_t num_cell_samples{ 1 };
+    for (std::size_t d = num_joints; d-- > 0;)
+    {
+      const std::size_t cnt = std::max<std::size_t>(1, nodes[d].size() - 1);
+      const std::size_t cell = index % cnt;
+      index /= cnt;
+
+      lower[d] = cell;
+      upper[d] = std::min(cell + 1, nodes[d].size() - 1);
+      positioner_values(static_cast<Eigen::Index>(d)) =
+          0.5 * (dof_range[d](static_cast<Eigen::Index>(nodes[d][lower[d]])) +
+                 dof_range[d](static_cast<Eigen::Index>(nodes[d][upper[d]])));
+      num_cell_samples *= nodes[d][upper[d]] - nodes[d][lower[d]] + 1;
+    }
+
+    // Every position within the cell is bounded by the sphere around the center containing all corner positions
+    const Eigen::Vector3d center = target_position_fn(positioner_values);
+    double radius{ 0 };
+    for (std::size_t corner = 0; corner < (std::size_t{ 1 } << num_joints); ++corner)
+    {
+      std::size_t n{ 0 };
+      for (std::size_t d = 0; d < num_joints; ++d)
+        n = (n * nodes[d].size()) + (((corner >> d) & 1U) != 0 ? upper[d] : lower[d]);
+
+      radius = std::max(radius, (node_positions[n] - center).norm());
+    }
+
+    if (center.norm() - radius > reach)
+      continue;
+
+    for (std::size_t s = 0; s < num_cell_samples; ++s)
+    {
+      std::size_t cell_index = s;
+      std::size_t sample{ 0 };
+      for (std::size_t d = num_joints; d-- > 0;)
+      {
+        const std::size_t first = nodes[d][lower[d]];
+        const std::size_t cnt = nodes[d][upper[d]] - first + 1;
+        sample += (first + (cell_index % cnt)) * sample_strides[d];
+        cell_index /= cnt;
+      }
+      reachable[sample] = 1;
+    }
+  }
+
+  return reachable;
+}
 }  // namespace tesseract_kinematics
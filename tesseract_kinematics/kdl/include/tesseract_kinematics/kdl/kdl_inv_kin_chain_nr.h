@@ -104,9 +104,24 @@ public:
                    Config kdl_config,
                    std::string solver_name = KDL_INV_KIN_CHAIN_NR_SOLVER_NAME);
 
+  using InverseKinematics::calcInvKin;
   IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                          const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
 
+  /**
+   * @brief Calculate the inverse kinematics for a sequence of tip link poses, see calcInvKinSequence
+   * @details This is not part of the InverseKinematics interface. The solver is locked once for the whole sequence, so
+   * use a clone per thread to solve multiple sequences concurrently.
+   * @param solutions The solution buffer which is resized to numJoints() by tip_link_poses.size() if required
+   * @param valid The validity flag of each solution which is resized to tip_link_poses.size() if required
+   * @param tip_link_poses The tip link poses relative to the working frame
+   * @param seed The seed used for the first pose
+   */
+  void calcInvKin(Eigen::MatrixXd& solutions,
+                  std::vector<char>& valid,
+                  const tesseract_common::VectorIsometry3d& tip_link_poses,
+                  const Eigen::Ref<const Eigen::VectorXd>& seed) const;
+
   std::vector<std::string> getJointNames() const override final;
   Eigen::Index numJoints() const override final;
   std::string getBaseLinkName() const override final;
@@ -123,11 +138,20 @@ private:
   std::unique_ptr<KDL::ChainIkSolverPos_NR> ik_solver_;         /**< @brief KDL Inverse kinematic solver */
   std::string solver_name_{ KDL_INV_KIN_CHAIN_NR_SOLVER_NAME }; /**< @brief Name of this solver */
   mutable std::mutex mutex_; /**< @brief KDL is not thread safe due to mutable variables in Joint Class */
+  mutable KDL::JntArray kdl_seed_;     /**< @brief The reusable solver seed, guarded by mutex_ */
+  mutable KDL::JntArray kdl_solution_; /**< @brief The reusable solver solution, guarded by mutex_ */
 
   /** @brief calcFwdKin helper function */
   IKSolutions calcInvKinHelper(const Eigen::Isometry3d& pose,
                                const Eigen::Ref<const Eigen::VectorXd>& seed,
                                int segment_num = -1) const;
+
+  /**
+   * @brief Solve for the pose starting from kdl_seed_ and store the result in kdl_solution_
+   * @details The caller must hold mutex_
+   * @return The KDL solver status
+   */
+  int solve(const Eigen::Isometry3d& pose) const;
 };
 
 }  // namespace tesseract_kinematics
@@ -33,8 +33,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <kdl/tree.hpp>
 #include <kdl/chain.hpp>
 #include <Eigen/Geometry>
+#include <console_bridge/console.h>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/eigen_types.h>
 #include <tesseract_scene_graph/fwd.h>
 
 namespace tesseract_kinematics
@@ -125,5 +128,54 @@ bool parseSceneGraph(KDLChainData& results,
                      const tesseract_scene_graph::SceneGraph& scene_graph,
                      const std::string& base_name,
                      const std::string& tip_name);
+
+/**
+ * @brief Calculate the inverse kinematics for a sequence of tip link poses using a KDL solver
+ * @details Each pose is seeded with the most recent solution found, so dense toolpaths converge in far fewer
+ * iterations than solving every pose from the same seed. No memory is allocated when the buffers already have the
+ * required size. The caller must hold the lock of the solver workspace for the whole sequence. Solution i is stored in
+ * column i and it is only valid if flag i is set.
+ * @param solutions The solution buffer which is resized to seed.size() by tip_link_poses.size() if required
+ * @param valid The validity flag of each solution which is resized to tip_link_poses.size() if required
+ * @param kdl_seed The solver seed used by solve
+ * @param kdl_solution The solver solution populated by solve
+ * @param tip_link_poses The tip link poses relative to the working frame
+ * @param seed The seed used for the first pose
+ * @param solve Solves for a pose starting from kdl_seed and stores the result in kdl_solution, returning the KDL status
+ * @param solver_name The solver name used in the debug messages
+ */
+template <typename SolveFn>
+void calcInvKinSequence(Eigen::MatrixXd& solutions,
+                        std::vector<char>& valid,
+                        KDL::JntArray& kdl_seed,
+                        const KDL::JntArray& kdl_solution,
+                        const tesseract_common::VectorIsometry3d& tip_link_poses,
+                        const Eigen::Ref<const Eigen::VectorXd>& seed,
+                        const SolveFn& solve,
+                        const std::string& solver_name)
+{
+  const auto num_poses = static_cast<Eigen::Index>(tip_link_poses.size());
+  if (solutions.rows() != seed.size() || solutions.cols() != num_poses)
+    solutions.resize(seed.size(), num_poses);
+
+  if (valid.size() != tip_link_poses.size())
+    valid.resize(tip_link_poses.size());
+
+  kdl_seed.data = seed;
+  for (std::size_t i = 0; i < tip_link_poses.size(); ++i)
+  {
+    valid[i] = static_cast<char>(solve(tip_link_poses[i]) >= 0);
+    if (valid[i] == 0)
+    {
+      CONSOLE_BRIDGE_logDebug("%s Failed to calculate IK for pose %zu", solver_name.c_str(), i);
+      continue;
+    }
+
+    solutions.col(static_cast<Eigen::Index>(i)) = kdl_solution.data;
+
+    // Warm start the next pose from this solution
+    kdl_seed.data = kdl_solution.data;
+  }
+}
 }  // namespace tesseract_kinematics
 #endif  // TESSERACT_KINEMATICS_KDL_UTILS_H
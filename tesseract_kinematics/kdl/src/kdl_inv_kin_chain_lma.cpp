@@ -57,6 +57,8 @@ KDLInvKinChainLMA::KDLInvKinChainLMA(const tesseract_scene_graph::SceneGraph& sc
                                                   kdl_config_.eps,
                                                   kdl_config_.max_iterations,
                                                   kdl_config_.eps_joints);
+  kdl_seed_.resize(kdl_data_.robot_chain.getNrOfJoints());
+  kdl_solution_.resize(kdl_data_.robot_chain.getNrOfJoints());
 }
 
 KDLInvKinChainLMA::KDLInvKinChainLMA(const tesseract_scene_graph::SceneGraph& scene_graph,
@@ -82,6 +84,8 @@ KDLInvKinChainLMA& KDLInvKinChainLMA::operator=(const KDLInvKinChainLMA& other)
                                                   kdl_config_.eps,
                                                   kdl_config_.max_iterations,
                                                   kdl_config_.eps_joints);
+  kdl_seed_.resize(kdl_data_.robot_chain.getNrOfJoints());
+  kdl_solution_.resize(kdl_data_.robot_chain.getNrOfJoints());
   solver_name_ = other.solver_name_;
 
   return *this;
@@ -91,20 +95,14 @@ IKSolutions KDLInvKinChainLMA::calcInvKinHelper(const Eigen::Isometry3d& pose,
                                                 const Eigen::Ref<const Eigen::VectorXd>& seed,
                                                 int /*segment_num*/) const
 {
-  assert(std::abs(1.0 - pose.matrix().determinant()) < 1e-6);  // NOLINT
-  KDL::JntArray kdl_seed;
-  KDL::JntArray kdl_solution;
-  EigenToKDL(seed, kdl_seed);
-  kdl_solution.resize(static_cast<unsigned>(seed.size()));
+  assert(seed.size() == numJoints());
   Eigen::VectorXd solution(seed.size());
-
-  // run IK solver
-  KDL::Frame kdl_pose;
-  EigenToKDL(pose, kdl_pose);
   int status{ -1 };
   {
     std::lock_guard<std::mutex> guard(mutex_);
-    status = ik_solver_->CartToJnt(kdl_seed, kdl_pose, kdl_solution);
+    kdl_seed_.data = seed;
+    status = solve(pose);
+    solution = kdl_solution_.data;
   }
   if (status < 0)
   {
@@ -129,11 +127,17 @@ IKSolutions KDLInvKinChainLMA::calcInvKinHelper(const Eigen::Isometry3d& pose,
     return {};
   }
 
-  KDLToEigen(kdl_solution, solution);
-
   return { solution };
 }
 
+int KDLInvKinChainLMA::solve(const Eigen::Isometry3d& pose) const
+{
+  assert(std::abs(1.0 - pose.matrix().determinant()) < 1e-6);  // NOLINT
+  KDL::Frame kdl_pose;
+  EigenToKDL(pose, kdl_pose);
+  return ik_solver_->CartToJnt(kdl_seed_, kdl_pose, kdl_solution_);
+}
+
 IKSolutions KDLInvKinChainLMA::calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                                           const Eigen::Ref<const Eigen::VectorXd>& seed) const
 {
@@ -141,6 +145,17 @@ IKSolutions KDLInvKinChainLMA::calcInvKin(const tesseract_common::TransformMap&
   return calcInvKinHelper(tip_link_poses.at(kdl_data_.tip_link_name), seed);
 }
 
+void KDLInvKinChainLMA::calcInvKin(Eigen::MatrixXd& solutions,
+                                   std::vector<char>& valid,
+                                   const tesseract_common::VectorIsometry3d& tip_link_poses,
+                                   const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  assert(seed.size() == numJoints());
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto solve_fn = [this](const Eigen::Isometry3d& pose) { return solve(pose); };
+  calcInvKinSequence(solutions, valid, kdl_seed_, kdl_solution_, tip_link_poses, seed, solve_fn, solver_name_);
+}
+
 std::vector<std::string> KDLInvKinChainLMA::getJointNames() const { return kdl_data_.joint_names; }
 
 Eigen::Index KDLInvKinChainLMA::numJoints() const { return kdl_data_.robot_chain.getNrOfJoints(); }
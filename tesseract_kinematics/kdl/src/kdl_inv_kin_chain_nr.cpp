@@ -56,6 +56,8 @@ KDLInvKinChainNR::KDLInvKinChainNR(const tesseract_scene_graph::SceneGraph& scen
       kdl_data_.robot_chain, kdl_config_.vel_eps, kdl_config_.vel_iterations);
   ik_solver_ = std::make_unique<KDL::ChainIkSolverPos_NR>(
       kdl_data_.robot_chain, *fk_solver_, *ik_vel_solver_, kdl_config_.pos_iterations, kdl_config_.pos_eps);
+  kdl_seed_.resize(kdl_data_.robot_chain.getNrOfJoints());
+  kdl_solution_.resize(kdl_data_.robot_chain.getNrOfJoints());
 }
 
 KDLInvKinChainNR::KDLInvKinChainNR(const tesseract_scene_graph::SceneGraph& scene_graph,
@@ -80,6 +82,8 @@ KDLInvKinChainNR& KDLInvKinChainNR::operator=(const KDLInvKinChainNR& other)
       kdl_data_.robot_chain, kdl_config_.vel_eps, kdl_config_.vel_iterations);
   ik_solver_ = std::make_unique<KDL::ChainIkSolverPos_NR>(
       kdl_data_.robot_chain, *fk_solver_, *ik_vel_solver_, kdl_config_.pos_iterations, kdl_config_.pos_eps);
+  kdl_seed_.resize(kdl_data_.robot_chain.getNrOfJoints());
+  kdl_solution_.resize(kdl_data_.robot_chain.getNrOfJoints());
   solver_name_ = other.solver_name_;
 
   return *this;
@@ -89,21 +93,14 @@ IKSolutions KDLInvKinChainNR::calcInvKinHelper(const Eigen::Isometry3d& pose,
                                                const Eigen::Ref<const Eigen::VectorXd>& seed,
                                                int /*segment_num*/) const
 {
-  assert(std::abs(1.0 - pose.matrix().determinant()) < 1e-6);  // NOLINT
-  KDL::JntArray kdl_seed;
-  KDL::JntArray kdl_solution;
-  EigenToKDL(seed, kdl_seed);
-  kdl_solution.resize(static_cast<unsigned>(seed.size()));
+  assert(seed.size() == numJoints());
   Eigen::VectorXd solution(seed.size());
-
-  // run IK solver
-  // TODO: Need to update to handle seg number. Need to create an IK solver for each seg.
-  KDL::Frame kdl_pose;
-  EigenToKDL(pose, kdl_pose);
   int status{ -1 };
   {
     std::lock_guard<std::mutex> guard(mutex_);
-    status = ik_solver_->CartToJnt(kdl_seed, kdl_pose, kdl_solution);
+    kdl_seed_.data = seed;
+    status = solve(pose);
+    solution = kdl_solution_.data;
   }
 
   if (status < 0)
@@ -136,11 +133,19 @@ IKSolutions KDLInvKinChainNR::calcInvKinHelper(const Eigen::Isometry3d& pose,
     return {};
   }
 
-  KDLToEigen(kdl_solution, solution);
-
   return { solution };
 }
 
+int KDLInvKinChainNR::solve(const Eigen::Isometry3d& pose) const
+{
+  assert(std::abs(1.0 - pose.matrix().determinant()) < 1e-6);  // NOLINT
+
+  // TODO: Need to update to handle seg number. Need to create an IK solver for each seg.
+  KDL::Frame kdl_pose;
+  EigenToKDL(pose, kdl_pose);
+  return ik_solver_->CartToJnt(kdl_seed_, kdl_pose, kdl_solution_);
+}
+
 IKSolutions KDLInvKinChainNR::calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                                          const Eigen::Ref<const Eigen::VectorXd>& seed) const
 {
@@ -148,6 +153,17 @@ IKSolutions KDLInvKinChainNR::calcInvKin(const tesseract_common::TransformMap& t
   return calcInvKinHelper(tip_link_poses.at(kdl_data_.tip_link_name), seed);
 }
 
+void KDLInvKinChainNR::calcInvKin(Eigen::MatrixXd& solutions,
+                                  std::vector<char>& valid,
+                                  const tesseract_common::VectorIsometry3d& tip_link_poses,
+                                  const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  assert(seed.size() == numJoints());
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto solve_fn = [this](const Eigen::Isometry3d& pose) { return solve(pose); };
+  calcInvKinSequence(solutions, valid, kdl_seed_, kdl_solution_, tip_link_poses, seed, solve_fn, solver_name_);
+}
+
 std::vector<std::string> KDLInvKinChainNR::getJointNames() const { return kdl_data_.joint_names; }
 
 Eigen::Index KDLInvKinChainNR::numJoints() const { return kdl_data_.robot_chain.getNrOfJoints(); }
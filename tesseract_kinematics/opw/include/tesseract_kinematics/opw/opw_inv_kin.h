@@ -37,6 +37,9 @@ namespace tesseract_kinematics
 {
 static const std::string OPW_INV_KIN_CHAIN_SOLVER_NAME = "OPWInvKin";
 
+/** @brief The maximum number of solutions the OPW solver returns for a single pose */
+static const Eigen::Index OPW_MAX_SOLUTIONS = 8;
+
 /**@brief OPW Inverse Kinematics Implementation. */
 class OPWInvKin : public InverseKinematics
 {
@@ -73,6 +76,30 @@ public:
   IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                          const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
 
+  /**
+   * @copydoc InverseKinematics::calcInvKin(IKSolutions&, const Eigen::Isometry3d&, const Eigen::Ref<const
+   * Eigen::VectorXd>&) const
+   * @note The existing solutions are overwritten in place, so no memory is allocated when the vector already holds at
+   * least as many solutions as are found
+   */
+  void calcInvKin(IKSolutions& solutions,
+                  const Eigen::Isometry3d& tip_link_pose,
+                  const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
+
+  /**
+   * @brief Calculate the inverse kinematics for a set of tip link poses
+   * @details The solutions are written into a compact buffer which holds every candidate solution of every pose, so no
+   * memory is allocated when the buffers already have the required size. Solution j of pose i is stored in column
+   * i * OPW_MAX_SOLUTIONS + j and it is only valid if the flag at the same index is set. The solutions are not
+   * harmonized and the redundant solutions are not included.
+   * @param solutions The solution buffer which is resized to 6 by tip_link_poses.size() * OPW_MAX_SOLUTIONS if required
+   * @param valid The validity flag of each solution which is resized to match the number of solution columns
+   * @param tip_link_poses The tip link poses relative to the working frame
+   */
+  void calcInvKin(Eigen::Matrix<double, 6, Eigen::Dynamic>& solutions,
+                  std::vector<char>& valid,
+                  const tesseract_common::VectorIsometry3d& tip_link_poses) const;
+
   Eigen::Index numJoints() const override final;
   std::vector<std::string> getJointNames() const override final;
   std::string getBaseLinkName() const override final;
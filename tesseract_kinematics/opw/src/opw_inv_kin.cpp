@@ -87,6 +87,65 @@ IKSolutions OPWInvKin::calcInvKin(const tesseract_common::TransformMap& tip_link
   return solution_set;
 }
 
+void OPWInvKin::calcInvKin(IKSolutions& solutions,
+                           const Eigen::Isometry3d& tip_link_pose,
+                           const Eigen::Ref<const Eigen::VectorXd>& /*seed*/) const
+{
+  assert(std::abs(1.0 - tip_link_pose.matrix().determinant()) < 1e-6);  // NOLINT
+
+  // NOLINTNEXTLINE
+  const opw_kinematics::Solutions<double> sols = opw_kinematics::inverse(params_, tip_link_pose);
+
+  // Overwrite the existing solutions so their memory is reused
+  std::size_t num_valid{ 0 };
+  for (const auto& sol : sols)
+  {
+    if (!opw_kinematics::isValid<double>(sol))
+      continue;
+
+    Eigen::Map<const Eigen::VectorXd> solution(sol.data(), static_cast<Eigen::Index>(sol.size()));
+    if (num_valid < solutions.size())
+      solutions[num_valid] = solution;
+    else
+      solutions.emplace_back(solution);
+
+    ++num_valid;
+  }
+
+  solutions.resize(num_valid);
+}
+
+void OPWInvKin::calcInvKin(Eigen::Matrix<double, 6, Eigen::Dynamic>& solutions,
+                           std::vector<char>& valid,
+                           const tesseract_common::VectorIsometry3d& tip_link_poses) const
+{
+  static_assert(std::tuple_size<opw_kinematics::Solutions<double>>::value == OPW_MAX_SOLUTIONS,
+                "OPW_MAX_SOLUTIONS does not match the opw_kinematics solution count");
+
+  const auto num_solutions = static_cast<Eigen::Index>(tip_link_poses.size()) * OPW_MAX_SOLUTIONS;
+  if (solutions.cols() != num_solutions)
+    solutions.resize(6, num_solutions);
+
+  if (valid.size() != static_cast<std::size_t>(num_solutions))
+    valid.resize(static_cast<std::size_t>(num_solutions));
+
+  for (std::size_t i = 0; i < tip_link_poses.size(); ++i)
+  {
+    assert(std::abs(1.0 - tip_link_poses[i].matrix().determinant()) < 1e-6);  // NOLINT
+
+    // NOLINTNEXTLINE
+    const opw_kinematics::Solutions<double> sols = opw_kinematics::inverse(params_, tip_link_poses[i]);
+
+    const auto col = static_cast<Eigen::Index>(i) * OPW_MAX_SOLUTIONS;
+    for (Eigen::Index j = 0; j < OPW_MAX_SOLUTIONS; ++j)
+    {
+      const auto& sol = sols[static_cast<std::size_t>(j)];
+      solutions.col(col + j) = Eigen::Map<const Eigen::Matrix<double, 6, 1>>(sol.data());
+      valid[static_cast<std::size_t>(col + j)] = static_cast<char>(opw_kinematics::isValid<double>(sol));
+    }
+  }
+}
+
 Eigen::Index OPWInvKin::numJoints() const { return 6; }
 
 std::vector<std::string> OPWInvKin::getJointNames() const { return joint_names_; }
@@ -0,0 +1,107 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <opw_kinematics/opw_parameters.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_kinematics/opw/opw_inv_kin.h>
+
+using namespace tesseract_kinematics;
+
+opw_kinematics::Parameters<double> getOPWKinematicsParamABB()
+{
+  opw_kinematics::Parameters<double> opw_params;
+  opw_params.a1 = (0.100);
+  opw_params.a2 = (-0.135);
+  opw_params.b = (0.000);
+  opw_params.c1 = (0.615);
+  opw_params.c2 = (0.705);
+  opw_params.c3 = (0.755);
+  opw_params.c4 = (0.085);
+
+  opw_params.offsets[2] = -M_PI / 2.0;
+
+  return opw_params;
+}
+
+/** @brief A grid of tool down poses in front of the robot, some of which are not reachable */
+tesseract_common::VectorIsometry3d getPoses()
+{
+  tesseract_common::VectorIsometry3d poses;
+  Eigen::Isometry3d pose{ Eigen::Isometry3d::Identity() };
+  pose.linear() = Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitY()).toRotationMatrix();
+  for (int i = 0; i < 10; ++i)
+  {
+    for (int j = 0; j < 10; ++j)
+    {
+      for (int k = 0; k < 10; ++k)
+      {
+        pose.translation() = Eigen::Vector3d(0.6 + (0.1 * i), -0.5 + (0.1 * j), 0.2 + (0.12 * k));
+        poses.push_back(pose);
+      }
+    }
+  }
+  return poses;
+}
+
+static void BM_OPW_INV_KIN(benchmark::State& state,
+                           const OPWInvKin& inv_kin,
+                           const tesseract_common::VectorIsometry3d& poses)
+{
+  const std::string tip_link_name = inv_kin.getTipLinkNames().front();
+  const Eigen::VectorXd seed = Eigen::VectorXd::Zero(inv_kin.numJoints());
+  IKSolutions solutions;
+  for (auto _ : state)
+  {
+    for (const auto& pose : poses)
+    {
+      benchmark::DoNotOptimize(solutions = inv_kin.calcInvKin({ { tip_link_name, pose } }, seed));
+    }
+  }
+}
+
+static void BM_OPW_INV_KIN_BATCH(benchmark::State& state,
+                                 const OPWInvKin& inv_kin,
+                                 const tesseract_common::VectorIsometry3d& poses)
+{
+  Eigen::Matrix<double, 6, Eigen::Dynamic> solutions;
+  std::vector<char> valid;
+  for (auto _ : state)
+  {
+    inv_kin.calcInvKin(solutions, valid, poses);
+    benchmark::DoNotOptimize(solutions.data());
+    benchmark::DoNotOptimize(valid.data());
+  }
+}
+
+int main(int argc, char** argv)
+{
+  std::vector<std::string> joint_names{ "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  OPWInvKin inv_kin(getOPWKinematicsParamABB(), "base_link", "tool0", joint_names);
+  tesseract_common::VectorIsometry3d poses = getPoses();
+
+  //////////////////////////////////////
+  // Benchmarks
+  //////////////////////////////////////
+
+  {
+    std::function<void(benchmark::State&, const OPWInvKin&, const tesseract_common::VectorIsometry3d&)> BM_INV_KIN =
+        BM_OPW_INV_KIN;
+    std::string name = "BM_OPW_INV_KIN";
+    benchmark::RegisterBenchmark(name.c_str(), BM_INV_KIN, inv_kin, poses)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+  {
+    std::function<void(benchmark::State&, const OPWInvKin&, const tesseract_common::VectorIsometry3d&)>
+        BM_INV_KIN_BATCH = BM_OPW_INV_KIN_BATCH;
+    std::string name = "BM_OPW_INV_KIN_BATCH";
+    benchmark::RegisterBenchmark(name.c_str(), BM_INV_KIN_BATCH, inv_kin, poses)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -13,6 +13,61 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 using namespace tesseract_kinematics::test_suite;
 
+template <typename InvKinType>
+void runInvKinBatchIIWATest(const InvKinType& inv_kin, const tesseract_scene_graph::SceneGraph& scene_graph)
+{
+  tesseract_kinematics::KDLFwdKinChain fwd_kin(scene_graph, "base_link", "tool0");
+
+  // A dense joint space path with an unreachable pose in the middle
+  Eigen::VectorXd start(7);
+  start << -0.5, 0.5, -0.5, 0.5, -0.5, 0.5, -0.5;
+  Eigen::VectorXd step(7);
+  step << 0.01, -0.01, 0.01, 0.02, 0.01, -0.01, 0.01;
+
+  tesseract_common::VectorIsometry3d poses;
+  for (int i = 0; i < 20; ++i)
+  {
+    Eigen::VectorXd joint_values = start + (i * step);
+    poses.push_back(fwd_kin.calcFwdKin(joint_values).at("tool0"));
+  }
+
+  Eigen::Isometry3d unreachable{ Eigen::Isometry3d::Identity() };
+  unreachable.translation() = Eigen::Vector3d(10, 0, 0);
+  poses.insert(poses.begin() + 10, unreachable);
+
+  Eigen::MatrixXd solutions;
+  std::vector<char> valid;
+  inv_kin.calcInvKin(solutions, valid, poses, start);
+  EXPECT_EQ(solutions.rows(), 7);
+  EXPECT_EQ(solutions.cols(), static_cast<Eigen::Index>(poses.size()));
+  ASSERT_EQ(valid.size(), poses.size());
+
+  // The first pose uses the provided seed so it must match the single pose solve
+  tesseract_kinematics::IKSolutions expected = inv_kin.calcInvKin({ { "tool0", poses[0] } }, start);
+  ASSERT_EQ(expected.size(), 1);
+  ASSERT_NE(valid[0], 0);
+  EXPECT_TRUE(solutions.col(0).isApprox(expected[0], 1e-12));
+
+  for (std::size_t i = 0; i < poses.size(); ++i)
+  {
+    if (i == 10)
+    {
+      EXPECT_EQ(valid[i], 0);
+      continue;
+    }
+
+    ASSERT_NE(valid[i], 0);
+    Eigen::VectorXd solution = solutions.col(static_cast<Eigen::Index>(i));
+    EXPECT_TRUE(fwd_kin.calcFwdKin(solution).at("tool0").isApprox(poses[i], 1e-4));
+  }
+
+  // Reusing the buffers does not change the result
+  Eigen::MatrixXd solutions_reused = solutions;
+  inv_kin.calcInvKin(solutions_reused, valid, poses, start);
+  EXPECT_TRUE(solutions_reused.col(0).isApprox(solutions.col(0), 1e-12));
+  EXPECT_TRUE(solutions_reused.rightCols(10).isApprox(solutions.rightCols(10), 1e-12));
+}
+
 TEST(TesseractKinematicsUnit, KDLKinChainLMAInverseKinematicUnit)  // NOLINT
 {
   tesseract_common::GeneralResourceLocator locator;
@@ -20,6 +75,7 @@ TEST(TesseractKinematicsUnit, KDLKinChainLMAInverseKinematicUnit)  // NOLINT
 
   tesseract_kinematics::KDLInvKinChainLMA::Config config;
   tesseract_kinematics::KDLInvKinChainLMA derived_kin(*scene_graph, "base_link", "tool0", config);
+  runInvKinBatchIIWATest(derived_kin, *scene_graph);
 
   tesseract_kinematics::KinematicsPluginFactory factory;
   runInvKinIIWATest(factory, "KDLInvKinChainLMAFactory", "KDLFwdKinChainFactory");
@@ -32,6 +88,7 @@ TEST(TesseractKinematicsUnit, KDLKinChainNRInverseKinematicUnit)  // NOLINT
 
   tesseract_kinematics::KDLInvKinChainNR::Config config;
   tesseract_kinematics::KDLInvKinChainNR derived_kin(*scene_graph, "base_link", "tool0", config);
+  runInvKinBatchIIWATest(derived_kin, *scene_graph);
 
   tesseract_kinematics::KinematicsPluginFactory factory;
   runInvKinIIWATest(factory, "KDLInvKinChainNRFactory", "KDLFwdKinChainFactory");
@@ -44,6 +101,7 @@ TEST(TesseractKinematicsUnit, KDLKinChainNR_JLInverseKinematicUnit)  // NOLINT
 
   tesseract_kinematics::KDLInvKinChainNR_JL::Config config;
   tesseract_kinematics::KDLInvKinChainNR_JL derived_kin(*scene_graph, "base_link", "tool0", config);
+  runInvKinBatchIIWATest(derived_kin, *scene_graph);
 
   tesseract_kinematics::KinematicsPluginFactory factory;
   runInvKinIIWATest(factory, "KDLInvKinChainNR_JLFactory", "KDLFwdKinChainFactory");
@@ -1,9 +1,11 @@
 ﻿#include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <algorithm>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_kinematics/kdl/kdl_fwd_kin_chain.h>
+#include <tesseract_kinematics/core/ik_solution_cache.h>
 #include <tesseract_kinematics/core/utils.h>
 #include "kinematics_test_utils.h"
 
@@ -244,6 +246,39 @@ void runRedundantSolutionsTest()
     EXPECT_THROW(tesseract_kinematics::getRedundantSolutions<FloatType>(q, limits, redundancy_capable_joints),
                  std::runtime_error);
   }
+
+  {  // Test the fixed size variant matches the dynamic size variant
+    Eigen::MatrixX2d limits(6, 2);
+    limits << -2.0 * M_PI, 2.0 * M_PI, -M_PI, M_PI, -2.0 * M_PI, 2.0 * M_PI, -2.0 * M_PI, 2.0 * M_PI, -3.0 * M_PI,
+        3.0 * M_PI, -2.0 * M_PI, 2.0 * M_PI;
+    std::vector<Eigen::Index> redundancy_capable_joints = { 0, 2, 3, 4, 5 };
+
+    Eigen::Matrix<FloatType, 6, 1> q;
+    q << static_cast<FloatType>(0.5), static_cast<FloatType>(-0.5), static_cast<FloatType>(1.0),
+        static_cast<FloatType>(-1.0), static_cast<FloatType>(2.0), static_cast<FloatType>(-4.0 * M_PI);
+
+    std::vector<tesseract_kinematics::VectorX<FloatType>> expected =
+        tesseract_kinematics::getRedundantSolutions<FloatType>(q, limits, redundancy_capable_joints);
+
+    // The solutions are appended to the existing contents
+    tesseract_common::AlignedVector<Eigen::Matrix<FloatType, 6, 1>> solutions{ q };
+    tesseract_kinematics::getRedundantSolutions<FloatType, 6>(solutions, q, limits, redundancy_capable_joints);
+
+    ASSERT_EQ(solutions.size(), expected.size() + 1);
+    EXPECT_TRUE(solutions.front().isApprox(q));
+    for (std::size_t i = 0; i < expected.size(); ++i)
+      EXPECT_TRUE(solutions[i + 1].isApprox(expected[i]));
+
+    expected.emplace_back(q);
+    expect_unique_solutions(expected);
+
+    redundancy_capable_joints = { 6 };
+
+    // NOLINTNEXTLINE
+    EXPECT_THROW(
+        (tesseract_kinematics::getRedundantSolutions<FloatType, 6>(solutions, q, limits, redundancy_capable_joints)),
+        std::runtime_error);
+  }
 }
 
 TEST(TesseractKinematicsUnit, RedundantSolutionsUnit)  // NOLINT
@@ -252,6 +287,91 @@ TEST(TesseractKinematicsUnit, RedundantSolutionsUnit)  // NOLINT
   runRedundantSolutionsTest<double>();
 }
 
+TEST(TesseractKinematicsUnit, UtilsSampleInvKinUnit)  // NOLINT
+{
+  std::vector<Eigen::VectorXd> dof_range{ Eigen::VectorXd::LinSpaced(11, -1, 1), Eigen::VectorXd::LinSpaced(9, -1, 1) };
+
+  // The target position is an affine function of the positioner values like for a two axis rail
+  auto target_position_fn = [](const Eigen::Ref<const Eigen::VectorXd>& positioner_values) {
+    return Eigen::Vector3d(0.5 - positioner_values(0), 0.25 + positioner_values(1), 0.1);
+  };
+
+  // Every sample within reach returns a solution containing its positioner values
+  const double reach = 0.6;
+  auto create_fn = [&](std::size_t /*thread*/) -> tesseract_kinematics::PositionerSampleIKFn {
+    return [&](tesseract_kinematics::IKSolutions& solutions,
+               const Eigen::Ref<const Eigen::VectorXd>& positioner_values) {
+      if (target_position_fn(positioner_values).norm() <= reach)
+        solutions.emplace_back(positioner_values);
+    };
+  };
+
+  tesseract_kinematics::IKSolutions expected;
+  for (Eigen::Index i = 0; i < dof_range[0].size(); ++i)
+  {
+    for (Eigen::Index j = 0; j < dof_range[1].size(); ++j)
+    {
+      Eigen::Vector2d positioner_values(dof_range[0](i), dof_range[1](j));
+      if (target_position_fn(positioner_values).norm() <= reach)
+        expected.emplace_back(positioner_values);
+    }
+  }
+  ASSERT_GT(expected.size(), 5);
+
+  auto expect_prefix = [&expected](const tesseract_kinematics::IKSolutions& solutions, std::size_t size) {
+    ASSERT_EQ(solutions.size(), size);
+    for (std::size_t i = 0; i < size; ++i)
+      EXPECT_TRUE(solutions[i].isApprox(expected[i]));
+  };
+
+  for (std::size_t num_threads : { 1, 2, 4, 0 })
+  {
+    expect_prefix(tesseract_kinematics::sampleInvKin(dof_range, create_fn, num_threads), expected.size());
+    expect_prefix(tesseract_kinematics::sampleInvKin(dof_range, create_fn, num_threads, 5), 5);
+  }
+
+  for (std::size_t stride : { 1, 2, 3, 20 })
+  {
+    std::vector<char> sample_mask =
+        tesseract_kinematics::calcReachableSamples(dof_range, stride, reach, target_position_fn);
+    ASSERT_EQ(sample_mask.size(), 99);
+
+    // A sample within reach is never skipped
+    for (Eigen::Index i = 0; i < dof_range[0].size(); ++i)
+    {
+      for (Eigen::Index j = 0; j < dof_range[1].size(); ++j)
+      {
+        Eigen::Vector2d positioner_values(dof_range[0](i), dof_range[1](j));
+        if (target_position_fn(positioner_values).norm() <= reach)
+        {
+          EXPECT_NE(sample_mask[static_cast<std::size_t>((i * dof_range[1].size()) + j)], 0);
+        }
+      }
+    }
+
+    // A single coarse cell covers the whole grid
+    auto num_kept = static_cast<std::size_t>(std::count(sample_mask.begin(), sample_mask.end(), 1));
+    if (stride < 3)
+    {
+      EXPECT_LT(num_kept, sample_mask.size());
+    }
+    else if (stride == 20)
+    {
+      EXPECT_EQ(num_kept, sample_mask.size());
+    }
+
+    expect_prefix(tesseract_kinematics::sampleInvKin(dof_range, create_fn, 1, 0, sample_mask), expected.size());
+    expect_prefix(tesseract_kinematics::sampleInvKin(dof_range, create_fn, 4, 0, sample_mask), expected.size());
+  }
+
+  // Nothing is within reach
+  std::vector<char> sample_mask = tesseract_kinematics::calcReachableSamples(
+      dof_range, 2, 0.05, [](const Eigen::Ref<const Eigen::VectorXd>& /*positioner_values*/) {
+        return Eigen::Vector3d(1, 0, 0);
+      });
+  EXPECT_EQ(std::count(sample_mask.begin(), sample_mask.end(), 1), 0);
+}
+
 TEST(TesseractKinematicsUnit, UtilsNearSingularityUnit)  // NOLINT
 {
   tesseract_common::GeneralResourceLocator locator;
@@ -330,6 +450,110 @@ TEST(TesseractKinematicsUnit, UtilscalcManipulabilityUnit)  // NOLINT
   EXPECT_NEAR(m.f_angular.volume, 0.408248290463863, 1e-6);
 }
 
+TEST(TesseractKinematicsUnit, IKSolutionCacheUnit)  // NOLINT
+{
+  using tesseract_kinematics::IKSolutionCache;
+
+  EXPECT_ANY_THROW(IKSolutionCache(0));           // NOLINT
+  EXPECT_ANY_THROW(IKSolutionCache(1, 0, 1e-3));  // NOLINT
+  EXPECT_ANY_THROW(IKSolutionCache(1, 1e-3, 0));  // NOLINT
+
+  IKSolutionCache cache(2, 1e-3, 1e-3);
+  EXPECT_EQ(cache.capacity(), 2);
+  EXPECT_EQ(cache.size(), 0);
+
+  Eigen::Isometry3d pose1{ Eigen::Isometry3d::Identity() };
+  pose1.translation() = Eigen::Vector3d(0.5, 0.1, 0.3);
+  Eigen::Isometry3d pose2 = pose1 * Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitZ());
+  Eigen::Isometry3d pose3 = pose1 * Eigen::Translation3d(0.1, 0, 0);
+
+  tesseract_kinematics::IKSolutions solutions1{ Eigen::VectorXd::Constant(6, 1) };
+  tesseract_kinematics::IKSolutions solutions2{ Eigen::VectorXd::Constant(6, 2), Eigen::VectorXd::Constant(6, 3) };
+  tesseract_kinematics::IKSolutions solutions3{ Eigen::VectorXd::Constant(6, 4) };
+
+  tesseract_kinematics::IKSolutions found;
+  EXPECT_EQ(cache.find(found, { { "tool0", pose1 } }), IKSolutionCache::Result::MISS);
+  EXPECT_TRUE(found.empty());
+
+  cache.insert({ { "tool0", pose1 } }, solutions1);
+  cache.insert({ { "tool0", pose2 } }, solutions2);
+  EXPECT_EQ(cache.size(), 2);
+
+  // Exact hits
+  EXPECT_EQ(cache.find(found, { { "tool0", pose1 } }), IKSolutionCache::Result::HIT);
+  ASSERT_EQ(found.size(), 1);
+  EXPECT_TRUE(found[0].isApprox(solutions1[0]));
+  EXPECT_EQ(cache.find(found, { { "tool0", pose2 } }), IKSolutionCache::Result::HIT);
+  ASSERT_EQ(found.size(), 2);
+  EXPECT_TRUE(found[1].isApprox(solutions2[1]));
+
+  // A different tip link is a miss
+  EXPECT_EQ(cache.find(found, { { "tool1", pose1 } }), IKSolutionCache::Result::MISS);
+
+  // A pose in the same quantization cell is a near hit, and a quaternion with a negative w is the same rotation
+  Eigen::Isometry3d pose1_near = pose1 * Eigen::Translation3d(1e-5, 0, 0);
+  EXPECT_EQ(cache.find(found, { { "tool0", pose1_near } }), IKSolutionCache::Result::NEAR_HIT);
+  ASSERT_EQ(found.size(), 1);
+  EXPECT_TRUE(found[0].isApprox(solutions1[0]));
+
+  Eigen::Isometry3d pose_flipped = pose1 * Eigen::AngleAxisd(2 * M_PI - 1e-9, Eigen::Vector3d::UnitZ());
+  EXPECT_NE(cache.find(found, { { "tool0", pose_flipped } }), IKSolutionCache::Result::MISS);
+
+  EXPECT_EQ(cache.getHits(), 2);
+  EXPECT_EQ(cache.getNearHits(), 2);
+  EXPECT_EQ(cache.getMisses(), 2);
+
+  // pose1 was used most recently so pose2 is evicted
+  cache.insert({ { "tool0", pose3 } }, solutions3);
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.find(found, { { "tool0", pose2 } }), IKSolutionCache::Result::MISS);
+  EXPECT_EQ(cache.find(found, { { "tool0", pose3 } }), IKSolutionCache::Result::HIT);
+  EXPECT_NE(cache.find(found, { { "tool0", pose1 } }), IKSolutionCache::Result::MISS);
+
+  // Inserting a near pose replaces the entry so it becomes an exact hit
+  cache.insert({ { "tool0", pose1_near } }, solutions3);
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.find(found, { { "tool0", pose1_near } }), IKSolutionCache::Result::HIT);
+  ASSERT_EQ(found.size(), 1);
+  EXPECT_TRUE(found[0].isApprox(solutions3[0]));
+
+  // Multiple tip links, the key does not depend on the order of the poses
+  cache.insert({ { "tool0", pose1 }, { "tool1", pose2 } }, solutions2);
+  EXPECT_EQ(cache.find(found, { { "tool0", pose1 }, { "tool1", pose2 } }), IKSolutionCache::Result::HIT);
+  EXPECT_EQ(cache.find(found, { { "tool1", pose2 }, { "tool0", pose1 } }), IKSolutionCache::Result::HIT);
+  EXPECT_EQ(cache.find(found, { { "tool0", pose2 }, { "tool1", pose1 } }), IKSolutionCache::Result::MISS);
+  EXPECT_EQ(cache.find(found, { { "tool0", pose1 }, { "tool1", pose3 } }), IKSolutionCache::Result::MISS);
+
+  // Solver binding
+  EXPECT_EQ(cache.getSolverId(), 0);
+  EXPECT_ANY_THROW(cache.bindSolver(0));  // NOLINT
+  cache.bindSolver(1);
+  cache.bindSolver(1);
+  EXPECT_EQ(cache.getSolverId(), 1);
+  EXPECT_ANY_THROW(cache.bindSolver(2));  // NOLINT
+
+  // Only the bound solver finds and inserts entries
+  const std::size_t size = cache.size();
+  EXPECT_EQ(cache.find(found, { { "tool0", pose1_near } }, 1), IKSolutionCache::Result::HIT);
+  EXPECT_EQ(cache.find(found, { { "tool0", pose1_near } }, 2), IKSolutionCache::Result::MISS);
+  EXPECT_EQ(cache.find(found, { { "tool0", pose1_near } }), IKSolutionCache::Result::MISS);
+  cache.insert({ { "tool0", pose2 } }, solutions2, 2);
+  EXPECT_EQ(cache.size(), size);
+  EXPECT_EQ(cache.find(found, { { "tool0", pose2 } }, 1), IKSolutionCache::Result::MISS);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_EQ(cache.find(found, { { "tool0", pose3 } }), IKSolutionCache::Result::MISS);
+  EXPECT_EQ(cache.getSolverId(), 0);
+  cache.bindSolver(2);
+  EXPECT_EQ(cache.getSolverId(), 2);
+
+  cache.resetCounters();
+  EXPECT_EQ(cache.getHits(), 0);
+  EXPECT_EQ(cache.getNearHits(), 0);
+  EXPECT_EQ(cache.getMisses(), 0);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
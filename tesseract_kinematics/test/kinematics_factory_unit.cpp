@@ -973,6 +973,20 @@ TEST(TesseractKinematicsFactoryUnit, LoadREPKinematicsUnit)  // NOLINT
     auto inv_kin = factory.createInvKin("manipulator", "REPInvKin", *scene_graph, scene_state);
     EXPECT_TRUE(inv_kin == nullptr);
   }
+  {  // coarse sampling is only supported when every positioner joint is prismatic
+    YAML::Node config = YAML::Load(yaml_string);
+    auto plugin = config["kinematic_plugins"]["inv_kin_plugins"]["manipulator"]["plugins"]["REPInvKin"];
+    plugin["config"]["coarse_sample_stride"] = 4;
+
+    KinematicsPluginFactory factory(config);
+    auto inv_kin = factory.createInvKin("manipulator", "REPInvKin", *scene_graph, scene_state);
+    EXPECT_TRUE(inv_kin != nullptr);
+
+    auto revolute_scene_graph = getSceneGraphABBExternalPositioner(locator);
+    changeJointType(*revolute_scene_graph, "positioner_joint_1", tesseract_scene_graph::JointType::REVOLUTE);
+    inv_kin = factory.createInvKin("manipulator", "REPInvKin", *revolute_scene_graph, scene_state);
+    EXPECT_TRUE(inv_kin == nullptr);
+  }
 }
 
 TEST(TesseractKinematicsFactoryUnit, LoadROPKinematicsUnit)  // NOLINT
@@ -1106,6 +1120,20 @@ TEST(TesseractKinematicsFactoryUnit, LoadROPKinematicsUnit)  // NOLINT
     auto inv_kin = factory.createInvKin("manipulator", "ROPInvKin", *scene_graph, scene_state);
     EXPECT_TRUE(inv_kin == nullptr);
   }
+  {  // coarse sampling is only supported when every positioner joint is prismatic
+    YAML::Node config = YAML::Load(yaml_string);
+    auto plugin = config["kinematic_plugins"]["inv_kin_plugins"]["manipulator"]["plugins"]["ROPInvKin"];
+    plugin["config"]["coarse_sample_stride"] = 4;
+
+    KinematicsPluginFactory factory(config);
+    auto inv_kin = factory.createInvKin("manipulator", "ROPInvKin", *scene_graph, scene_state);
+    EXPECT_TRUE(inv_kin != nullptr);
+
+    auto revolute_scene_graph = getSceneGraphABBOnPositioner(locator);
+    changeJointType(*revolute_scene_graph, "positioner_joint_1", tesseract_scene_graph::JointType::REVOLUTE);
+    inv_kin = factory.createInvKin("manipulator", "ROPInvKin", *revolute_scene_graph, scene_state);
+    EXPECT_TRUE(inv_kin == nullptr);
+  }
 }
 
 TEST(TesseractKinematicsFactoryUnit, LoadKDLKinematicsUnit)  // NOLINT
@@ -74,6 +74,22 @@ getSceneGraphABBOnPositioner(const tesseract_common::ResourceLocator& locator)
   return tesseract_urdf::parseURDFFile(path, locator);
 }
 
+/**
+ * @brief Change the type of a scene graph joint, used to test the positioner solvers with a revolute positioner joint
+ * @param scene_graph The scene graph containing the joint
+ * @param joint_name The name of the joint to change
+ * @param type The new joint type
+ */
+inline void changeJointType(tesseract_scene_graph::SceneGraph& scene_graph,
+                            const std::string& joint_name,
+                            tesseract_scene_graph::JointType type)
+{
+  tesseract_scene_graph::Joint joint = scene_graph.getJoint(joint_name)->clone();
+  joint.type = type;
+  EXPECT_TRUE(scene_graph.removeJoint(joint_name));
+  EXPECT_TRUE(scene_graph.addJoint(joint));
+}
+
 inline tesseract_scene_graph::SceneGraph::UPtr getSceneGraphABB(const tesseract_common::ResourceLocator& locator)
 {
   std::string path = locator.locateResource("package://tesseract_support/urdf/abb_irb2400.urdf")->getFilePath();
@@ -324,6 +340,40 @@ inline void runJacobianTest(tesseract_kinematics::KinematicGroup& kin_group,
 
   std::vector<std::string> static_link_names = kin_group.getStaticLinkNames();
   tesseract_common::TransformMap poses = kin_group.calcFwdKin(jvals);
+
+  {  // Test jacobians of multiple links
+    std::vector<std::string> link_names = kin_group.getActiveLinkNames();
+    link_names.push_back(link_name);
+    tesseract_common::VectorVector3d link_points(link_names.size(), link_point);
+
+    Eigen::MatrixXd jacobians(6 * static_cast<Eigen::Index>(link_names.size()), kin_group.numJoints());
+    kin_group.calcJacobians(jacobians, jvals, link_names, link_points);
+    for (std::size_t i = 0; i < link_names.size(); ++i)
+    {
+      jacobian = kin_group.calcJacobian(jvals, link_names[i], link_point);
+      EXPECT_TRUE(jacobian.isApprox(jacobians.middleRows(6 * static_cast<Eigen::Index>(i), 6), 1e-6));
+    }
+
+    kin_group.calcJacobians(jacobians, jvals, link_names);
+    for (std::size_t i = 0; i < link_names.size(); ++i)
+    {
+      jacobian = kin_group.calcJacobian(jvals, link_names[i]);
+      EXPECT_TRUE(jacobian.isApprox(jacobians.middleRows(6 * static_cast<Eigen::Index>(i), 6), 1e-6));
+    }
+
+    // Reusing a workspace gives the same result
+    tesseract_kinematics::JointGroup::Workspace workspace;
+    for (int k = 0; k < 2; ++k)
+    {
+      kin_group.calcJacobians(jacobians, jvals, link_names, link_points, workspace);
+      for (std::size_t i = 0; i < link_names.size(); ++i)
+      {
+        jacobian = kin_group.calcJacobian(jvals, link_names[i], link_point);
+        EXPECT_TRUE(jacobian.isApprox(jacobians.middleRows(6 * static_cast<Eigen::Index>(i), 6), 1e-6));
+      }
+    }
+  }
+
   for (const auto& static_link_name : static_link_names)
   {
     {  // Test with all information
@@ -356,6 +406,54 @@ inline void runJacobianTest(tesseract_kinematics::KinematicGroup& kin_group,
   }
 }
 
+/**
+ * @brief Run the batched forward kinematics test
+ * @details The result of each state is compared to the single state forward kinematics, with and without reusing a
+ * workspace for a different number of states.
+ * @param kin_group The kinematic group
+ * @param jvals The joint values used to create the states
+ */
+inline void runFwdKinBatchTest(tesseract_kinematics::KinematicGroup& kin_group, const Eigen::VectorXd& jvals)
+{
+  const std::vector<std::string> link_names = kin_group.getLinkNames();
+  auto check_link_transforms = [&kin_group, &link_names](const tesseract_common::VectorIsometry3d& link_transforms,
+                                                         const tesseract_common::TrajArray& traj) {
+    EXPECT_EQ(link_transforms.size(), static_cast<std::size_t>(traj.rows()) * link_names.size());
+    for (Eigen::Index i = 0; i < traj.rows(); ++i)
+    {
+      tesseract_common::TransformMap expected_poses = kin_group.calcFwdKin(traj.row(i));
+      for (std::size_t j = 0; j < link_names.size(); ++j)
+      {
+        const Eigen::Isometry3d& link_tf = link_transforms[(static_cast<std::size_t>(i) * link_names.size()) + j];
+        EXPECT_TRUE(link_tf.isApprox(expected_poses.at(link_names[j]), 1e-6));
+      }
+    }
+  };
+
+  tesseract_common::TrajArray traj(2, kin_group.numJoints());
+  traj.row(0) = jvals;
+  traj.row(1) = 0.5 * jvals;
+
+  tesseract_common::VectorIsometry3d link_transforms;
+  kin_group.calcFwdKin(link_transforms, traj);
+  check_link_transforms(link_transforms, traj);
+
+  tesseract_kinematics::JointGroup::Workspace workspace;
+  kin_group.calcFwdKin(link_transforms, traj, workspace);
+  check_link_transforms(link_transforms, traj);
+
+  tesseract_common::TrajArray traj2(3, kin_group.numJoints());
+  traj2.row(0) = -jvals;
+  traj2.row(1) = jvals;
+  traj2.row(2) = 0.25 * jvals;
+  kin_group.calcFwdKin(link_transforms, traj2, workspace);
+  check_link_transforms(link_transforms, traj2);
+
+  tesseract_common::TrajArray empty_traj(0, kin_group.numJoints());
+  kin_group.calcFwdKin(link_transforms, empty_traj, workspace);
+  EXPECT_TRUE(link_transforms.empty());
+}
+
 /**
  * @brief Run kinematic limits test
  * @param limits The limits to check
@@ -514,6 +612,62 @@ inline void runInvKinTest(const tesseract_kinematics::KinematicGroup& kin_group,
   EXPECT_TRUE(checkKinematics(kin_group));
 }
 
+/**
+ * @brief Run the positioner sampling test comparing the parallel, limited and coarse sampling to the serial solutions
+ * @details The positioner joints must be prismatic so the coarse sampling does not skip any reachable sample
+ * @param inv_kin The robot with external positioner or robot on positioner inverse kinematics with default settings
+ * @param poses The tip link poses, which must have more than ten solutions
+ */
+template <typename PositionerInvKin>
+inline void runPositionerSamplingTest(PositionerInvKin& inv_kin, const tesseract_common::TransformMap& poses)
+{
+  EXPECT_EQ(inv_kin.getNumThreads(), 1);
+  EXPECT_EQ(inv_kin.getMaxSolutions(), 0);
+
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(inv_kin.numJoints());
+
+  IKSolutions expected = inv_kin.calcInvKin(poses, seed);
+  ASSERT_GT(expected.size(), 10);
+
+  auto expect_prefix = [&expected](const IKSolutions& solutions, std::size_t size) {
+    ASSERT_EQ(solutions.size(), size);
+    for (std::size_t i = 0; i < size; ++i)
+      EXPECT_TRUE(solutions[i].isApprox(expected[i], 1e-12));
+  };
+
+  // The parallel sampling returns the serial solutions in the same order
+  inv_kin.setNumThreads(4);
+  EXPECT_EQ(inv_kin.getNumThreads(), 4);
+  expect_prefix(inv_kin.calcInvKin(poses, seed), expected.size());
+
+  // Only the first solutions are returned when limited
+  inv_kin.setMaxSolutions(10);
+  EXPECT_EQ(inv_kin.getMaxSolutions(), 10);
+  expect_prefix(inv_kin.calcInvKin(poses, seed), 10);
+
+  inv_kin.setNumThreads(1);
+  expect_prefix(inv_kin.calcInvKin(poses, seed), 10);
+
+  // The positioner joints are prismatic so skipping the coarse cells out of reach does not lose any solutions
+  inv_kin.setMaxSolutions(0);
+  inv_kin.setCoarseSampleStride(4);
+  EXPECT_EQ(inv_kin.getCoarseSampleStride(), 4);
+  expect_prefix(inv_kin.calcInvKin(poses, seed), expected.size());
+
+  inv_kin.setNumThreads(4);
+  expect_prefix(inv_kin.calcInvKin(poses, seed), expected.size());
+
+  // The settings are copied when cloned
+  inv_kin.setNumThreads(0);
+  inv_kin.setMaxSolutions(10);
+  auto inv_kin2 = inv_kin.clone();
+  const auto& inv_kin2_ref = static_cast<const PositionerInvKin&>(*inv_kin2);
+  EXPECT_EQ(inv_kin2_ref.getNumThreads(), 0);
+  EXPECT_EQ(inv_kin2_ref.getMaxSolutions(), 10);
+  EXPECT_EQ(inv_kin2_ref.getCoarseSampleStride(), 4);
+  expect_prefix(inv_kin2->calcInvKin(poses, seed), 10);
+}
+
 inline void runFwdKinIIWATest(tesseract_kinematics::ForwardKinematics& kin)
 {
   //////////////////////////////////////////////////////////////////
@@ -654,6 +808,8 @@ inline void runKinGroupJacobianIIWATest(tesseract_kinematics::KinematicGroup& ki
     // NOLINTNEXTLINE
     EXPECT_ANY_THROW(runJacobianTest(kin_group, jvals, "", link_point));
   }
+
+  runFwdKinBatchTest(kin_group, jvals);
 }
 
 inline void runActiveLinkNamesIIWATest(const tesseract_kinematics::KinematicGroup& kin_group)
@@ -825,6 +981,8 @@ inline void runKinGroupJacobianABBOnPositionerTest(tesseract_kinematics::Kinemat
     // NOLINTNEXTLINE
     EXPECT_ANY_THROW(runJacobianTest(kin_group, jvals, "", link_point));
   }
+
+  runFwdKinBatchTest(kin_group, jvals);
 }
 
 inline void runActiveLinkNamesABBOnPositionerTest(const tesseract_kinematics::KinematicGroup& kin_group)
@@ -914,6 +1072,8 @@ inline void runKinGroupJacobianABBExternalPositionerTest(tesseract_kinematics::K
     // NOLINTNEXTLINE
     EXPECT_ANY_THROW(runJacobianTest(kin_group, jvals, "", link_point));
   }
+
+  runFwdKinBatchTest(kin_group, jvals);
 }
 
 inline void runActiveLinkNamesABBExternalPositionerTest(const tesseract_kinematics::KinematicGroup& kin_group)
@@ -27,6 +27,7 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <fstream>
+#include <algorithm>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include "kinematics_test_utils.h"
@@ -34,6 +35,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_kinematics/kdl/kdl_fwd_kin_chain.h>
 #include <opw_kinematics/opw_parameters.h>
 #include <tesseract_kinematics/core/kinematic_group.h>
+#include <tesseract_kinematics/core/ik_solution_cache.h>
 
 using namespace tesseract_kinematics::test_suite;
 using namespace tesseract_kinematics;
@@ -150,6 +152,240 @@ TEST(TesseractKinematicsUnit, OPWInvKinGroupUnit)  // NOLINT
   runInvKinTest(kin_group2, pose2, base_link_name, tip_link_name, seed);
 }
 
+TEST(TesseractKinematicsUnit, OPWInvKinGroupCacheUnit)  // NOLINT
+{
+  Eigen::Isometry3d pose;
+  pose.setIdentity();
+  pose.translation()[0] = 1;
+  pose.translation()[1] = 0;
+  pose.translation()[2] = 1.306;
+
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(6);
+
+  tesseract_common::GeneralResourceLocator locator;
+  auto scene_graph = getSceneGraphABB(locator);
+  std::string manip_name = "manip";
+  std::string base_link_name = "base_link";
+  std::string tip_link_name = "tool0";
+  std::vector<std::string> joint_names{ "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+
+  auto inv_kin = std::make_unique<OPWInvKin>(getOPWKinematicsParamABB(), base_link_name, tip_link_name, joint_names);
+
+  tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+  tesseract_scene_graph::SceneState scene_state = state_solver.getState();
+
+  KinematicGroup kin_group(manip_name, joint_names, std::move(inv_kin), *scene_graph, scene_state);
+  EXPECT_TRUE(kin_group.getIKCache() == nullptr);
+
+  KinGroupIKInput ik_input(pose, base_link_name, tip_link_name);
+  IKSolutions expected = kin_group.calcInvKin(ik_input, seed);
+  ASSERT_FALSE(expected.empty());
+
+  auto cache = std::make_shared<IKSolutionCache>(16);
+  kin_group.setIKCache(cache);
+  EXPECT_EQ(kin_group.getIKCache(), cache);
+
+  auto check_solutions = [&expected](const IKSolutions& solutions) {
+    ASSERT_EQ(solutions.size(), expected.size());
+    for (std::size_t i = 0; i < solutions.size(); ++i)
+      EXPECT_TRUE(solutions[i].isApprox(expected[i], 1e-12));
+  };
+
+  check_solutions(kin_group.calcInvKin(ik_input, seed));
+  EXPECT_EQ(cache->getMisses(), 1);
+  EXPECT_EQ(cache->size(), 1);
+
+  check_solutions(kin_group.calcInvKin(ik_input, seed));
+  EXPECT_EQ(cache->getHits(), 1);
+
+  // Copies share the cache
+  KinematicGroup kin_group_copy(kin_group);
+  EXPECT_EQ(kin_group_copy.getIKCache(), cache);
+  check_solutions(kin_group_copy.calcInvKin(ik_input, seed));
+  EXPECT_EQ(cache->getHits(), 2);
+
+  // A pose in the same quantization cell is solved again and replaces the entry
+  Eigen::Isometry3d near_pose = pose * Eigen::Translation3d(1e-5, 0, 0);
+  KinGroupIKInput near_ik_input(near_pose, base_link_name, tip_link_name);
+  IKSolutions near_solutions = kin_group.calcInvKin(near_ik_input, seed);
+  EXPECT_FALSE(near_solutions.empty());
+  EXPECT_EQ(cache->getNearHits(), 1);
+  EXPECT_EQ(cache->size(), 1);
+  for (const auto& sol : near_solutions)
+  {
+    tesseract_common::TransformMap result_poses = kin_group.calcFwdKin(sol);
+    Eigen::Isometry3d result = result_poses.at(base_link_name).inverse() * result_poses.at(tip_link_name);
+    EXPECT_TRUE(result.isApprox(near_pose, 1e-6));
+  }
+
+  EXPECT_EQ(kin_group.calcInvKin(near_ik_input, seed).size(), near_solutions.size());
+  EXPECT_EQ(cache->getHits(), 3);
+
+  // Disable the cache
+  kin_group.setIKCache(nullptr);
+  check_solutions(kin_group.calcInvKin(ik_input, seed));
+  EXPECT_EQ(cache->getHits(), 3);
+  EXPECT_EQ(cache->getNearHits(), 1);
+  EXPECT_EQ(cache->getMisses(), 1);
+
+  // A rebuilt kinematic group has a different solver so the cache is rejected until it is cleared
+  auto rebuilt_inv_kin =
+      std::make_unique<OPWInvKin>(getOPWKinematicsParamABB(), base_link_name, tip_link_name, joint_names);
+  KinematicGroup rebuilt_kin_group(manip_name, joint_names, std::move(rebuilt_inv_kin), *scene_graph, scene_state);
+  EXPECT_ANY_THROW(rebuilt_kin_group.setIKCache(kin_group_copy.getIKCache()));  // NOLINT
+  EXPECT_TRUE(rebuilt_kin_group.getIKCache() == nullptr);
+  kin_group.setIKCache(cache);
+
+  cache->clear();
+  EXPECT_EQ(cache->getSolverId(), 0);
+  rebuilt_kin_group.setIKCache(cache);
+  EXPECT_NE(cache->getSolverId(), 0);
+  EXPECT_ANY_THROW(kin_group.setIKCache(cache));  // NOLINT
+  check_solutions(rebuilt_kin_group.calcInvKin(ik_input, seed));
+  EXPECT_EQ(cache->getMisses(), 2);
+  EXPECT_EQ(cache->size(), 1);
+
+  // The kinematic groups bound before the cache was cleared still hold it, but they always miss and never insert
+  check_solutions(kin_group.calcInvKin(ik_input, seed));
+  check_solutions(kin_group_copy.calcInvKin(ik_input, seed));
+  EXPECT_EQ(cache->getMisses(), 4);
+  EXPECT_EQ(cache->getHits(), 3);
+
+  Eigen::Isometry3d far_pose = pose * Eigen::Translation3d(0.01, 0, 0);
+  KinGroupIKInput far_ik_input(far_pose, base_link_name, tip_link_name);
+  EXPECT_FALSE(kin_group.calcInvKin(far_ik_input, seed).empty());
+  EXPECT_EQ(cache->size(), 1);
+
+  check_solutions(rebuilt_kin_group.calcInvKin(ik_input, seed));
+  EXPECT_EQ(cache->getHits(), 4);
+}
+
+TEST(TesseractKinematicsUnit, OPWInvKinGroupHandleUnit)  // NOLINT
+{
+  Eigen::Isometry3d pose1;
+  pose1.setIdentity();
+  pose1.translation() = Eigen::Vector3d(1, 0, 1.306);
+
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(6);
+
+  tesseract_common::GeneralResourceLocator locator;
+  auto scene_graph = getSceneGraphABB(locator);
+  std::string manip_name = "manip";
+  std::string base_link_name = "base_link";
+  std::string tip_link_name = "tool0";
+  std::vector<std::string> joint_names{ "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+
+  KDLFwdKinChain fwd_kin(*scene_graph, base_link_name, tip_link_name);
+  Eigen::VectorXd joint_values(6);
+  joint_values << 0.2, 0.3, -0.2, 0.4, 0.5, 0.6;
+  Eigen::Isometry3d pose2 = fwd_kin.calcFwdKin(joint_values).at(tip_link_name);
+
+  tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+  tesseract_scene_graph::SceneState scene_state = state_solver.getState();
+
+  // The second group requires the joints to be reordered
+  std::vector<std::string> reordered_joint_names{ "joint_6", "joint_5", "joint_4", "joint_3", "joint_2", "joint_1" };
+  for (const auto& group_joint_names : { joint_names, reordered_joint_names })
+  {
+    auto inv_kin = std::make_unique<OPWInvKin>(getOPWKinematicsParamABB(), base_link_name, tip_link_name, joint_names);
+    KinematicGroup kin_group(manip_name, group_joint_names, std::move(inv_kin), *scene_graph, scene_state);
+
+    EXPECT_ANY_THROW(kin_group.createIKHandle("link_1", tip_link_name));      // NOLINT
+    EXPECT_ANY_THROW(kin_group.createIKHandle(base_link_name, "base_link"));  // NOLINT
+
+    for (const std::string& working_frame : { base_link_name, std::string("base") })
+    {
+      KinGroupIKHandle handle = kin_group.createIKHandle(working_frame, tip_link_name);
+      EXPECT_EQ(handle.working_frame, working_frame);
+      EXPECT_EQ(handle.tip_link_name, tip_link_name);
+
+      // The output overload overwrites whatever the vector held before
+      IKSolutions reused(20, Eigen::VectorXd::Zero(6));
+      for (const auto& pose : { pose1, pose2 })
+      {
+        IKSolutions expected = kin_group.calcInvKin(KinGroupIKInput(pose, working_frame, tip_link_name), seed);
+        IKSolutions solutions = kin_group.calcInvKin(handle, pose, seed);
+        EXPECT_FALSE(solutions.empty());
+        ASSERT_EQ(solutions.size(), expected.size());
+        for (std::size_t i = 0; i < solutions.size(); ++i)
+          EXPECT_TRUE(solutions[i].isApprox(expected[i], 1e-12));
+
+        kin_group.calcInvKin(reused, handle, pose, seed);
+        ASSERT_EQ(reused.size(), expected.size());
+        for (std::size_t i = 0; i < reused.size(); ++i)
+          EXPECT_TRUE(reused[i].isApprox(expected[i], 1e-12));
+      }
+    }
+  }
+}
+
+TEST(TesseractKinematicsUnit, OPWInvKinBatchUnit)  // NOLINT
+{
+  std::string base_link_name = "base_link";
+  std::string tip_link_name = "tool0";
+  std::vector<std::string> joint_names{ "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  OPWInvKin inv_kin(getOPWKinematicsParamABB(), base_link_name, tip_link_name, joint_names);
+
+  tesseract_common::VectorIsometry3d poses;
+  Eigen::Isometry3d pose{ Eigen::Isometry3d::Identity() };
+  pose.translation() = Eigen::Vector3d(1, 0, 1.306);
+  poses.push_back(pose);
+
+  pose.translation() = Eigen::Vector3d(-0.268141, -0.023459, -0.753010);
+  pose.linear() = Eigen::Quaterniond(0.0, 0.0, 1.0, 0.0).matrix();
+  poses.push_back(pose);
+
+  // Unreachable
+  pose.translation() = Eigen::Vector3d(10, 0, 0);
+  poses.push_back(pose);
+
+  Eigen::Matrix<double, 6, Eigen::Dynamic> solutions;
+  std::vector<char> valid;
+  inv_kin.calcInvKin(solutions, valid, poses);
+  EXPECT_EQ(solutions.cols(), 3 * OPW_MAX_SOLUTIONS);
+  EXPECT_EQ(valid.size(), static_cast<std::size_t>(3 * OPW_MAX_SOLUTIONS));
+
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(6);
+  for (std::size_t i = 0; i < poses.size(); ++i)
+  {
+    IKSolutions expected = inv_kin.calcInvKin({ { tip_link_name, poses[i] } }, seed);
+
+    IKSolutions batch;
+    for (Eigen::Index j = 0; j < OPW_MAX_SOLUTIONS; ++j)
+    {
+      const Eigen::Index col = (static_cast<Eigen::Index>(i) * OPW_MAX_SOLUTIONS) + j;
+      if (valid[static_cast<std::size_t>(col)] != 0)
+        batch.emplace_back(solutions.col(col));
+    }
+
+    ASSERT_EQ(batch.size(), expected.size());
+    for (std::size_t j = 0; j < batch.size(); ++j)
+      EXPECT_TRUE(batch[j].isApprox(expected[j], 1e-12));
+  }
+
+  // The unreachable pose has no solutions
+  EXPECT_TRUE(std::none_of(valid.begin() + (2 * OPW_MAX_SOLUTIONS), valid.end(), [](char v) { return v != 0; }));
+
+  // The single pose overload matches the transform map overload and reuses the memory of the solutions
+  IKSolutions single;
+  for (const auto& p : poses)
+  {
+    IKSolutions expected = inv_kin.calcInvKin({ { tip_link_name, p } }, seed);
+    inv_kin.calcInvKin(single, p, seed);
+    ASSERT_EQ(single.size(), expected.size());
+    for (std::size_t j = 0; j < single.size(); ++j)
+      EXPECT_TRUE(single[j].isApprox(expected[j], 1e-12));
+
+    if (single.empty())
+      continue;
+
+    const double* data = single.front().data();
+    inv_kin.calcInvKin(single, p, seed);
+    EXPECT_EQ(single.front().data(), data);
+  }
+  EXPECT_TRUE(single.empty());
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -192,6 +192,64 @@ TEST(TesseractKinematicsUnit, RobotWithExternalPositionerInverseKinematicUnit)
   runKinSetJointLimitsTest(kin_group2);
 }
 
+TEST(TesseractKinematicsUnit, RobotWithExternalPositionerParallelSamplingUnit)  // NOLINT
+{
+  tesseract_common::GeneralResourceLocator locator;
+  auto scene_graph = getSceneGraphABBExternalPositioner(locator);
+
+  tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+  tesseract_scene_graph::SceneState scene_state = state_solver.getState();
+
+  auto robot_fwd_kin = getRobotFwdKinematics(*scene_graph);
+  auto opw_kin = std::make_unique<OPWInvKin>(getOPWKinematicsParamABB(),
+                                             robot_fwd_kin->getBaseLinkName(),
+                                             robot_fwd_kin->getTipLinkNames()[0],
+                                             robot_fwd_kin->getJointNames());
+
+  Eigen::VectorXd positioner_resolution = Eigen::VectorXd::Constant(2, 1, 0.1);
+  REPInvKin inv_kin(*scene_graph,
+                    scene_state,
+                    std::move(opw_kin),
+                    2.5,
+                    getPositionerFwdKinematics(*scene_graph),
+                    positioner_resolution);
+
+  Eigen::Isometry3d pose{ Eigen::Isometry3d::Identity() };
+  pose.translation() = Eigen::Vector3d(0, 0, 0.1);
+  tesseract_common::TransformMap poses{ { "tool0", pose } };
+
+  runPositionerSamplingTest(inv_kin, poses);
+}
+
+TEST(TesseractKinematicsUnit, RobotWithExternalPositionerRevoluteCoarseSamplingUnit)  // NOLINT
+{
+  tesseract_common::GeneralResourceLocator locator;
+  auto scene_graph = getSceneGraphABBExternalPositioner(locator);
+  changeJointType(*scene_graph, "positioner_joint_1", tesseract_scene_graph::JointType::REVOLUTE);
+
+  tesseract_scene_graph::KDLStateSolver state_solver(*scene_graph);
+  tesseract_scene_graph::SceneState scene_state = state_solver.getState();
+
+  auto robot_fwd_kin = getRobotFwdKinematics(*scene_graph);
+  auto opw_kin = std::make_unique<OPWInvKin>(getOPWKinematicsParamABB(),
+                                             robot_fwd_kin->getBaseLinkName(),
+                                             robot_fwd_kin->getTipLinkNames()[0],
+                                             robot_fwd_kin->getJointNames());
+
+  Eigen::VectorXd positioner_resolution = Eigen::VectorXd::Constant(2, 1, 0.1);
+  REPInvKin inv_kin(*scene_graph,
+                    scene_state,
+                    std::move(opw_kin),
+                    2.5,
+                    getPositionerFwdKinematics(*scene_graph),
+                    positioner_resolution);
+
+  // The coarse cells could skip reachable samples of a revolute positioner joint so only a zero stride is accepted
+  EXPECT_ANY_THROW(inv_kin.setCoarseSampleStride(4));  // NOLINT
+  EXPECT_EQ(inv_kin.getCoarseSampleStride(), 0);
+  EXPECT_NO_THROW(inv_kin.setCoarseSampleStride(0));  // NOLINT
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
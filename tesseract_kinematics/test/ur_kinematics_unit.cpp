@@ -169,6 +169,58 @@ TEST(TesseractKinematicsUnit, UR3eInvKinUnit)  // NOLINT
   runURKinematicsTests(UR3eParameters, shoulder_offset, elbow_offset, pose);
 }
 
+TEST(TesseractKinematicsUnit, URInvKinBatchUnit)  // NOLINT
+{
+  std::string base_link_name = "base_link";
+  std::string tip_link_name = "tool0";
+  std::vector<std::string> joint_names{ "shoulder_pan_joint", "shoulder_lift_joint", "elbow_joint",
+                                        "wrist_1_joint",      "wrist_2_joint",       "wrist_3_joint" };
+  URInvKin inv_kin(UR10Parameters, base_link_name, tip_link_name, joint_names);
+
+  tesseract_common::VectorIsometry3d poses;
+  Eigen::Isometry3d pose{ Eigen::Isometry3d::Identity() };
+  pose.translation() = Eigen::Vector3d(0.75, 0, 0.75);
+  poses.push_back(pose);
+
+  pose.translation() = Eigen::Vector3d(0.5, 0.25, 0.25);
+  pose.linear() = Eigen::Quaterniond(0.0, 0.0, 1.0, 0.0).matrix();
+  poses.push_back(pose);
+
+  // Unreachable
+  pose.translation() = Eigen::Vector3d(10, 0, 0);
+  poses.push_back(pose);
+
+  Eigen::Matrix<double, 6, Eigen::Dynamic> solutions;
+  std::vector<char> valid;
+  inv_kin.calcInvKin(solutions, valid, poses);
+  EXPECT_EQ(solutions.cols(), 3 * UR_MAX_SOLUTIONS);
+  EXPECT_EQ(valid.size(), static_cast<std::size_t>(3 * UR_MAX_SOLUTIONS));
+
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(6);
+  for (std::size_t i = 0; i < poses.size(); ++i)
+  {
+    IKSolutions expected = inv_kin.calcInvKin({ { tip_link_name, poses[i] } }, seed);
+
+    URSolutions sols;
+    const Eigen::Index num_sols = inv_kin.calcInvKin(sols, poses[i]);
+    ASSERT_EQ(num_sols, static_cast<Eigen::Index>(expected.size()));
+
+    for (Eigen::Index j = 0; j < UR_MAX_SOLUTIONS; ++j)
+    {
+      const Eigen::Index col = (static_cast<Eigen::Index>(i) * UR_MAX_SOLUTIONS) + j;
+      EXPECT_EQ(valid[static_cast<std::size_t>(col)] != 0, j < num_sols);
+      if (j < num_sols)
+      {
+        EXPECT_TRUE(sols.col(j).isApprox(expected[static_cast<std::size_t>(j)], 1e-12));
+        EXPECT_TRUE(solutions.col(col).isApprox(expected[static_cast<std::size_t>(j)], 1e-12));
+      }
+    }
+  }
+
+  // The unreachable pose has no solutions
+  EXPECT_EQ(inv_kin.calcInvKin({ { tip_link_name, poses[2] } }, seed).size(), 0);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -45,6 +45,12 @@ namespace tesseract_kinematics
 {
 static const std::string UR_INV_KIN_CHAIN_SOLVER_NAME = "URInvKin";
 
+/** @brief The maximum number of solutions the UR solver returns for a single pose */
+static const Eigen::Index UR_MAX_SOLUTIONS = 8;
+
+/** @brief A fixed size buffer which holds every solution of a single pose, one solution per column */
+using URSolutions = Eigen::Matrix<double, 6, UR_MAX_SOLUTIONS>;
+
 /**@brief Universal Robot Inverse Kinematics Implementation. */
 class URInvKin : public tesseract_kinematics::InverseKinematics
 {
@@ -81,6 +87,30 @@ public:
   tesseract_kinematics::IKSolutions calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                                                const Eigen::Ref<const Eigen::VectorXd>& seed) const override final;
 
+  /**
+   * @brief Calculate the inverse kinematics for a single tip link pose without allocating memory
+   * @details The harmonized solutions are written into the first columns of the solution buffer in the same order as
+   * they are returned by calcInvKin(const tesseract_common::TransformMap&, const Eigen::Ref<const Eigen::VectorXd>&)
+   * @param solutions The caller owned solution buffer
+   * @param tip_link_pose The tip link pose relative to the working frame
+   * @return The number of solutions written to the buffer
+   */
+  Eigen::Index calcInvKin(URSolutions& solutions, const Eigen::Isometry3d& tip_link_pose) const;
+
+  /**
+   * @brief Calculate the inverse kinematics for a set of tip link poses
+   * @details The solutions are written into a compact buffer which holds every candidate solution of every pose, so no
+   * memory is allocated when the buffers already have the required size. Solution j of pose i is stored in column
+   * i * UR_MAX_SOLUTIONS + j and it is only valid if the flag at the same index is set. The valid solutions of each
+   * pose are stored before its invalid columns and they are harmonized like the single pose solutions.
+   * @param solutions The solution buffer which is resized to 6 by tip_link_poses.size() * UR_MAX_SOLUTIONS if required
+   * @param valid The validity flag of each solution which is resized to match the number of solution columns
+   * @param tip_link_poses The tip link poses relative to the working frame
+   */
+  void calcInvKin(Eigen::Matrix<double, 6, Eigen::Dynamic>& solutions,
+                  std::vector<char>& valid,
+                  const tesseract_common::VectorIsometry3d& tip_link_poses) const;
+
   Eigen::Index numJoints() const override final;
   std::vector<std::string> getJointNames() const override final;
   std::string getBaseLinkName() const override final;
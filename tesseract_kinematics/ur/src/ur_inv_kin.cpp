@@ -252,36 +252,79 @@ URInvKin& URInvKin::operator=(const URInvKin& other)
   return *this;
 }
 
+namespace
+{
+/**
+ * @brief Solve the inverse kinematics of a single pose and harmonize the solutions
+ * @param q_sols The solution storage which must hold UR_MAX_SOLUTIONS * 6 values, one solution after the other
+ * @return The number of solutions
+ */
+int solve(const Eigen::Isometry3d& tip_link_pose, const URParameters& params, double* q_sols)
+{
+  // The UR kinematics are defined relative to a base frame which is rotated by PI about the z axis
+  static const Eigen::Isometry3d base_offset_inv =
+      (Eigen::Isometry3d::Identity() * Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitZ())).inverse();
+  const Eigen::Isometry3d corrected_pose = base_offset_inv * tip_link_pose;
+
+  // Do the analytic IK
+  const int num_sols = inverse(corrected_pose, params, q_sols, 0);
+
+  // Harmonize between [-PI, PI]
+  for (int i = 0; i < num_sols; ++i)
+  {
+    Eigen::Map<Eigen::VectorXd> eigen_sol(q_sols + (static_cast<std::ptrdiff_t>(i) * 6), 6);
+    harmonizeTowardZero<double>(eigen_sol, REDUNDANT_CAPABLE_JOINTS);  // Modifies 'sol' in place
+  }
+
+  return num_sols;
+}
+}  // namespace
+
 IKSolutions URInvKin::calcInvKin(const tesseract_common::TransformMap& tip_link_poses,
                                  const Eigen::Ref<const Eigen::VectorXd>& /*seed*/) const
 {
   assert(tip_link_poses.size() == 1);
   assert(tip_link_poses.find(tip_link_name_) != tip_link_poses.end());
-  assert(std::abs(1.0 - tip_link_poses.at(tip_link_name_).matrix().determinant()) < 1e-6);  // NOLINT
 
-  Eigen::Isometry3d base_offset = Eigen::Isometry3d::Identity() * Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitZ());
-  Eigen::Isometry3d corrected_pose = base_offset.inverse() * tip_link_poses.at(tip_link_name_);
-
-  // Do the analytic IK
-  // NOLINTNEXTLINE
-  std::array<std::array<double, 6>, 8> sols;  // maximum of 8 IK solutions
-  auto num_sols = static_cast<std::size_t>(inverse(corrected_pose, params_, sols[0].data(), 0));
+  URSolutions sols;
+  const Eigen::Index num_sols = calcInvKin(sols, tip_link_poses.at(tip_link_name_));
 
-  // Check the output
   IKSolutions solution_set;
-  solution_set.reserve(num_sols);
-  for (std::size_t i = 0; i < num_sols; ++i)
-  {
-    Eigen::Map<Eigen::VectorXd> eigen_sol(sols[i].data(), static_cast<Eigen::Index>(sols[i].size()));
+  solution_set.reserve(static_cast<std::size_t>(num_sols));
+  for (Eigen::Index i = 0; i < num_sols; ++i)
+    solution_set.emplace_back(sols.col(i));
 
-    // Harmonize between [-PI, PI]
-    harmonizeTowardZero<double>(eigen_sol, REDUNDANT_CAPABLE_JOINTS);  // Modifies 'sol' in place
+  return solution_set;
+}
 
-    // Add solution
-    solution_set.push_back(eigen_sol);
-  }
+Eigen::Index URInvKin::calcInvKin(URSolutions& solutions, const Eigen::Isometry3d& tip_link_pose) const
+{
+  assert(std::abs(1.0 - tip_link_pose.matrix().determinant()) < 1e-6);  // NOLINT
 
-  return solution_set;
+  // The buffer is column major so each solution is stored contiguously
+  return solve(tip_link_pose, params_, solutions.data());
+}
+
+void URInvKin::calcInvKin(Eigen::Matrix<double, 6, Eigen::Dynamic>& solutions,
+                          std::vector<char>& valid,
+                          const tesseract_common::VectorIsometry3d& tip_link_poses) const
+{
+  const auto num_solutions = static_cast<Eigen::Index>(tip_link_poses.size()) * UR_MAX_SOLUTIONS;
+  if (solutions.cols() != num_solutions)
+    solutions.resize(6, num_solutions);
+
+  if (valid.size() != static_cast<std::size_t>(num_solutions))
+    valid.resize(static_cast<std::size_t>(num_solutions));
+
+  for (std::size_t i = 0; i < tip_link_poses.size(); ++i)
+  {
+    assert(std::abs(1.0 - tip_link_poses[i].matrix().determinant()) < 1e-6);  // NOLINT
+
+    const auto col = static_cast<Eigen::Index>(i) * UR_MAX_SOLUTIONS;
+    const int num_sols = solve(tip_link_poses[i], params_, solutions.col(col).data());
+    for (Eigen::Index j = 0; j < UR_MAX_SOLUTIONS; ++j)
+      valid[static_cast<std::size_t>(col + j)] = static_cast<char>(j < num_sols);
+  }
 }
 
 Eigen::Index URInvKin::numJoints() const { return 6; }
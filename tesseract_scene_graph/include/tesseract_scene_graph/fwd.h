@@ -51,6 +51,8 @@ class SceneGraph;
 
 // scene_state.h
 struct SceneState;
+struct SceneStateLayout;
+struct CompactSceneState;
 }  // namespace tesseract_scene_graph
 
 #endif  // TESSERACT_SCENE_GRAPH_FWD_H
@@ -37,6 +37,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <unordered_map>
 #include <vector>
 #include <memory>
+#include <string>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/eigen_types.h>
@@ -85,6 +86,101 @@ private:
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
 };
+
+/**
+ * @brief The names and indices which describe the memory layout of a CompactSceneState
+ * @details A layout is immutable and shared by every compact state of a state solver until the structure of the
+ * solver changes, so name lookups do not require the state to store any names.
+ */
+struct SceneStateLayout
+{
+  using Ptr = std::shared_ptr<SceneStateLayout>;
+  using ConstPtr = std::shared_ptr<const SceneStateLayout>;
+
+  SceneStateLayout() = default;
+  SceneStateLayout(std::vector<std::string> joint_names,
+                   std::vector<std::string> link_names,
+                   std::vector<std::string> link_joint_names);
+
+  /** @brief The active joint names which is the order of CompactSceneState::joints */
+  std::vector<std::string> joint_names;
+
+  /** @brief The link names which is the order of CompactSceneState::link_transforms */
+  std::vector<std::string> link_names;
+
+  /** @brief The name of the joint whose child is the link at the same index, this is empty for the root link */
+  std::vector<std::string> link_joint_names;
+
+  /** @brief Map of active joint name to index in joint_names */
+  std::unordered_map<std::string, std::size_t> joint_indices;
+
+  /** @brief Map of link name to index in link_names */
+  std::unordered_map<std::string, std::size_t> link_indices;
+
+  /**
+   * @brief Get the index of the active joint
+   * @throws std::out_of_range if the joint is not an active joint
+   */
+  std::size_t getJointIndex(const std::string& joint_name) const;
+
+  /**
+   * @brief Get the index of the link
+   * @throws std::out_of_range if the link does not exist
+   */
+  std::size_t getLinkIndex(const std::string& link_name) const;
+};
+
+/**
+ * @brief A structure of arrays alternative to SceneState
+ * @details The joint values and link transforms are stored contiguously in the order defined by the layout. A state
+ * solver can fill a compact state which already has its layout without allocating memory. The joint transforms are
+ * not stored because they are equal to the transform of the joint's child link.
+ */
+struct CompactSceneState
+{
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using Ptr = std::shared_ptr<CompactSceneState>;
+  using ConstPtr = std::shared_ptr<const CompactSceneState>;
+  using UPtr = std::unique_ptr<CompactSceneState>;
+  using ConstUPtr = std::unique_ptr<const CompactSceneState>;
+
+  CompactSceneState() = default;
+  explicit CompactSceneState(SceneStateLayout::ConstPtr layout);
+
+  /** @brief The layout describing the order of joints and link_transforms */
+  SceneStateLayout::ConstPtr layout;
+
+  /** @brief The active joint values used for calculating the link transforms */
+  Eigen::VectorXd joints;
+
+  /** @brief The link transforms in world coordinate system */
+  tesseract_common::VectorIsometry3d link_transforms;
+
+  /**
+   * @brief Assign a new layout, memory is only allocated if the sizes changed
+   * @param layout The new layout
+   */
+  void setLayout(SceneStateLayout::ConstPtr layout);
+
+  /** @brief Get the value of an active joint by name */
+  double getJointValue(const std::string& joint_name) const;
+
+  /** @brief Get the link transform by name */
+  const Eigen::Isometry3d& getLinkTransform(const std::string& link_name) const;
+
+  /** @brief Convert to the map based SceneState */
+  SceneState toSceneState() const;
+
+  /**
+   * @brief Copy the values from a map based SceneState using the current layout
+   * @throws std::out_of_range if the scene state is missing an active joint or link of the layout
+   */
+  void fromSceneState(const SceneState& state);
+};
+
 }  // namespace tesseract_scene_graph
 
 BOOST_CLASS_EXPORT_KEY(tesseract_scene_graph::SceneState)
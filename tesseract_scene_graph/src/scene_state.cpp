@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/map.hpp>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/unordered_map.hpp>
+#include <cassert>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/eigen_serialization.h>
@@ -76,6 +77,89 @@ void SceneState::serialize(Archive& ar, const unsigned int /*version*/)
   ar& BOOST_SERIALIZATION_NVP(joint_transforms);
 }
 
+SceneStateLayout::SceneStateLayout(std::vector<std::string> joint_names,
+                                   std::vector<std::string> link_names,
+                                   std::vector<std::string> link_joint_names)
+  : joint_names(std::move(joint_names))
+  , link_names(std::move(link_names))
+  , link_joint_names(std::move(link_joint_names))
+{
+  assert(this->link_joint_names.size() == this->link_names.size());
+
+  joint_indices.reserve(this->joint_names.size());
+  for (std::size_t i = 0; i < this->joint_names.size(); ++i)
+    joint_indices[this->joint_names[i]] = i;
+
+  link_indices.reserve(this->link_names.size());
+  for (std::size_t i = 0; i < this->link_names.size(); ++i)
+    link_indices[this->link_names[i]] = i;
+}
+
+std::size_t SceneStateLayout::getJointIndex(const std::string& joint_name) const
+{
+  return joint_indices.at(joint_name);
+}
+
+std::size_t SceneStateLayout::getLinkIndex(const std::string& link_name) const { return link_indices.at(link_name); }
+
+CompactSceneState::CompactSceneState(SceneStateLayout::ConstPtr layout) { setLayout(std::move(layout)); }
+
+void CompactSceneState::setLayout(SceneStateLayout::ConstPtr layout)
+{
+  this->layout = std::move(layout);
+  if (this->layout == nullptr)
+  {
+    joints.resize(0);
+    link_transforms.clear();
+    return;
+  }
+
+  joints.conservativeResize(static_cast<Eigen::Index>(this->layout->joint_names.size()));
+  link_transforms.resize(this->layout->link_names.size(), Eigen::Isometry3d::Identity());
+}
+
+double CompactSceneState::getJointValue(const std::string& joint_name) const
+{
+  return joints(static_cast<Eigen::Index>(layout->getJointIndex(joint_name)));
+}
+
+const Eigen::Isometry3d& CompactSceneState::getLinkTransform(const std::string& link_name) const
+{
+  return link_transforms[layout->getLinkIndex(link_name)];
+}
+
+SceneState CompactSceneState::toSceneState() const
+{
+  SceneState state;
+  if (layout == nullptr)
+    return state;
+
+  state.joints.reserve(layout->joint_names.size());
+  for (std::size_t i = 0; i < layout->joint_names.size(); ++i)
+    state.joints[layout->joint_names[i]] = joints(static_cast<Eigen::Index>(i));
+
+  for (std::size_t i = 0; i < layout->link_names.size(); ++i)
+  {
+    state.link_transforms[layout->link_names[i]] = link_transforms[i];
+    if (!layout->link_joint_names[i].empty())
+      state.joint_transforms[layout->link_joint_names[i]] = link_transforms[i];
+  }
+
+  return state;
+}
+
+void CompactSceneState::fromSceneState(const SceneState& state)
+{
+  if (layout == nullptr)
+    return;
+
+  for (std::size_t i = 0; i < layout->joint_names.size(); ++i)
+    joints(static_cast<Eigen::Index>(i)) = state.joints.at(layout->joint_names[i]);
+
+  for (std::size_t i = 0; i < layout->link_names.size(); ++i)
+    link_transforms[i] = state.link_transforms.at(layout->link_names[i]);
+}
+
 }  // namespace tesseract_scene_graph
 
 #include <tesseract_common/serialization.h>
@@ -71,6 +71,16 @@ public:
 
   SceneState getState() const override final;
 
+  std::shared_ptr<const SceneStateLayout> getCompactStateLayout() const override final;
+
+  void getCompactState(CompactSceneState& state,
+                       const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+
+  void getCompactState(CompactSceneState& state) const override final;
+
+  void getStates(tesseract_common::VectorIsometry3d& link_transforms,
+                 const Eigen::Ref<const tesseract_common::TrajArray>& joint_values) const override final;
+
   SceneState getRandomState() const override final;
 
   Eigen::MatrixXd getJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
@@ -82,6 +92,11 @@ public:
                               const Eigen::Ref<const Eigen::VectorXd>& joint_values,
                               const std::string& link_name) const override final;
 
+  void getJacobians(Eigen::Ref<Eigen::MatrixXd> jacobians,
+                    const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                    const std::vector<std::string>& link_names,
+                    const tesseract_common::VectorVector3d& link_points = {}) const override final;
+
   std::vector<std::string> getJointNames() const override final;
 
   std::vector<std::string> getActiveJointNames() const override final;
@@ -107,6 +122,10 @@ public:
 
   tesseract_common::KinematicLimits getLimits() const override final;
 
+  std::vector<std::string> getChangedLinkNames() const override final;
+
+  void clearChangedLinkNames() override final;
+
 private:
   SceneState current_state_;                                   /**< Current state of the environment */
   KDLTreeData data_;                                           /**< KDL tree data */
@@ -115,8 +134,30 @@ private:
   std::vector<int> joint_qnr_;               /**< The kdl segment number corresponding to joint in joint names */
   KDL::JntArray kdl_jnt_array_;              /**< The kdl joint array */
   tesseract_common::KinematicLimits limits_; /**< The kinematic limits */
+  bool links_changed_{ true };               /**< Indicates the link transforms changed since cleared */
   mutable std::mutex mutex_; /**< @brief KDL is not thread safe due to mutable variables in Joint Class */
 
+  /** @brief The compact state layout */
+  std::shared_ptr<const SceneStateLayout> layout_;
+
+  /** @brief A tree segment with the indices needed to calculate its transform without name lookups */
+  struct SegmentInfo
+  {
+    const KDL::TreeElementType* element{ nullptr }; /**< The tree element of the segment */
+    std::size_t parent{ 0 };                        /**< The index of the parent segment, the root is its own parent */
+    std::size_t link_index{ 0 };                    /**< The compact state layout link index */
+    Eigen::Index joint_index{ -1 };                 /**< The active joint index or -1 if the joint is fixed */
+  };
+
+  /** @brief The tree segments ordered so a parent is always before its children */
+  std::vector<SegmentInfo> segments_;
+
+  /** @brief Map between the compact state layout link index and the index in segments_ */
+  std::vector<std::size_t> link_segments_;
+
+  /** @brief The link transforms used by getJacobians, this is guarded by mutex_ */
+  mutable tesseract_common::VectorIsometry3d jacobian_link_transforms_;
+
   void calculateTransforms(SceneState& state,
                            const KDL::JntArray& q_in,
                            const KDL::SegmentMap::const_iterator& it,
@@ -127,6 +168,16 @@ private:
                                  const KDL::SegmentMap::const_iterator& it,
                                  const Eigen::Isometry3d& parent_frame) const;
 
+  /**
+   * @brief Calculate the link transforms of a single state in the compact state layout link order
+   * @param link_transforms The link transforms to populate starting at offset, must already be sized
+   * @param offset The index of the first link transform to populate
+   * @param joint_values The joint values in the order of the active joint names
+   */
+  void calculateTransformsHelper(tesseract_common::VectorIsometry3d& link_transforms,
+                                 std::size_t offset,
+                                 const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
+
   bool setJointValuesHelper(KDL::JntArray& q, const std::string& joint_name, const double& joint_value) const;
 
   bool calcJacobianHelper(KDL::Jacobian& jacobian, const KDL::JntArray& kdl_joints, const std::string& link_name) const;
@@ -137,6 +188,9 @@ private:
   KDL::JntArray getKDLJntArray(const std::unordered_map<std::string, double>& joint_values) const;
 
   bool processKDLData(const tesseract_scene_graph::SceneGraph& scene_graph);
+
+  /** @brief Populate segments_ from the tree, this must be called again when the tree is copied */
+  void processSegments();
 };
 
 }  // namespace tesseract_scene_graph
@@ -0,0 +1,150 @@
+/**
+ * @file ofkt_kinematic_tree.h
+ * @brief A flattened immutable copy of the Optimized Forward Kinematic Tree.
+ *
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_STATE_SOLVER_OFKT_KINEMATIC_TREE_H
+#define TESSERACT_STATE_SOLVER_OFKT_KINEMATIC_TREE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Geometry>
+#include <memory>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/eigen_types.h>
+#include <tesseract_scene_graph/joint.h>
+#include <tesseract_scene_graph/scene_state.h>
+
+namespace tesseract_scene_graph
+{
+/**
+ * @brief A flattened copy of the OFKT which is used to evaluate kinematics without locking
+ * @details The nodes are stored in topological order so a node's parent is always located before the node and the root
+ * is always the first node. The tree is never modified after it is created, so it may be shared between any number of
+ * threads. The OFKTStateSolver creates a new tree every time its structure changes.
+ */
+struct OFKTKinematicTree
+{
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using ConstPtr = std::shared_ptr<const OFKTKinematicTree>;
+
+  /** @brief The layout of the states calculated by the tree */
+  SceneStateLayout::ConstPtr layout;
+
+  /** @brief The parent node index of each node, the root's parent index is not used */
+  std::vector<std::size_t> parent_indices;
+
+  /** @brief The joint type of each node */
+  std::vector<JointType> joint_types;
+
+  /** @brief The static transformation of each node */
+  tesseract_common::VectorIsometry3d static_transforms;
+
+  /** @brief The joint axis of each node, zero for fixed nodes */
+  tesseract_common::VectorVector3d axes;
+
+  /** @brief The layout joint index of each node, -1 for fixed nodes */
+  std::vector<Eigen::Index> joint_indices;
+
+  /** @brief The layout link index of each node */
+  std::vector<std::size_t> link_indices;
+
+  /** @brief The node index of each layout link */
+  std::vector<std::size_t> link_nodes;
+
+  /** @brief The number of nodes in the tree */
+  std::size_t size() const;
+
+  /**
+   * @brief Calculate the local transformation of a node
+   * @param node The node index
+   * @param joint_value The joint value of the node, this is ignored for fixed nodes
+   * @return The local transformation
+   */
+  Eigen::Isometry3d calcLocalTransform(std::size_t node, double joint_value) const;
+
+  /**
+   * @brief Calculate the link transforms for a single state
+   * @param link_transforms The link transforms in layout link order starting at offset, must already be sized
+   * @param offset The index of the first link transform to populate
+   * @param joint_values The joint values in layout joint order
+   */
+  void calcLinkTransforms(tesseract_common::VectorIsometry3d& link_transforms,
+                          std::size_t offset,
+                          const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
+
+  /**
+   * @brief Update the link transforms of a single state after its joint values changed
+   * @details Only the nodes whose joint value or whose parent's transform changed are recalculated
+   * @param link_transforms The link transforms of the previous joint values in layout link order, updated in place
+   * @param joint_values The new joint values in layout joint order
+   * @param previous_joint_values The joint values used to calculate the provided link transforms
+   * @param changed Populated with a flag for each node indicating if its transform was recalculated
+   */
+  void updateLinkTransforms(tesseract_common::VectorIsometry3d& link_transforms,
+                            const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                            const Eigen::Ref<const Eigen::VectorXd>& previous_joint_values,
+                            std::vector<char>& changed) const;
+
+  /**
+   * @brief Calculate the link transforms for a set of states
+   * @details Subtrees whose joint values did not change since the previous state copy the previous state's transforms
+   * @param link_transforms The link transforms stored state by state in layout link order, must already be sized
+   * @param joint_values The joint values where each row is a state in layout joint order
+   */
+  void calcLinkTransforms(tesseract_common::VectorIsometry3d& link_transforms,
+                          const Eigen::Ref<const tesseract_common::TrajArray>& joint_values) const;
+
+  /**
+   * @brief Calculate the jacobian of a link relative to the root
+   * @param jacobian The jacobian to populate, must be 6 by the number of layout joints
+   * @param joint_values The joint values in layout joint order
+   * @param link_index The layout link index
+   */
+  void calcJacobian(Eigen::Ref<Eigen::MatrixXd> jacobian,
+                    const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                    std::size_t link_index) const;
+
+  /**
+   * @brief Calculate the jacobians of multiple links relative to the root from previously calculated link transforms
+   * @param jacobians The jacobians to populate where rows 6 * i to 6 * i + 5 are the jacobian of link i, this must be
+   * 6 * link_names.size() by the number of layout joints
+   * @param link_transforms The link transforms of a single state in layout link order
+   * @param link_names The link names to calculate the jacobians
+   * @param link_points The points on each link, expressed in the link frame, to calculate the jacobians at. If empty
+   * the jacobians are calculated at the link origins.
+   */
+  void calcJacobians(Eigen::Ref<Eigen::MatrixXd> jacobians,
+                     const tesseract_common::VectorIsometry3d& link_transforms,
+                     const std::vector<std::string>& link_names,
+                     const tesseract_common::VectorVector3d& link_points) const;
+};
+
+}  // namespace tesseract_scene_graph
+
+#endif  // TESSERACT_STATE_SOLVER_OFKT_KINEMATIC_TREE_H
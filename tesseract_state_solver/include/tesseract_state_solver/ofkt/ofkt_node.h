@@ -44,13 +44,13 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 namespace tesseract_scene_graph
 {
 /**
- * @brief The OFKT node is contains multiple trasformation which are described below.
+ * @brief The OFKT node describes a joint and its child link in the structure of the tree.
  *
  *   - Static Transformation: (S)
  *   - Joint Transformation: (J) this if a fuction of the joint value if not fixed
  *   - Local Transformation: L = S * J
- *   - World Transformation: W = W(parent) * L
  *
+ * The nodes do not store any state, the world transformations are calculated by the OFKTKinematicTree.
  */
 class OFKTNode
 {
@@ -78,9 +78,6 @@ public:
 
   /**
    * @brief Set the parent node
-   *
-   *  This should indicate that updateWorldTransformationRequired() = true
-   *
    * @param parent The parent node
    */
   virtual void setParent(OFKTNode* parent) = 0;
@@ -109,32 +106,8 @@ public:
    */
   virtual const std::string& getJointName() const = 0;
 
-  /**
-   * @brief Set the nodes joint value if it has one.
-   *
-   * This should indicate hasJointValueChanged() = true
-   *
-   * @param joint_value The joint value
-   */
-  virtual void storeJointValue(double joint_value) = 0;
-
-  /**
-   * @brief Get the current joint value
-   * @return The current joint value
-   */
-  virtual double getJointValue() const = 0;
-
-  /**
-   * @brief Indicates that the joint value has changed and that local and world transformation need to be recomputed.
-   * @return If true, local and world transformation need to be recompute
-   */
-  virtual bool hasJointValueChanged() const = 0;
-
   /**
    * @brief Set the static transformation.
-   *
-   * This should recompute the local transformation and updateWorldTransformationRequired() = true.
-   *
    * @param static_tf The new static transformation
    */
   virtual void setStaticTransformation(const Eigen::Isometry3d& static_tf) = 0;
@@ -146,53 +119,12 @@ public:
   virtual const Eigen::Isometry3d& getStaticTransformation() const = 0;
 
   /**
-   * @brief Compute and save the local transformation 'L = S * J(Joint Value)'
-   *
-   * This should reset the flag such that hasJointValueChanged() returns false
-   */
-  virtual void computeAndStoreLocalTransformation() = 0;
-
-  /**
-   * @brief Get the local transformation: 'L = S * J'
-   * @return The nodes local transformation
-   */
-  virtual const Eigen::Isometry3d& getLocalTransformation() const = 0;
-
-  /**
-   * @brief Compute the local tranformation but do not save.
-   *
-   * This provides a const method for computing the local transform.
-   *
+   * @brief Compute the local tranformation 'L = S * J(Joint Value)'
    * @param joint_value The joint value for calculating the local transformation
    * @return The local transformation for the provided joint value
    */
   virtual Eigen::Isometry3d computeLocalTransformation(double joint_value) const = 0;
 
-  /**
-   * @brief Compute and store the nodes world transformation
-   *
-   * This should reset the flag such that updateWorldTransformationRequired() returns false
-   */
-  virtual void computeAndStoreWorldTransformation() = 0;
-
-  /**
-   * @brief Get the nodes world transformation
-   * @return The nodes world transformation
-   */
-  virtual const Eigen::Isometry3d& getWorldTransformation() const = 0;
-
-  /**
-   * @brief Indicates if an update of the world transformation is required.
-   *
-   * This should get set to true when either of the following happen.
-   *     - If setParent() was called
-   *     - If setStaticTransformation() was called
-   *
-   * Note: setJointValue() is not handle here because that is captured by hasJointValueChanged()
-   * @return If true, the world transformation need to be recalculated.
-   */
-  virtual bool updateWorldTransformationRequired() const = 0;
-
   /**
    * @brief Return the twist of the node in its local frame
    * @return The node twist
@@ -62,22 +62,11 @@ public:
   const std::string& getLinkName() const override;
   const std::string& getJointName() const override;
 
-  void storeJointValue(double joint_value) override;
-
-  double getJointValue() const override;
-
-  bool hasJointValueChanged() const override;
-
   void setStaticTransformation(const Eigen::Isometry3d& static_tf) override;
 
   const Eigen::Isometry3d& getStaticTransformation() const override;
-  const Eigen::Isometry3d& getLocalTransformation() const override;
   Eigen::Isometry3d computeLocalTransformation(double joint_value) const override;
 
-  void computeAndStoreWorldTransformation() override;
-  const Eigen::Isometry3d& getWorldTransformation() const override;
-  bool updateWorldTransformationRequired() const override;
-
   Eigen::Matrix<double, 6, 1> getLocalTwist() const override;
 
   void addChild(OFKTNode* node) override;
@@ -91,19 +80,11 @@ protected:
   std::string link_name_;
   std::string joint_name_;
   Eigen::Isometry3d static_tf_{ Eigen::Isometry3d::Identity() };
-  Eigen::Isometry3d joint_tf_{ Eigen::Isometry3d::Identity() };
-  Eigen::Isometry3d local_tf_{ Eigen::Isometry3d::Identity() };
-  Eigen::Isometry3d world_tf_{ Eigen::Isometry3d::Identity() };
   Eigen::Matrix<double, 6, 1> local_twist_{ Eigen::VectorXd::Zero(6) };
 
-  double joint_value_{ 0 };
-  bool joint_value_changed_{ false };
-
   std::vector<OFKTNode*> children_;
   std::vector<const OFKTNode*> children_const_;
 
-  bool update_world_required_{ true };
-
   friend class OFKTStateSolver;
 };
 
@@ -124,11 +105,7 @@ public:
   OFKTRootNode(std::string link_name);
 
   void setParent(OFKTNode* parent) override;
-  void storeJointValue(double joint_value) override;
   void setStaticTransformation(const Eigen::Isometry3d& static_tf) override;
-  void computeAndStoreLocalTransformation() override;
-  void computeAndStoreWorldTransformation() override;
-  bool updateWorldTransformationRequired() const override;
 
   Eigen::Isometry3d computeLocalTransformation(double joint_value) const override;
 
@@ -148,10 +125,6 @@ public:
 
   OFKTFixedNode(OFKTNode* parent, std::string link_name, std::string joint_name, const Eigen::Isometry3d& static_tf);
 
-  void storeJointValue(double joint_value) override;
-  double getJointValue() const override;
-  void setStaticTransformation(const Eigen::Isometry3d& static_tf) override;
-  void computeAndStoreLocalTransformation() override;
   Eigen::Isometry3d computeLocalTransformation(double joint_value) const override;
 
 private:
@@ -174,16 +147,12 @@ public:
                    const Eigen::Isometry3d& static_tf,
                    const Eigen::Vector3d& axis);
 
-  void storeJointValue(double joint_value) override;
-  void computeAndStoreLocalTransformation() override;
   Eigen::Isometry3d computeLocalTransformation(double joint_value) const override;
   const Eigen::Vector3d& getAxis() const;
 
 private:
   Eigen::Vector3d axis_;
 
-  void computeAndStoreLocalTransformationImpl();
-
   friend class OFKTStateSolver;
 };
 
@@ -203,15 +172,12 @@ public:
                      const Eigen::Isometry3d& static_tf,
                      const Eigen::Vector3d& axis);
 
-  void computeAndStoreLocalTransformation() override;
   Eigen::Isometry3d computeLocalTransformation(double joint_value) const override;
   const Eigen::Vector3d& getAxis() const;
 
 private:
   Eigen::Vector3d axis_;
 
-  void computeAndStoreLocalTransformationImpl();
-
   friend class OFKTStateSolver;
 };
 
@@ -231,15 +197,12 @@ public:
                     const Eigen::Isometry3d& static_tf,
                     const Eigen::Vector3d& axis);
 
-  void computeAndStoreLocalTransformation() override;
   Eigen::Isometry3d computeLocalTransformation(double joint_value) const override;
   const Eigen::Vector3d& getAxis() const;
 
 private:
   Eigen::Vector3d axis_;
 
-  void computeAndStoreLocalTransformationImpl();
-
   friend class OFKTStateSolver;
 };
 }  // namespace tesseract_scene_graph
@@ -37,10 +37,12 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 #include <string>
 #include <shared_mutex>
+#include <mutex>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_state_solver/mutable_state_solver.h>
 #include <tesseract_state_solver/ofkt/ofkt_node.h>
+#include <tesseract_state_solver/ofkt/ofkt_kinematic_tree.h>
 #include <tesseract_scene_graph/scene_state.h>
 #include <tesseract_common/kinematic_limits.h>
 
@@ -52,6 +54,8 @@ namespace tesseract_scene_graph
  * Starke, S., Hendrich, N., & Zhang, J. (2018). A Forward Kinematics Data Structure for Efficient Evolutionary Inverse
  * Kinematics. In Computational Kinematics (pp. 560-568). Springer, Cham.
  *
+ * The nodes define the structure of the tree, while all kinematics are evaluated using a flattened OFKTKinematicTree
+ * which is regenerated every time the structure changes.
  */
 class OFKTStateSolver : public MutableStateSolver
 {
@@ -89,6 +93,16 @@ public:
 
   SceneState getState() const override final;
 
+  std::shared_ptr<const SceneStateLayout> getCompactStateLayout() const override final;
+
+  void getCompactState(CompactSceneState& state,
+                       const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override final;
+
+  void getCompactState(CompactSceneState& state) const override final;
+
+  void getStates(tesseract_common::VectorIsometry3d& link_transforms,
+                 const Eigen::Ref<const tesseract_common::TrajArray>& joint_values) const override final;
+
   SceneState getRandomState() const override final;
 
   Eigen::MatrixXd getJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
@@ -100,6 +114,11 @@ public:
                               const Eigen::Ref<const Eigen::VectorXd>& joint_values,
                               const std::string& link_name) const override final;
 
+  void getJacobians(Eigen::Ref<Eigen::MatrixXd> jacobians,
+                    const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                    const std::vector<std::string>& link_names,
+                    const tesseract_common::VectorVector3d& link_points = {}) const override final;
+
   std::vector<std::string> getJointNames() const override final;
 
   std::vector<std::string> getActiveJointNames() const override final;
@@ -125,6 +144,10 @@ public:
 
   tesseract_common::KinematicLimits getLimits() const override final;
 
+  std::vector<std::string> getChangedLinkNames() const override final;
+
+  void clearChangedLinkNames() override final;
+
   bool addLink(const Link& link, const Joint& joint) override final;
 
   bool moveLink(const Joint& joint) override final;
@@ -167,6 +190,32 @@ private:
   /** @brief The state solver can be accessed from multiple threads, need use mutex throughout */
   mutable std::shared_mutex mutex_;
 
+  /**
+   * @brief Flags the links whose world transform changed since clearChangedLinkNames was called
+   * @details This is indexed like link_names_, which is also the link order of the compact state layout, so the update
+   * can record a change without hashing the link name.
+   */
+  std::vector<char> changed_links_;
+
+  /** @brief The compact state layout, this is reset when the links or joints change and rebuilt on request */
+  mutable std::shared_ptr<const SceneStateLayout> layout_;
+
+  /**
+   * @brief The kinematic tree used by the const queries
+   * @details This is reset when the structure changes and rebuilt on request. It must only be accessed using the atomic
+   * shared pointer functions.
+   */
+  mutable OFKTKinematicTree::ConstPtr tree_;
+
+  /** @brief The kinematic tree is rebuilt while holding a shared lock so it requires its own mutex */
+  mutable std::mutex tree_mutex_;
+
+  /** @brief The current state in the layout of the kinematic tree, this is kept in sync with current_state_ */
+  CompactSceneState current_compact_state_;
+
+  /** @brief Storage for the kinematic tree nodes which changed during the last update */
+  std::vector<char> changed_nodes_;
+
   bool initHelper(const tesseract_scene_graph::SceneGraph& scene_graph, const std::string& prefix);
 
   void clear();
@@ -180,29 +229,40 @@ private:
   void loadStaticLinkNamesRecursive(std::vector<std::string>& static_link_names, const OFKTNode* node) const;
 
   /**
-   * @brief This update the local and world transforms
-   * @param node The node to start from
-   * @param update_required Indicates if work transform update is required
+   * @brief Recalculate the current state after the structure of the tree changed
+   * @details Every link whose transform changed is added to the changed link names
    */
-  void update(OFKTNode* node, bool update_required);
+  void update();
 
   /**
-   * @brief This is a const version of the function above
-   * @param node The node to start from
-   * @param parent_world_tf The nodes parent's world transformaiton
-   * @param update_required Indicates if work transform update is required
+   * @brief Update the current state to new joint values
+   * @details Only the links downstream of a joint whose value changed are recalculated
+   * @param joint_values The joint values in layout joint order
    */
-  void
-  update(SceneState& state, const OFKTNode* node, const Eigen::Isometry3d& parent_world_tf, bool update_required) const;
+  void update(const Eigen::Ref<const Eigen::VectorXd>& joint_values);
 
   /**
-   * @brief Given a set of joint values calculate the jacobian for the provided link_name
-   * @param joints The joint values to calculate the jacobian for
-   * @param link_name The link name to calculate the jacobian for
-   * @return The calculated geometric jacobian
+   * @brief Get the kinematic tree building it if required
+   * @details This does not lock the solver if the kinematic tree is already built
    */
-  Eigen::MatrixXd calcJacobianHelper(const std::unordered_map<std::string, double>& joints,
-                                     const std::string& link_name) const;
+  OFKTKinematicTree::ConstPtr getKinematicTree() const;
+
+  /** @brief Get the kinematic tree building it if required, the caller must hold a lock on mutex_ */
+  OFKTKinematicTree::ConstPtr getKinematicTreeHelper() const;
+
+  /**
+   * @brief Add a node and all of its children to the kinematic tree
+   * @param tree The kinematic tree being built
+   * @param node The node to add
+   * @param parent_index The kinematic tree index of the node's parent
+   */
+  void loadKinematicTreeRecursive(OFKTKinematicTree& tree, const OFKTNode* node, std::size_t parent_index) const;
+
+  /** @brief Discard the kinematic tree, this must be called every time the structure of the tree changes */
+  void resetKinematicTree();
+
+  /** @brief Get the current joint values in layout order, the caller must hold a lock on mutex_ */
+  Eigen::VectorXd getCurrentJointValuesHelper(const SceneStateLayout& layout) const;
 
   /**
    * @brief A helper function used for cloning the OFKTStateSolver
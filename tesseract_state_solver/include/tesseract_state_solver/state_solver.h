@@ -28,6 +28,7 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <memory>
@@ -38,7 +39,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/fwd.h>
 #include <tesseract_scene_graph/fwd.h>
+#include <tesseract_scene_graph/scene_state.h>
 #include <tesseract_common/eigen_types.h>
+#include <tesseract_common/utils.h>
 
 namespace tesseract_scene_graph
 {
@@ -107,6 +110,81 @@ public:
    */
   virtual SceneState getState() const = 0;
 
+  /**
+   * @brief Get the layout used by the compact scene states of this solver
+   * @details The same layout is returned until the structure of the solver changes. The default implementation builds a
+   * new layout on every call and does not know the parent joint of each link, so the joint transforms are not populated
+   * when converting its compact states to a SceneState. Solvers should override this to return a cached layout.
+   * @return The compact scene state layout
+   */
+  virtual std::shared_ptr<const SceneStateLayout> getCompactStateLayout() const
+  {
+    std::vector<std::string> link_names = getLinkNames();
+    std::vector<std::string> link_joint_names(link_names.size());
+    return std::make_shared<const SceneStateLayout>(
+        getActiveJointNames(), std::move(link_names), std::move(link_joint_names));
+  }
+
+  /**
+   * @brief Get the compact state of the solver given the joint values
+   * @details This does not change the internal state of the solver. If the state already uses the layout of this solver
+   * no memory is allocated, otherwise the layout of the state is replaced. The default implementation converts the
+   * result of getState.
+   * @param state The compact state to populate
+   * @param joint_values The joint values, this must be the same size and order as what is returned by
+   * getActiveJointNames
+   */
+  virtual void getCompactState(CompactSceneState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+  {
+    std::shared_ptr<const SceneStateLayout> layout = getCompactStateLayout();
+    if (state.layout != layout)
+      state.setLayout(std::move(layout));
+
+    state.fromSceneState(getState(state.layout->joint_names, joint_values));
+  }
+
+  /**
+   * @brief Get the current state of the solver as a compact state
+   * @details The default implementation converts the result of getState.
+   * @param state The compact state to populate
+   */
+  virtual void getCompactState(CompactSceneState& state) const
+  {
+    std::shared_ptr<const SceneStateLayout> layout = getCompactStateLayout();
+    if (state.layout != layout)
+      state.setLayout(std::move(layout));
+
+    state.fromSceneState(getState());
+  }
+
+  /**
+   * @brief Get the link transforms for a set of states
+   * @details This does not change the internal state of the solver. The link transforms are stored state by state in
+   * the link order of getCompactStateLayout, so the transform of link j for state i is located at
+   * i * num_links + j. The vector is only resized if it does not already have the required size. The default
+   * implementation calls getCompactState for each state.
+   * @param link_transforms The link transforms to populate
+   * @param joint_values The joint values where each row is a state, the columns must be the same size and order as
+   * what is returned by getActiveJointNames
+   */
+  virtual void getStates(tesseract_common::VectorIsometry3d& link_transforms,
+                         const Eigen::Ref<const tesseract_common::TrajArray>& joint_values) const
+  {
+    CompactSceneState state(getCompactStateLayout());
+    const std::size_t num_links = state.link_transforms.size();
+    const std::size_t size = static_cast<std::size_t>(joint_values.rows()) * num_links;
+    if (link_transforms.size() != size)
+      link_transforms.resize(size);
+
+    for (Eigen::Index i = 0; i < joint_values.rows(); ++i)
+    {
+      getCompactState(state, joint_values.row(i).transpose());
+      std::copy(state.link_transforms.begin(),
+                state.link_transforms.end(),
+                link_transforms.begin() + (i * static_cast<Eigen::Index>(num_links)));
+    }
+  }
+
   /**
    * @brief Get the jacobian of the solver given the joint values
    * @details This must be the same size and order as what is returned by getJointNames
@@ -134,6 +212,42 @@ public:
                                       const Eigen::Ref<const Eigen::VectorXd>& joint_values,
                                       const std::string& link_name) const = 0;
 
+  /**
+   * @brief Get the jacobians of multiple links for a single set of joint values
+   * @details The link transforms are only calculated once for all links. Each jacobian is relative to the base link
+   * and its columns are in the order of getActiveJointNames. This does not change the internal state of the solver.
+   * @param jacobians The jacobians to populate where rows 6 * i to 6 * i + 5 are the jacobian of link i, this must be
+   * 6 * link_names.size() by the number of active joints
+   * @param joint_values The joint values, this must be the same size and order as what is returned by
+   * getActiveJointNames
+   * @param link_names The link names to calculate the jacobians
+   * @param link_points The points on each link, expressed in the link frame, to calculate the jacobians at. If empty
+   * the jacobians are calculated at the link origins, otherwise it must be the same size as link_names.
+   * @note The default implementation calls getJacobian for each link so the link transforms are recalculated per link
+   */
+  virtual void getJacobians(Eigen::Ref<Eigen::MatrixXd> jacobians,
+                            const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                            const std::vector<std::string>& link_names,
+                            const tesseract_common::VectorVector3d& link_points = {}) const
+  {
+    const std::vector<std::string> joint_names = getActiveJointNames();
+    SceneState state;
+    if (!link_points.empty())
+      state = getState(joint_names, joint_values);
+
+    for (std::size_t i = 0; i < link_names.size(); ++i)
+    {
+      Eigen::MatrixXd jacobian = getJacobian(joint_names, joint_values, link_names[i]);
+      if (!link_points.empty())
+      {
+        const Eigen::Isometry3d& link_tf = state.link_transforms.at(link_names[i]);
+        tesseract_common::jacobianChangeRefPoint(jacobian, link_tf.linear() * link_points[i]);
+      }
+
+      jacobians.middleRows(6 * static_cast<Eigen::Index>(i), 6) = jacobian;
+    }
+  }
+
   /**
    * @brief Get the random state of the environment
    * @return Environment state
@@ -217,6 +331,20 @@ public:
    * @return The kinematic limits
    */
   virtual tesseract_common::KinematicLimits getLimits() const = 0;
+
+  /**
+   * @brief Get the link names whose world transform changed since the last call to clearChangedLinkNames
+   * @details This allows consumers of the current state to only update what changed, after construction all links
+   * are considered changed. The default implementation does not track changes and always returns every link name.
+   * @return The changed link names
+   */
+  virtual std::vector<std::string> getChangedLinkNames() const { return getLinkNames(); }
+
+  /**
+   * @brief Clear the changed link names, this should be called after the changes have been consumed
+   * @details The default implementation does nothing since changes are not tracked
+   */
+  virtual void clearChangedLinkNames() {}
 };
 }  // namespace tesseract_scene_graph
 
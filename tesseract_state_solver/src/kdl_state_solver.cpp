@@ -69,7 +69,10 @@ KDLStateSolver& KDLStateSolver::operator=(const KDLStateSolver& other)
   joint_qnr_ = other.joint_qnr_;
   kdl_jnt_array_ = other.kdl_jnt_array_;
   limits_ = other.limits_;
+  links_changed_ = other.links_changed_;
+  layout_ = other.layout_;
   jac_solver_ = std::make_unique<KDL::TreeJntToJacSolver>(data_.tree);
+  processSegments();
   return *this;
 }
 
@@ -83,6 +86,7 @@ void KDLStateSolver::setState(const Eigen::Ref<const Eigen::VectorXd>& joint_val
   }
 
   calculateTransforms(current_state_, kdl_jnt_array_, data_.tree.getRootSegment(), Eigen::Isometry3d::Identity());
+  links_changed_ = true;
 }
 
 void KDLStateSolver::setState(const std::unordered_map<std::string, double>& joint_values)
@@ -94,6 +98,7 @@ void KDLStateSolver::setState(const std::unordered_map<std::string, double>& joi
   }
 
   calculateTransforms(current_state_, kdl_jnt_array_, data_.tree.getRootSegment(), Eigen::Isometry3d::Identity());
+  links_changed_ = true;
 }
 
 void KDLStateSolver::setState(const std::vector<std::string>& joint_names,
@@ -107,6 +112,7 @@ void KDLStateSolver::setState(const std::vector<std::string>& joint_names,
   }
 
   calculateTransforms(current_state_, kdl_jnt_array_, data_.tree.getRootSegment(), Eigen::Isometry3d::Identity());
+  links_changed_ = true;
 }
 
 SceneState KDLStateSolver::getState(const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
@@ -163,6 +169,42 @@ SceneState KDLStateSolver::getState(const std::vector<std::string>& joint_names,
 
 SceneState KDLStateSolver::getState() const { return current_state_; }
 
+std::shared_ptr<const SceneStateLayout> KDLStateSolver::getCompactStateLayout() const { return layout_; }
+
+void KDLStateSolver::getCompactState(CompactSceneState& state,
+                                     const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  if (state.layout != layout_)
+    state.setLayout(layout_);
+
+  // KDL calculates the transforms into a scene state so this allocates
+  state.fromSceneState(getState(joint_values));
+}
+
+void KDLStateSolver::getCompactState(CompactSceneState& state) const
+{
+  if (state.layout != layout_)
+    state.setLayout(layout_);
+
+  state.fromSceneState(current_state_);
+}
+
+void KDLStateSolver::getStates(tesseract_common::VectorIsometry3d& link_transforms,
+                               const Eigen::Ref<const tesseract_common::TrajArray>& joint_values) const
+{
+  assert(static_cast<Eigen::Index>(data_.active_joint_names.size()) == joint_values.cols());
+  const auto size = static_cast<std::size_t>(joint_values.rows()) * layout_->link_names.size();
+  if (link_transforms.size() != size)
+    link_transforms.resize(size);
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (Eigen::Index i = 0; i < joint_values.rows(); ++i)
+  {
+    const std::size_t offset = static_cast<std::size_t>(i) * layout_->link_names.size();
+    calculateTransformsHelper(link_transforms, offset, joint_values.row(i));
+  }
+}
+
 SceneState KDLStateSolver::getRandomState() const
 {
   Eigen::VectorXd rs = tesseract_common::generateRandomNumber(limits_.joint_limits);
@@ -204,6 +246,59 @@ Eigen::MatrixXd KDLStateSolver::getJacobian(const std::vector<std::string>& join
   throw std::runtime_error("KDLStateSolver: Failed to calculate jacobian.");
 }
 
+void KDLStateSolver::getJacobians(Eigen::Ref<Eigen::MatrixXd> jacobians,
+                                  const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                  const std::vector<std::string>& link_names,
+                                  const tesseract_common::VectorVector3d& link_points) const
+{
+  assert(static_cast<Eigen::Index>(data_.active_joint_names.size()) == joint_values.size());
+  assert(jacobians.rows() == 6 * static_cast<Eigen::Index>(link_names.size()));
+  assert(jacobians.cols() == joint_values.size());
+  assert(link_points.empty() || link_points.size() == link_names.size());
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  const tesseract_common::VectorIsometry3d& link_transforms = jacobian_link_transforms_;
+  calculateTransformsHelper(jacobian_link_transforms_, 0, joint_values);
+
+  jacobians.setZero();
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+  {
+    const std::size_t link_index = layout_->getLinkIndex(link_names[i]);
+    const Eigen::Isometry3d& link_tf = link_transforms[link_index];
+    const Eigen::Vector3d point =
+        link_points.empty() ? link_tf.translation() : Eigen::Vector3d(link_tf * link_points[i]);
+    const auto row = static_cast<Eigen::Index>(6 * i);
+
+    // The joint axis and origin are defined in the frame of the segment's parent
+    std::size_t segment = link_segments_[link_index];
+    while (segment != 0)
+    {
+      const SegmentInfo& info = segments_[segment];
+      segment = info.parent;
+      if (info.joint_index < 0)
+        continue;
+
+      const KDL::Joint& joint = GetTreeElementSegment(*info.element).getJoint();
+      const Eigen::Isometry3d& parent_tf = link_transforms[segments_[segment].link_index];
+      const Eigen::Vector3d axis = parent_tf.linear() * convert(joint.JointAxis());
+      auto twist = jacobians.block<6, 1>(row, info.joint_index);
+      switch (joint.getType())
+      {
+        case KDL::Joint::TransAxis:
+        case KDL::Joint::TransX:
+        case KDL::Joint::TransY:
+        case KDL::Joint::TransZ:
+          twist.head<3>() = axis;
+          break;
+        default:
+          twist.head<3>() = axis.cross(point - parent_tf * convert(joint.JointOrigin()));
+          twist.tail<3>() = axis;
+          break;
+      }
+    }
+  }
+}
+
 std::vector<std::string> KDLStateSolver::getJointNames() const { return data_.joint_names; }
 
 std::vector<std::string> KDLStateSolver::getActiveJointNames() const { return data_.active_joint_names; }
@@ -250,6 +345,17 @@ Eigen::Isometry3d KDLStateSolver::getRelativeLinkTransform(const std::string& fr
 
 tesseract_common::KinematicLimits KDLStateSolver::getLimits() const { return limits_; }
 
+std::vector<std::string> KDLStateSolver::getChangedLinkNames() const
+{
+  // All link transforms are recalculated when the state is set
+  if (links_changed_)
+    return data_.link_names;
+
+  return {};
+}
+
+void KDLStateSolver::clearChangedLinkNames() { links_changed_ = false; }
+
 bool KDLStateSolver::processKDLData(const tesseract_scene_graph::SceneGraph& scene_graph)
 {
   current_state_ = SceneState();
@@ -290,10 +396,60 @@ bool KDLStateSolver::processKDLData(const tesseract_scene_graph::SceneGraph& sce
 
   jac_solver_ = std::make_unique<KDL::TreeJntToJacSolver>(data_.tree);
 
+  std::vector<std::string> link_joint_names;
+  link_joint_names.reserve(data_.link_names.size());
+  for (const auto& link_name : data_.link_names)
+  {
+    auto it = data_.tree.getSegment(link_name);
+    if (it == data_.tree.getRootSegment())
+      link_joint_names.emplace_back();
+    else
+      link_joint_names.push_back(it->second.segment.getJoint().getName());
+  }
+  layout_ = std::make_shared<const SceneStateLayout>(data_.active_joint_names, data_.link_names, link_joint_names);
+  processSegments();
+
   calculateTransforms(current_state_, kdl_jnt_array_, data_.tree.getRootSegment(), Eigen::Isometry3d::Identity());
   return true;
 }
 
+void KDLStateSolver::processSegments()
+{
+  segments_.clear();
+  segments_.reserve(data_.tree.getNrOfSegments() + 1);
+
+  std::vector<Eigen::Index> qnr_to_joint(joint_qnr_.size(), -1);
+  for (std::size_t j = 0; j < joint_qnr_.size(); ++j)
+    qnr_to_joint[static_cast<std::size_t>(joint_qnr_[j])] = static_cast<Eigen::Index>(j);
+
+  // Depth first from the root so a parent is always added before its children
+  std::vector<std::pair<KDL::SegmentMap::const_iterator, std::size_t>> stack{ { data_.tree.getRootSegment(), 0 } };
+  while (!stack.empty())
+  {
+    const auto [it, parent] = stack.back();
+    stack.pop_back();
+
+    const KDL::TreeElementType& element = it->second;
+    SegmentInfo info;
+    info.element = &element;
+    info.parent = parent;
+    info.link_index = layout_->getLinkIndex(it->first);
+    if (GetTreeElementSegment(element).getJoint().getType() != KDL::Joint::None)
+      info.joint_index = qnr_to_joint[GetTreeElementQNr(element)];
+
+    const std::size_t index = segments_.size();
+    segments_.push_back(info);
+    for (const auto& child : GetTreeElementChildren(element))
+      stack.emplace_back(child, index);
+  }
+
+  link_segments_.assign(layout_->link_names.size(), 0);
+  for (std::size_t i = 0; i < segments_.size(); ++i)
+    link_segments_[segments_[i].link_index] = i;
+
+  jacobian_link_transforms_.resize(layout_->link_names.size());
+}
+
 bool KDLStateSolver::setJointValuesHelper(KDL::JntArray& q,
                                           const std::string& joint_name,
                                           const double& joint_value) const
@@ -336,6 +492,24 @@ void KDLStateSolver::calculateTransformsHelper(SceneState& state,
   }
 }
 
+void KDLStateSolver::calculateTransformsHelper(tesseract_common::VectorIsometry3d& link_transforms,
+                                               std::size_t offset,
+                                               const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(link_transforms.size() >= offset + layout_->link_names.size());
+  for (std::size_t i = 0; i < segments_.size(); ++i)
+  {
+    const SegmentInfo& info = segments_[i];
+    const double joint_value = (info.joint_index < 0) ? 0 : joint_values(info.joint_index);
+    const Eigen::Isometry3d local_frame = convert(GetTreeElementSegment(*info.element).pose(joint_value));
+    if (i == 0)
+      link_transforms[offset + info.link_index] = local_frame;
+    else
+      link_transforms[offset + info.link_index] =
+          link_transforms[offset + segments_[info.parent].link_index] * local_frame;
+  }
+}
+
 void KDLStateSolver::calculateTransforms(SceneState& state,
                                          const KDL::JntArray& q_in,
                                          const KDL::SegmentMap::const_iterator& it,
@@ -0,0 +1,212 @@
+/**
+ * @file ofkt_kinematic_tree.cpp
+ * @brief A flattened immutable copy of the Optimized Forward Kinematic Tree.
+ *
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_state_solver/ofkt/ofkt_kinematic_tree.h>
+#include <tesseract_common/utils.h>
+
+namespace tesseract_scene_graph
+{
+std::size_t OFKTKinematicTree::size() const { return parent_indices.size(); }
+
+Eigen::Isometry3d OFKTKinematicTree::calcLocalTransform(std::size_t node, double joint_value) const
+{
+  switch (joint_types[node])
+  {
+    case JointType::REVOLUTE:
+    case JointType::CONTINUOUS:
+      return static_transforms[node] * Eigen::AngleAxisd(joint_value, axes[node]);
+    case JointType::PRISMATIC:
+      return static_transforms[node] * Eigen::Translation3d(joint_value * axes[node]);
+    default:
+      return static_transforms[node];
+  }
+}
+
+void OFKTKinematicTree::calcLinkTransforms(tesseract_common::VectorIsometry3d& link_transforms,
+                                           std::size_t offset,
+                                           const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(static_cast<Eigen::Index>(layout->joint_names.size()) == joint_values.size());
+  assert(link_transforms.size() >= offset + link_nodes.size());
+  if (parent_indices.empty())
+    return;
+
+  link_transforms[offset + link_indices[0]] = static_transforms[0];
+  for (std::size_t i = 1; i < size(); ++i)
+  {
+    const Eigen::Index joint_idx = joint_indices[i];
+    const double joint_value = (joint_idx < 0) ? 0 : joint_values(joint_idx);
+    link_transforms[offset + link_indices[i]] =
+        link_transforms[offset + link_indices[parent_indices[i]]] * calcLocalTransform(i, joint_value);
+  }
+}
+
+void OFKTKinematicTree::updateLinkTransforms(tesseract_common::VectorIsometry3d& link_transforms,
+                                             const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                             const Eigen::Ref<const Eigen::VectorXd>& previous_joint_values,
+                                             std::vector<char>& changed) const
+{
+  assert(static_cast<Eigen::Index>(layout->joint_names.size()) == joint_values.size());
+  assert(joint_values.size() == previous_joint_values.size());
+  assert(link_transforms.size() == link_nodes.size());
+
+  // The root never changes
+  changed.assign(size(), 0);
+  for (std::size_t i = 1; i < size(); ++i)
+  {
+    const Eigen::Index joint_idx = joint_indices[i];
+    const double joint_value = (joint_idx < 0) ? 0 : joint_values(joint_idx);
+    changed[i] = static_cast<char>(changed[parent_indices[i]] != 0 ||
+                                   (joint_idx >= 0 && joint_value != previous_joint_values(joint_idx)));
+
+    if (changed[i] != 0)
+      link_transforms[link_indices[i]] =
+          link_transforms[link_indices[parent_indices[i]]] * calcLocalTransform(i, joint_value);
+  }
+}
+
+void OFKTKinematicTree::calcLinkTransforms(tesseract_common::VectorIsometry3d& link_transforms,
+                                           const Eigen::Ref<const tesseract_common::TrajArray>& joint_values) const
+{
+  if (joint_values.rows() == 0 || parent_indices.empty())
+    return;
+
+  assert(static_cast<Eigen::Index>(layout->joint_names.size()) == joint_values.cols());
+  assert(link_transforms.size() == static_cast<std::size_t>(joint_values.rows()) * link_nodes.size());
+
+  calcLinkTransforms(link_transforms, 0, joint_values.row(0));
+
+  // Identifies if the node or any of its parents changed since the previous state, the root never changes. The flags
+  // are thread local so repeated calls do not allocate.
+  thread_local std::vector<char> changed;
+  changed.assign(size(), 0);
+  const std::size_t num_links = link_nodes.size();
+  for (Eigen::Index row = 1; row < joint_values.rows(); ++row)
+  {
+    const std::size_t offset = static_cast<std::size_t>(row) * num_links;
+    link_transforms[offset + link_indices[0]] = static_transforms[0];
+    for (std::size_t i = 1; i < size(); ++i)
+    {
+      const Eigen::Index joint_idx = joint_indices[i];
+      const double joint_value = (joint_idx < 0) ? 0 : joint_values(row, joint_idx);
+      changed[i] = static_cast<char>(changed[parent_indices[i]] != 0 ||
+                                     (joint_idx >= 0 && joint_value != joint_values(row - 1, joint_idx)));
+
+      const std::size_t idx = offset + link_indices[i];
+      if (changed[i] != 0)
+        link_transforms[idx] =
+            link_transforms[offset + link_indices[parent_indices[i]]] * calcLocalTransform(i, joint_value);
+      else
+        link_transforms[idx] = link_transforms[idx - num_links];
+    }
+  }
+}
+
+void OFKTKinematicTree::calcJacobian(Eigen::Ref<Eigen::MatrixXd> jacobian,
+                                     const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                     std::size_t link_index) const
+{
+  assert(jacobian.rows() == 6);
+  assert(jacobian.cols() == static_cast<Eigen::Index>(layout->joint_names.size()));
+  assert(joint_values.size() == static_cast<Eigen::Index>(layout->joint_names.size()));
+
+  jacobian.setZero();
+  Eigen::Isometry3d total_tf{ Eigen::Isometry3d::Identity() };
+  std::size_t node = link_nodes[link_index];
+  while (node != 0)
+  {
+    const Eigen::Index joint_idx = joint_indices[node];
+    if (joint_idx < 0)
+    {
+      total_tf = static_transforms[node] * total_tf;
+    }
+    else
+    {
+      const Eigen::Isometry3d local_tf = calcLocalTransform(node, joint_values(joint_idx));
+      total_tf = local_tf * total_tf;
+
+      // The joint axis is defined in the joint frame so it must be rotated into the parent frame
+      auto twist = jacobian.col(joint_idx);
+      if (joint_types[node] == JointType::PRISMATIC)
+        twist.head<3>() = static_transforms[node].linear() * axes[node];
+      else
+        twist.tail<3>() = static_transforms[node].linear() * axes[node];
+
+      tesseract_common::twistChangeRefPoint(twist, total_tf.translation() - local_tf.translation());
+      tesseract_common::twistChangeBase(twist, total_tf.inverse());
+    }
+
+    node = parent_indices[node];
+  }
+
+  tesseract_common::jacobianChangeBase(jacobian, total_tf);
+}
+
+void OFKTKinematicTree::calcJacobians(Eigen::Ref<Eigen::MatrixXd> jacobians,
+                                      const tesseract_common::VectorIsometry3d& link_transforms,
+                                      const std::vector<std::string>& link_names,
+                                      const tesseract_common::VectorVector3d& link_points) const
+{
+  assert(jacobians.rows() == 6 * static_cast<Eigen::Index>(link_names.size()));
+  assert(jacobians.cols() == static_cast<Eigen::Index>(layout->joint_names.size()));
+  assert(link_transforms.size() == link_nodes.size());
+  assert(link_points.empty() || link_points.size() == link_names.size());
+
+  jacobians.setZero();
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+  {
+    const std::size_t link_index = layout->getLinkIndex(link_names[i]);
+    const Eigen::Isometry3d& link_tf = link_transforms[link_index];
+    const Eigen::Vector3d point =
+        link_points.empty() ? link_tf.translation() : Eigen::Vector3d(link_tf * link_points[i]);
+    const auto row = static_cast<Eigen::Index>(6 * i);
+
+    // A joint's axis and origin are unaffected by its own joint value so they are taken from its child link transform
+    std::size_t node = link_nodes[link_index];
+    while (node != 0)
+    {
+      const Eigen::Index joint_idx = joint_indices[node];
+      if (joint_idx >= 0)
+      {
+        const Eigen::Isometry3d& joint_tf = link_transforms[link_indices[node]];
+        const Eigen::Vector3d axis = joint_tf.linear() * axes[node];
+        auto twist = jacobians.block<6, 1>(row, joint_idx);
+        if (joint_types[node] == JointType::PRISMATIC)
+        {
+          twist.head<3>() = axis;
+        }
+        else
+        {
+          twist.head<3>() = axis.cross(point - joint_tf.translation());
+          twist.tail<3>() = axis;
+        }
+      }
+
+      node = parent_indices[node];
+    }
+  }
+}
+
+}  // namespace tesseract_scene_graph
@@ -53,45 +53,21 @@ OFKTBaseNode::OFKTBaseNode(JointType type,
   , link_name_(std::move(link_name))
   , joint_name_(std::move(joint_name))
   , static_tf_(static_tf)
-  , local_tf_(static_tf)
 {
 }
 
 tesseract_scene_graph::JointType OFKTBaseNode::getType() const { return type_; }
 
-void OFKTBaseNode::setParent(OFKTNode* parent)
-{
-  parent_ = parent;
-  update_world_required_ = true;
-}
+void OFKTBaseNode::setParent(OFKTNode* parent) { parent_ = parent; }
 OFKTNode* OFKTBaseNode::getParent() { return parent_; }
 const OFKTNode* OFKTBaseNode::getParent() const { return parent_; }
 
 const std::string& OFKTBaseNode::getLinkName() const { return link_name_; }
 const std::string& OFKTBaseNode::getJointName() const { return joint_name_; }
 
-void OFKTBaseNode::storeJointValue(double joint_value)
-{
-  if (!tesseract_common::almostEqualRelativeAndAbs(joint_value_, joint_value, 1e-8))
-  {
-    joint_value_ = joint_value;
-    joint_value_changed_ = true;
-  }
-}
-
-double OFKTBaseNode::getJointValue() const { return joint_value_; }
-
-bool OFKTBaseNode::hasJointValueChanged() const { return joint_value_changed_; }
-
-void OFKTBaseNode::setStaticTransformation(const Eigen::Isometry3d& static_tf)
-{
-  static_tf_ = static_tf;
-  local_tf_ = static_tf_ * joint_tf_;
-  update_world_required_ = true;
-}
+void OFKTBaseNode::setStaticTransformation(const Eigen::Isometry3d& static_tf) { static_tf_ = static_tf; }
 
 const Eigen::Isometry3d& OFKTBaseNode::getStaticTransformation() const { return static_tf_; }
-const Eigen::Isometry3d& OFKTBaseNode::getLocalTransformation() const { return local_tf_; }
 // LCOV_EXCL_START
 Eigen::Isometry3d OFKTBaseNode::computeLocalTransformation(double /*joint_value*/) const
 {
@@ -99,14 +75,6 @@ Eigen::Isometry3d OFKTBaseNode::computeLocalTransformation(double /*joint_value*
 }
 // LCOV_EXCL_STOP
 
-void OFKTBaseNode::computeAndStoreWorldTransformation()
-{
-  world_tf_ = parent_->getWorldTransformation() * local_tf_;
-  update_world_required_ = false;
-}
-const Eigen::Isometry3d& OFKTBaseNode::getWorldTransformation() const { return world_tf_; }
-bool OFKTBaseNode::updateWorldTransformationRequired() const { return update_world_required_; }
-
 Eigen::Matrix<double, 6, 1> OFKTBaseNode::getLocalTwist() const { return local_twist_; }
 
 void OFKTBaseNode::addChild(OFKTNode* node)
@@ -131,7 +99,6 @@ const std::vector<const OFKTNode*>& OFKTBaseNode::getChildren() const { return c
 OFKTRootNode::OFKTRootNode(std::string link_name)
   : OFKTBaseNode(tesseract_scene_graph::JointType::FIXED, nullptr, std::move(link_name))
 {
-  update_world_required_ = false;
 }
 
 void OFKTRootNode::setParent(OFKTNode* /*parent*/)
@@ -139,20 +106,11 @@ void OFKTRootNode::setParent(OFKTNode* /*parent*/)
   throw std::runtime_error("OFKTRootNode: does not have a parent!");
 }
 
-void OFKTRootNode::storeJointValue(double /*joint_value*/)
-{
-  throw std::runtime_error("OFKTRootNode: does not have a joint value!");
-}
-
 void OFKTRootNode::setStaticTransformation(const Eigen::Isometry3d& /*static_tf*/)
 {
   throw std::runtime_error("OFKTRootNode: does not have a static transform!");
 }
 
-void OFKTRootNode::computeAndStoreLocalTransformation() {}
-void OFKTRootNode::computeAndStoreWorldTransformation() {}
-bool OFKTRootNode::updateWorldTransformationRequired() const { return false; }
-
 Eigen::Isometry3d OFKTRootNode::computeLocalTransformation(double /*joint_value*/) const { return static_tf_; }
 
 /**********************************************************************/
@@ -168,26 +126,9 @@ OFKTFixedNode::OFKTFixedNode(OFKTNode* parent,
                  std::move(joint_name),
                  static_tf)
 {
-  OFKTBaseNode::computeAndStoreWorldTransformation();
-}
-
-void OFKTFixedNode::storeJointValue(double /*joint_value*/)
-{
-  throw std::runtime_error("OFKTFixedNode: does not have a joint value!");
 }
 
-double OFKTFixedNode::getJointValue() const { throw std::runtime_error("OFKTFixedNode: does not have a joint value!"); }
-
-void OFKTFixedNode::setStaticTransformation(const Eigen::Isometry3d& static_tf)
-{
-  static_tf_ = static_tf;
-  local_tf_ = static_tf;
-  update_world_required_ = true;
-}
-
-void OFKTFixedNode::computeAndStoreLocalTransformation() {}
-
-Eigen::Isometry3d OFKTFixedNode::computeLocalTransformation(double /*joint_value*/) const { return local_tf_; }
+Eigen::Isometry3d OFKTFixedNode::computeLocalTransformation(double /*joint_value*/) const { return static_tf_; }
 
 /*********************************************************************/
 /************************* REVOLUTE NODE *****************************/
@@ -205,21 +146,8 @@ OFKTRevoluteNode::OFKTRevoluteNode(OFKTNode* parent,
   , axis_(axis.normalized())
 {
   local_twist_.tail(3) = axis_;
-  computeAndStoreLocalTransformationImpl();
-  OFKTBaseNode::computeAndStoreWorldTransformation();
-}
-
-void OFKTRevoluteNode::storeJointValue(double joint_value) { OFKTBaseNode::storeJointValue(joint_value); }
-
-void OFKTRevoluteNode::computeAndStoreLocalTransformationImpl()
-{
-  joint_tf_ = Eigen::AngleAxisd(joint_value_, axis_);
-  local_tf_ = static_tf_ * joint_tf_;
-  joint_value_changed_ = false;
 }
 
-void OFKTRevoluteNode::computeAndStoreLocalTransformation() { computeAndStoreLocalTransformationImpl(); }
-
 Eigen::Isometry3d OFKTRevoluteNode::computeLocalTransformation(double joint_value) const
 {
   return static_tf_ * Eigen::AngleAxisd(joint_value, axis_);
@@ -243,19 +171,8 @@ OFKTContinuousNode::OFKTContinuousNode(OFKTNode* parent,
   , axis_(axis.normalized())
 {
   local_twist_.tail(3) = axis_;
-  computeAndStoreLocalTransformationImpl();
-  OFKTBaseNode::computeAndStoreWorldTransformation();
 }
 
-void OFKTContinuousNode::computeAndStoreLocalTransformationImpl()
-{
-  joint_tf_ = Eigen::AngleAxisd(joint_value_, axis_);
-  local_tf_ = static_tf_ * joint_tf_;
-  joint_value_changed_ = false;
-}
-
-void OFKTContinuousNode::computeAndStoreLocalTransformation() { computeAndStoreLocalTransformationImpl(); }
-
 Eigen::Isometry3d OFKTContinuousNode::computeLocalTransformation(double joint_value) const
 {
   return static_tf_ * Eigen::AngleAxisd(joint_value, axis_);
@@ -279,19 +196,8 @@ OFKTPrismaticNode::OFKTPrismaticNode(OFKTNode* parent,
   , axis_(axis.normalized())
 {
   local_twist_.head(3) = axis_;
-  computeAndStoreLocalTransformationImpl();
-  OFKTBaseNode::computeAndStoreWorldTransformation();
 }
 
-void OFKTPrismaticNode::computeAndStoreLocalTransformationImpl()
-{
-  joint_tf_ = Eigen::Translation3d(joint_value_ * axis_);
-  local_tf_ = static_tf_ * joint_tf_;
-  joint_value_changed_ = false;
-}
-
-void OFKTPrismaticNode::computeAndStoreLocalTransformation() { computeAndStoreLocalTransformationImpl(); }
-
 Eigen::Isometry3d OFKTPrismaticNode::computeLocalTransformation(double joint_value) const
 {
   return static_tf_ * Eigen::Translation3d(joint_value * axis_);
@@ -97,9 +97,6 @@ void OFKTStateSolver::cloneHelper(OFKTStateSolver& cloned, const OFKTNode* node)
 
       auto n = std::make_unique<OFKTRevoluteNode>(
           parent_node, cn->getLinkName(), cn->getJointName(), cn->getStaticTransformation(), cn->getAxis());
-      n->local_tf_ = cn->getLocalTransformation();
-      n->world_tf_ = cn->getWorldTransformation();
-      n->joint_value_ = cn->getJointValue();
 
       cloned.link_map_[cn->getLinkName()] = n.get();
       parent_node->addChild(n.get());
@@ -111,9 +108,6 @@ void OFKTStateSolver::cloneHelper(OFKTStateSolver& cloned, const OFKTNode* node)
 
       auto n = std::make_unique<OFKTContinuousNode>(
           parent_node, cn->getLinkName(), cn->getJointName(), cn->getStaticTransformation(), cn->getAxis());
-      n->local_tf_ = cn->getLocalTransformation();
-      n->world_tf_ = cn->getWorldTransformation();
-      n->joint_value_ = cn->getJointValue();
 
       cloned.link_map_[cn->getLinkName()] = n.get();
       parent_node->addChild(n.get());
@@ -125,9 +119,6 @@ void OFKTStateSolver::cloneHelper(OFKTStateSolver& cloned, const OFKTNode* node)
 
       auto n = std::make_unique<OFKTPrismaticNode>(
           parent_node, cn->getLinkName(), cn->getJointName(), cn->getStaticTransformation(), cn->getAxis());
-      n->local_tf_ = cn->getLocalTransformation();
-      n->world_tf_ = cn->getWorldTransformation();
-      n->joint_value_ = cn->getJointValue();
 
       cloned.link_map_[cn->getLinkName()] = n.get();
       parent_node->addChild(n.get());
@@ -152,7 +143,9 @@ OFKTStateSolver::OFKTStateSolver(const std::string& root_name)
   root_ = std::make_unique<OFKTRootNode>(root_name);
   link_map_[root_name] = root_.get();
   link_names_ = { root_name };
-  current_state_.link_transforms[root_name] = root_->getWorldTransformation();
+  current_state_.link_transforms[root_name] = Eigen::Isometry3d::Identity();
+  changed_links_ = { 1 };
+  update();
 }
 
 OFKTStateSolver::OFKTStateSolver(const OFKTStateSolver& other) { *this = other; }
@@ -167,6 +160,13 @@ OFKTStateSolver& OFKTStateSolver::operator=(const OFKTStateSolver& other)
   link_map_[other.root_->getLinkName()] = root_.get();
   limits_ = other.limits_;
   revision_ = other.revision_;
+  changed_links_ = other.changed_links_;
+  {
+    std::lock_guard<std::mutex> tree_lock(other.tree_mutex_);
+    layout_ = other.layout_;
+  }
+  std::atomic_store(&tree_, std::atomic_load(&other.tree_));
+  current_compact_state_ = other.current_compact_state_;
   cloneHelper(*this, other.root_.get());
   return *this;
 }
@@ -201,33 +201,28 @@ void OFKTStateSolver::clear()
   link_map_.clear();
   limits_ = tesseract_common::KinematicLimits();
   root_ = nullptr;
+  changed_links_.clear();
+  layout_ = nullptr;
+  resetKinematicTree();
+  current_compact_state_ = CompactSceneState();
 }
 
 void OFKTStateSolver::setState(const Eigen::Ref<const Eigen::VectorXd>& joint_values)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
   assert(active_joint_names_.size() == static_cast<std::size_t>(joint_values.size()));
-  Eigen::VectorXd jv = joint_values;
-  for (std::size_t i = 0; i < active_joint_names_.size(); ++i)
-  {
-    nodes_[active_joint_names_[i]]->storeJointValue(joint_values(static_cast<long>(i)));
-    current_state_.joints[active_joint_names_[i]] = joint_values(static_cast<long>(i));
-  }
-
-  update(root_.get(), false);
+  update(joint_values);
 }
 
 void OFKTStateSolver::setState(const std::unordered_map<std::string, double>& joint_values)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
-
+  OFKTKinematicTree::ConstPtr tree = getKinematicTreeHelper();
+  Eigen::VectorXd jv = getCurrentJointValuesHelper(*tree->layout);
   for (const auto& joint : joint_values)
-  {
-    nodes_[joint.first]->storeJointValue(joint.second);
-    current_state_.joints[joint.first] = joint.second;
-  }
+    jv(static_cast<Eigen::Index>(tree->layout->getJointIndex(joint.first))) = joint.second;
 
-  update(root_.get(), false);
+  update(jv);
 }
 
 void OFKTStateSolver::setState(const std::vector<std::string>& joint_names,
@@ -235,49 +230,70 @@ void OFKTStateSolver::setState(const std::vector<std::string>& joint_names,
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
   assert(joint_names.size() == static_cast<std::size_t>(joint_values.size()));
-  Eigen::VectorXd jv = joint_values;
+  OFKTKinematicTree::ConstPtr tree = getKinematicTreeHelper();
+  Eigen::VectorXd jv = getCurrentJointValuesHelper(*tree->layout);
   for (std::size_t i = 0; i < joint_names.size(); ++i)
-  {
-    nodes_[joint_names[i]]->storeJointValue(joint_values(static_cast<long>(i)));
-    current_state_.joints[joint_names[i]] = joint_values(static_cast<long>(i));
-  }
+    jv(static_cast<Eigen::Index>(tree->layout->getJointIndex(joint_names[i]))) = joint_values(static_cast<long>(i));
 
-  update(root_.get(), false);
+  update(jv);
 }
 
 SceneState OFKTStateSolver::getState(const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  assert(static_cast<Eigen::Index>(active_joint_names_.size()) == joint_values.size());
-  auto state = SceneState(current_state_);
-  for (std::size_t i = 0; i < active_joint_names_.size(); ++i)
-    state.joints[active_joint_names_[i]] = joint_values[static_cast<long>(i)];
-
-  update(state, root_.get(), Eigen::Isometry3d::Identity(), false);
-  return state;
+  OFKTKinematicTree::ConstPtr tree = getKinematicTree();
+  assert(static_cast<Eigen::Index>(tree->layout->joint_names.size()) == joint_values.size());
+  CompactSceneState state(tree->layout);
+  state.joints = joint_values;
+  tree->calcLinkTransforms(state.link_transforms, 0, joint_values);
+  return state.toSceneState();
 }
 
 SceneState OFKTStateSolver::getState(const std::unordered_map<std::string, double>& joint_values) const
 {
-  auto state = SceneState(current_state_);
+  OFKTKinematicTree::ConstPtr tree;
+  Eigen::VectorXd jv;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    tree = getKinematicTreeHelper();
+    jv = getCurrentJointValuesHelper(*tree->layout);
+  }
+
   for (const auto& joint : joint_values)
-    state.joints[joint.first] = joint.second;
+  {
+    auto it = tree->layout->joint_indices.find(joint.first);
+    if (it != tree->layout->joint_indices.end())
+      jv(static_cast<Eigen::Index>(it->second)) = joint.second;
+  }
 
-  update(state, root_.get(), Eigen::Isometry3d::Identity(), false);
-  return state;
+  CompactSceneState state(tree->layout);
+  state.joints = jv;
+  tree->calcLinkTransforms(state.link_transforms, 0, jv);
+  return state.toSceneState();
 }
 
 SceneState OFKTStateSolver::getState(const std::vector<std::string>& joint_names,
                                      const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
   assert(static_cast<Eigen::Index>(joint_names.size()) == joint_values.size());
-  auto state = SceneState(current_state_);
+  OFKTKinematicTree::ConstPtr tree;
+  Eigen::VectorXd jv;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    tree = getKinematicTreeHelper();
+    jv = getCurrentJointValuesHelper(*tree->layout);
+  }
+
   for (std::size_t i = 0; i < joint_names.size(); ++i)
-    state.joints[joint_names[i]] = joint_values[static_cast<long>(i)];
+  {
+    auto it = tree->layout->joint_indices.find(joint_names[i]);
+    if (it != tree->layout->joint_indices.end())
+      jv(static_cast<Eigen::Index>(it->second)) = joint_values[static_cast<long>(i)];
+  }
 
-  update(state, root_.get(), Eigen::Isometry3d::Identity(), false);
-  return state;
+  CompactSceneState state(tree->layout);
+  state.joints = jv;
+  tree->calcLinkTransforms(state.link_transforms, 0, jv);
+  return state.toSceneState();
 }
 
 SceneState OFKTStateSolver::getState() const
@@ -286,78 +302,126 @@ SceneState OFKTStateSolver::getState() const
   return current_state_;
 }
 
-SceneState OFKTStateSolver::getRandomState() const
+std::shared_ptr<const SceneStateLayout> OFKTStateSolver::getCompactStateLayout() const
+{
+  return getKinematicTree()->layout;
+}
+
+void OFKTStateSolver::getCompactState(CompactSceneState& state,
+                                      const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  OFKTKinematicTree::ConstPtr tree = getKinematicTree();
+  assert(static_cast<Eigen::Index>(tree->layout->joint_names.size()) == joint_values.size());
+  if (state.layout != tree->layout)
+    state.setLayout(tree->layout);
+
+  state.joints = joint_values;
+  tree->calcLinkTransforms(state.link_transforms, 0, joint_values);
+}
+
+void OFKTStateSolver::getCompactState(CompactSceneState& state) const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  return getState(active_joint_names_, tesseract_common::generateRandomNumber(limits_.joint_limits));
+  if (state.layout != current_compact_state_.layout)
+    state.setLayout(current_compact_state_.layout);
+
+  state.joints = current_compact_state_.joints;
+  state.link_transforms = current_compact_state_.link_transforms;
+}
+
+void OFKTStateSolver::getStates(tesseract_common::VectorIsometry3d& link_transforms,
+                                const Eigen::Ref<const tesseract_common::TrajArray>& joint_values) const
+{
+  OFKTKinematicTree::ConstPtr tree = getKinematicTree();
+  assert(static_cast<Eigen::Index>(tree->layout->joint_names.size()) == joint_values.cols());
+  const auto size = static_cast<std::size_t>(joint_values.rows()) * tree->layout->link_names.size();
+  if (link_transforms.size() != size)
+    link_transforms.resize(size);
+
+  tree->calcLinkTransforms(link_transforms, joint_values);
+}
+
+SceneState OFKTStateSolver::getRandomState() const
+{
+  Eigen::VectorXd joint_values;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    joint_values = tesseract_common::generateRandomNumber(limits_.joint_limits);
+  }
+  return getState(joint_values);
 }
 
 Eigen::MatrixXd OFKTStateSolver::getJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
                                              const std::string& link_name) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  std::unordered_map<std::string, double> joints = current_state_.joints;
-  for (Eigen::Index i = 0; i < joint_values.rows(); ++i)
-    joints[active_joint_names_[static_cast<std::size_t>(i)]] = joint_values[i];
-
-  return calcJacobianHelper(joints, link_name);
+  OFKTKinematicTree::ConstPtr tree = getKinematicTree();
+  Eigen::MatrixXd jacobian(6, static_cast<Eigen::Index>(tree->layout->joint_names.size()));
+  tree->calcJacobian(jacobian, joint_values, tree->layout->getLinkIndex(link_name));
+  return jacobian;
 }
 
 Eigen::MatrixXd OFKTStateSolver::getJacobian(const std::unordered_map<std::string, double>& joints_values,
                                              const std::string& link_name) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  std::unordered_map<std::string, double> joints = current_state_.joints;
+  OFKTKinematicTree::ConstPtr tree;
+  Eigen::VectorXd jv;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    tree = getKinematicTreeHelper();
+    jv = getCurrentJointValuesHelper(*tree->layout);
+  }
+
   for (const auto& joint : joints_values)
-    joints[joint.first] = joint.second;
+  {
+    auto it = tree->layout->joint_indices.find(joint.first);
+    if (it != tree->layout->joint_indices.end())
+      jv(static_cast<Eigen::Index>(it->second)) = joint.second;
+  }
 
-  return calcJacobianHelper(joints, link_name);
+  Eigen::MatrixXd jacobian(6, jv.size());
+  tree->calcJacobian(jacobian, jv, tree->layout->getLinkIndex(link_name));
+  return jacobian;
 }
 
 Eigen::MatrixXd OFKTStateSolver::getJacobian(const std::vector<std::string>& joint_names,
                                              const Eigen::Ref<const Eigen::VectorXd>& joint_values,
                                              const std::string& link_name) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  std::unordered_map<std::string, double> joints = current_state_.joints;
+  OFKTKinematicTree::ConstPtr tree;
+  Eigen::VectorXd jv;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    tree = getKinematicTreeHelper();
+    jv = getCurrentJointValuesHelper(*tree->layout);
+  }
+
   for (Eigen::Index i = 0; i < joint_values.rows(); ++i)
-    joints[joint_names[static_cast<std::size_t>(i)]] = joint_values[i];
+  {
+    auto it = tree->layout->joint_indices.find(joint_names[static_cast<std::size_t>(i)]);
+    if (it != tree->layout->joint_indices.end())
+      jv(static_cast<Eigen::Index>(it->second)) = joint_values[i];
+  }
 
-  return calcJacobianHelper(joints, link_name);
+  Eigen::MatrixXd jacobian(6, jv.size());
+  tree->calcJacobian(jacobian, jv, tree->layout->getLinkIndex(link_name));
+  return jacobian;
 }
 
-Eigen::MatrixXd OFKTStateSolver::calcJacobianHelper(const std::unordered_map<std::string, double>& joints,
-                                                    const std::string& link_name) const
+void OFKTStateSolver::getJacobians(Eigen::Ref<Eigen::MatrixXd> jacobians,
+                                   const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                                   const std::vector<std::string>& link_names,
+                                   const tesseract_common::VectorVector3d& link_points) const
 {
-  OFKTNode* node = link_map_.at(link_name);
-  Eigen::MatrixXd jacobian = Eigen::MatrixXd::Zero(6, static_cast<Eigen::Index>(active_joint_names_.size()));
-
-  Eigen::Isometry3d total_tf{ Eigen::Isometry3d::Identity() };
-  while (node != root_.get())
-  {
-    if (node->getType() == JointType::FIXED || node->getType() == JointType::FLOATING)
-    {
-      total_tf = node->getLocalTransformation() * total_tf;
-    }
-    else
-    {
-      Eigen::Isometry3d local_tf = node->computeLocalTransformation(joints.at(node->getJointName()));
-      total_tf = local_tf * total_tf;
-
-      Eigen::Index idx =
-          std::distance(active_joint_names_.begin(),
-                        std::find(active_joint_names_.begin(), active_joint_names_.end(), node->getJointName()));
-      Eigen::VectorXd twist = node->getLocalTwist();
-      tesseract_common::twistChangeRefPoint(twist, total_tf.translation() - local_tf.translation());
-      tesseract_common::twistChangeBase(twist, total_tf.inverse());
-      jacobian.col(idx) = twist;
-    }
+  OFKTKinematicTree::ConstPtr tree = getKinematicTree();
+  assert(static_cast<Eigen::Index>(tree->layout->joint_names.size()) == joint_values.size());
 
-    node = node->getParent();
-  }
+  // The link transforms are thread local so repeated calls do not allocate
+  thread_local tesseract_common::VectorIsometry3d link_transforms;
+  if (link_transforms.size() != tree->link_nodes.size())
+    link_transforms.resize(tree->link_nodes.size());
 
-  tesseract_common::jacobianChangeBase(jacobian, total_tf);
-  return jacobian;
+  tree->calcLinkTransforms(link_transforms, 0, joint_values);
+  tree->calcJacobians(jacobians, link_transforms, link_names, link_points);
 }
 
 std::vector<std::string> OFKTStateSolver::getJointNames() const
@@ -417,12 +481,7 @@ bool OFKTStateSolver::hasLinkName(const std::string& link_name) const
 
 tesseract_common::VectorIsometry3d OFKTStateSolver::getLinkTransforms() const
 {
-  tesseract_common::VectorIsometry3d link_tfs;
-  link_tfs.reserve(current_state_.link_transforms.size());
-  for (const auto& link_name : link_names_)
-    link_tfs.push_back(current_state_.link_transforms.at(link_name));
-
-  return link_tfs;
+  return current_compact_state_.link_transforms;
 }
 
 Eigen::Isometry3d OFKTStateSolver::getLinkTransform(const std::string& link_name) const
@@ -442,6 +501,25 @@ tesseract_common::KinematicLimits OFKTStateSolver::getLimits() const
   return limits_;
 }
 
+std::vector<std::string> OFKTStateSolver::getChangedLinkNames() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  std::vector<std::string> changed_link_names;
+  for (std::size_t i = 0; i < changed_links_.size(); ++i)
+  {
+    if (changed_links_[i] != 0)
+      changed_link_names.push_back(link_names_[i]);
+  }
+
+  return changed_link_names;
+}
+
+void OFKTStateSolver::clearChangedLinkNames()
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  std::fill(changed_links_.begin(), changed_links_.end(), 0);
+}
+
 bool OFKTStateSolver::addLink(const Link& link, const Joint& joint)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
@@ -459,7 +537,7 @@ bool OFKTStateSolver::addLink(const Link& link, const Joint& joint)
   addNode(joint, joint.getName(), joint.parent_link_name, joint.child_link_name, new_joint_limits);
   addNewJointLimits(new_joint_limits);
 
-  update(root_.get(), false);
+  update();
 
   return true;
 }
@@ -498,7 +576,7 @@ bool OFKTStateSolver::replaceJoint(const Joint& joint)
   replaceJointHelper(new_joint_limits, joint);
   addNewJointLimits(new_joint_limits);
 
-  update(root_.get(), false);
+  update();
 
   return true;
 }
@@ -524,7 +602,7 @@ bool OFKTStateSolver::moveLink(const Joint& joint)
   moveLinkHelper(new_joint_limits, joint);
   addNewJointLimits(new_joint_limits);
 
-  update(root_.get(), false);
+  update();
 
   return true;
 }
@@ -556,7 +634,7 @@ bool OFKTStateSolver::removeLink(const std::string& name)
   // Remove deleted joints
   removeJointHelper(removed_links, removed_joints, removed_active_joints, removed_active_joints_indices);
 
-  update(root_.get(), false);
+  update();
 
   return true;
 }
@@ -588,7 +666,7 @@ bool OFKTStateSolver::removeJoint(const std::string& name)
   // Remove deleted joints
   removeJointHelper(removed_links, removed_joints, removed_active_joints, removed_active_joints_indices);
 
-  update(root_.get(), false);
+  update();
 
   return true;
 }
@@ -616,8 +694,9 @@ bool OFKTStateSolver::moveJoint(const std::string& name, const std::string& pare
   OFKTNode* new_parent = link_map_[parent_link];
   n->setParent(new_parent);
   new_parent->addChild(n.get());
+  resetKinematicTree();
 
-  update(root_.get(), false);
+  update();
 
   return true;
 }
@@ -633,8 +712,9 @@ bool OFKTStateSolver::changeJointOrigin(const std::string& name, const Eigen::Is
   }
 
   it->second->setStaticTransformation(new_origin);
+  resetKinematicTree();
 
-  update(root_.get(), false);
+  update();
 
   return true;
 }
@@ -762,7 +842,7 @@ bool OFKTStateSolver::insertSceneGraph(const SceneGraph& scene_graph, const Join
   // Populate Joint Limits
   addNewJointLimits(new_joints_limits);
 
-  update(root_.get(), false);
+  update();
   return true;
 }
 
@@ -805,60 +885,154 @@ void OFKTStateSolver::loadStaticLinkNamesRecursive(std::vector<std::string>& sta
   }
 }
 
-void OFKTStateSolver::update(OFKTNode* node, bool update_required)
+void OFKTStateSolver::update()
 {
-  if (node->hasJointValueChanged())
+  OFKTKinematicTree::ConstPtr tree = getKinematicTreeHelper();
+  Eigen::VectorXd joint_values = getCurrentJointValuesHelper(*tree->layout);
+  if (current_compact_state_.layout != tree->layout)
+    current_compact_state_.setLayout(tree->layout);
+
+  current_compact_state_.joints = joint_values;
+  tree->calcLinkTransforms(current_compact_state_.link_transforms, 0, joint_values);
+
+  // Any link may have moved so every link is compared to its previous transform, the root never moves
+  for (std::size_t i = 1; i < tree->size(); ++i)
   {
-    node->computeAndStoreLocalTransformation();
-    update_required = true;
+    const std::size_t link_index = tree->link_indices[i];
+    const Eigen::Isometry3d& link_tf = current_compact_state_.link_transforms[link_index];
+    Eigen::Isometry3d& current_link_tf = current_state_.link_transforms[tree->layout->link_names[link_index]];
+    if (current_link_tf.matrix() != link_tf.matrix())
+    {
+      current_link_tf = link_tf;
+      current_state_.joint_transforms[tree->layout->link_joint_names[link_index]] = link_tf;
+      changed_links_[link_index] = 1;
+    }
   }
+}
 
-  if (node->updateWorldTransformationRequired())
-    update_required = true;
+void OFKTStateSolver::update(const Eigen::Ref<const Eigen::VectorXd>& joint_values)
+{
+  OFKTKinematicTree::ConstPtr tree = getKinematicTreeHelper();
+  if (current_compact_state_.layout != tree->layout)
+    update();
+
+  tree->updateLinkTransforms(
+      current_compact_state_.link_transforms, joint_values, current_compact_state_.joints, changed_nodes_);
 
-  if (update_required)
+  for (std::size_t i = 1; i < tree->size(); ++i)
   {
-    node->computeAndStoreWorldTransformation();
-    current_state_.link_transforms[node->getLinkName()] = node->getWorldTransformation();
-    current_state_.joint_transforms[node->getJointName()] = node->getWorldTransformation();
+    if (changed_nodes_[i] == 0)
+      continue;
+
+    const std::size_t link_index = tree->link_indices[i];
+    const Eigen::Isometry3d& link_tf = current_compact_state_.link_transforms[link_index];
+    current_state_.link_transforms[tree->layout->link_names[link_index]] = link_tf;
+    current_state_.joint_transforms[tree->layout->link_joint_names[link_index]] = link_tf;
+    changed_links_[link_index] = 1;
   }
 
-  for (auto* child : node->getChildren())
-    update(child, update_required);
+  for (Eigen::Index i = 0; i < joint_values.size(); ++i)
+  {
+    if (joint_values(i) != current_compact_state_.joints(i))
+      current_state_.joints[tree->layout->joint_names[static_cast<std::size_t>(i)]] = joint_values(i);
+  }
+
+  current_compact_state_.joints = joint_values;
 }
 
-void OFKTStateSolver::update(SceneState& state,
-                             const OFKTNode* node,
-                             const Eigen::Isometry3d& parent_world_tf,
-                             bool update_required) const
+OFKTKinematicTree::ConstPtr OFKTStateSolver::getKinematicTree() const
 {
-  Eigen::Isometry3d updated_parent_world_tf{ Eigen::Isometry3d::Identity() };
-  if (node->getType() != tesseract_scene_graph::JointType::FIXED)
-  {
-    double jv = state.joints[node->getJointName()];
-    if (!tesseract_common::almostEqualRelativeAndAbs(node->getJointValue(), jv, 1e-8))
-    {
-      updated_parent_world_tf = parent_world_tf * node->computeLocalTransformation(jv);
-      update_required = true;
-    }
-    else
-    {
-      updated_parent_world_tf = parent_world_tf * node->getLocalTransformation();
-    }
-  }
-  else
+  OFKTKinematicTree::ConstPtr tree = std::atomic_load(&tree_);
+  if (tree != nullptr)
+    return tree;
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return getKinematicTreeHelper();
+}
+
+OFKTKinematicTree::ConstPtr OFKTStateSolver::getKinematicTreeHelper() const
+{
+  std::lock_guard<std::mutex> tree_lock(tree_mutex_);
+  OFKTKinematicTree::ConstPtr tree = std::atomic_load(&tree_);
+  if (tree != nullptr)
+    return tree;
+
+  if (layout_ == nullptr)
   {
-    updated_parent_world_tf = parent_world_tf * node->getLocalTransformation();
+    std::vector<std::string> link_joint_names;
+    link_joint_names.reserve(link_names_.size());
+    for (const auto& link_name : link_names_)
+      link_joint_names.push_back(link_map_.at(link_name)->getJointName());
+
+    layout_ = std::make_shared<const SceneStateLayout>(active_joint_names_, link_names_, std::move(link_joint_names));
   }
 
-  if (update_required)
+  auto new_tree = std::make_shared<OFKTKinematicTree>();
+  new_tree->layout = layout_;
+  new_tree->parent_indices.reserve(link_names_.size());
+  new_tree->joint_types.reserve(link_names_.size());
+  new_tree->static_transforms.reserve(link_names_.size());
+  new_tree->axes.reserve(link_names_.size());
+  new_tree->joint_indices.reserve(link_names_.size());
+  new_tree->link_indices.reserve(link_names_.size());
+  new_tree->link_nodes.resize(link_names_.size());
+  if (root_ != nullptr)
+    loadKinematicTreeRecursive(*new_tree, root_.get(), 0);
+
+  tree = new_tree;
+  std::atomic_store(&tree_, tree);
+  return tree;
+}
+
+void OFKTStateSolver::loadKinematicTreeRecursive(OFKTKinematicTree& tree,
+                                                 const OFKTNode* node,
+                                                 std::size_t parent_index) const
+{
+  const std::size_t index = tree.size();
+  const std::size_t link_index = tree.layout->getLinkIndex(node->getLinkName());
+  tree.parent_indices.push_back(parent_index);
+  tree.joint_types.push_back(node->getType());
+  tree.static_transforms.push_back(node->getStaticTransformation());
+  tree.link_indices.push_back(link_index);
+  tree.link_nodes[link_index] = index;
+
+  switch (node->getType())
   {
-    state.link_transforms[node->getLinkName()] = updated_parent_world_tf;
-    state.joint_transforms[node->getJointName()] = updated_parent_world_tf;
+    case JointType::REVOLUTE:
+      tree.axes.push_back(static_cast<const OFKTRevoluteNode*>(node)->getAxis());
+      break;
+    case JointType::CONTINUOUS:
+      tree.axes.push_back(static_cast<const OFKTContinuousNode*>(node)->getAxis());
+      break;
+    case JointType::PRISMATIC:
+      tree.axes.push_back(static_cast<const OFKTPrismaticNode*>(node)->getAxis());
+      break;
+    default:
+      tree.axes.emplace_back(Eigen::Vector3d::Zero());
+      break;
   }
 
+  if (node->getType() == JointType::FIXED || node->getType() == JointType::FLOATING)
+    tree.joint_indices.push_back(-1);
+  else
+    tree.joint_indices.push_back(static_cast<Eigen::Index>(tree.layout->getJointIndex(node->getJointName())));
+
   for (const auto* child : node->getChildren())
-    update(state, child, updated_parent_world_tf, update_required);
+    loadKinematicTreeRecursive(tree, child, index);
+}
+
+void OFKTStateSolver::resetKinematicTree() { std::atomic_store(&tree_, OFKTKinematicTree::ConstPtr()); }
+
+Eigen::VectorXd OFKTStateSolver::getCurrentJointValuesHelper(const SceneStateLayout& layout) const
+{
+  if (current_compact_state_.layout.get() == &layout)
+    return current_compact_state_.joints;
+
+  Eigen::VectorXd joint_values(static_cast<Eigen::Index>(layout.joint_names.size()));
+  for (std::size_t i = 0; i < layout.joint_names.size(); ++i)
+    joint_values(static_cast<Eigen::Index>(i)) = current_state_.joints.at(layout.joint_names[i]);
+
+  return joint_values;
 }
 
 bool OFKTStateSolver::initHelper(const tesseract_scene_graph::SceneGraph& scene_graph, const std::string& prefix)
@@ -874,8 +1048,9 @@ bool OFKTStateSolver::initHelper(const tesseract_scene_graph::SceneGraph& scene_
 
   root_ = std::make_unique<OFKTRootNode>(root_name);
   link_map_[root_name] = root_.get();
-  current_state_.link_transforms[root_name] = root_->getWorldTransformation();
+  current_state_.link_transforms[root_name] = Eigen::Isometry3d::Identity();
   link_names_.push_back(root_name);
+  changed_links_.push_back(1);
 
   std::vector<JointLimits::ConstPtr> new_joints_limits;
   new_joints_limits.reserve(scene_graph.getJoints().size());
@@ -898,7 +1073,7 @@ bool OFKTStateSolver::initHelper(const tesseract_scene_graph::SceneGraph& scene_
   addNewJointLimits(new_joints_limits);
 
   // Update transforms
-  update(root_.get(), false);
+  update();
 
   return true;
 }
@@ -943,8 +1118,6 @@ void OFKTStateSolver::moveLinkHelper(std::vector<std::shared_ptr<const JointLimi
     replaced_node->addChild(child);
     child->setParent(replaced_node.get());
   }
-
-  update(replaced_node.get(), true);
 }
 
 void OFKTStateSolver::replaceJointHelper(std::vector<std::shared_ptr<const JointLimits>>& new_joint_limits,
@@ -959,6 +1132,7 @@ void OFKTStateSolver::replaceJointHelper(std::vector<std::shared_ptr<const Joint
     OFKTNode* new_parent = link_map_[joint.parent_link_name];
     n->setParent(new_parent);
     new_parent->addChild(n.get());
+    resetKinematicTree();
   }
   else
   {
@@ -971,8 +1145,20 @@ void OFKTStateSolver::removeJointHelper(const std::vector<std::string>& removed_
                                         const std::vector<std::string>& removed_active_joints,
                                         const std::vector<long>& removed_active_joints_indices)
 {
+  layout_ = nullptr;
+  resetKinematicTree();
+
   if (!removed_links.empty())
   {
+    // The changed link flags are indexed like the link names so they are compacted the same way
+    std::size_t cnt = 0;
+    for (std::size_t i = 0; i < link_names_.size(); ++i)
+    {
+      if (std::find(removed_links.begin(), removed_links.end(), link_names_[i]) == removed_links.end())
+        changed_links_[cnt++] = changed_links_[i];
+    }
+    changed_links_.resize(cnt);
+
     link_names_.erase(std::remove_if(link_names_.begin(),
                                      link_names_.end(),
                                      [removed_links](const std::string& link_name) {
@@ -1034,6 +1220,10 @@ void OFKTStateSolver::addNode(const tesseract_scene_graph::Joint& joint,
                               const std::string& child_link_name,
                               std::vector<std::shared_ptr<const JointLimits>>& new_joint_limits)
 {
+  layout_ = nullptr;
+  resetKinematicTree();
+
+  // The transforms of the new link are calculated by the update which follows every structural change
   switch (joint.type)
   {
     case tesseract_scene_graph::JointType::FIXED:
@@ -1044,8 +1234,8 @@ void OFKTStateSolver::addNode(const tesseract_scene_graph::Joint& joint,
           parent_node, child_link_name, joint_name, joint.parent_to_joint_origin_transform);
       link_map_[child_link_name] = n.get();
       parent_node->addChild(n.get());
-      current_state_.link_transforms[n->getLinkName()] = n->getWorldTransformation();
-      current_state_.joint_transforms[n->getJointName()] = n->getWorldTransformation();
+      current_state_.link_transforms[n->getLinkName()] = Eigen::Isometry3d::Identity();
+      current_state_.joint_transforms[n->getJointName()] = Eigen::Isometry3d::Identity();
       joint_names_.push_back(joint_name);
       link_names_.push_back(n->getLinkName());
       nodes_[joint_name] = std::move(n);
@@ -1060,8 +1250,8 @@ void OFKTStateSolver::addNode(const tesseract_scene_graph::Joint& joint,
       link_map_[child_link_name] = n.get();
       parent_node->addChild(n.get());
       current_state_.joints[joint_name] = 0;
-      current_state_.link_transforms[n->getLinkName()] = n->getWorldTransformation();
-      current_state_.joint_transforms[n->getJointName()] = n->getWorldTransformation();
+      current_state_.link_transforms[n->getLinkName()] = Eigen::Isometry3d::Identity();
+      current_state_.joint_transforms[n->getJointName()] = Eigen::Isometry3d::Identity();
       joint_names_.push_back(joint_name);
       active_joint_names_.push_back(joint_name);
       link_names_.push_back(n->getLinkName());
@@ -1078,8 +1268,8 @@ void OFKTStateSolver::addNode(const tesseract_scene_graph::Joint& joint,
       link_map_[child_link_name] = n.get();
       parent_node->addChild(n.get());
       current_state_.joints[joint_name] = 0;
-      current_state_.link_transforms[n->getLinkName()] = n->getWorldTransformation();
-      current_state_.joint_transforms[n->getJointName()] = n->getWorldTransformation();
+      current_state_.link_transforms[n->getLinkName()] = Eigen::Isometry3d::Identity();
+      current_state_.joint_transforms[n->getJointName()] = Eigen::Isometry3d::Identity();
       joint_names_.push_back(joint_name);
       active_joint_names_.push_back(joint_name);
       link_names_.push_back(n->getLinkName());
@@ -1096,8 +1286,8 @@ void OFKTStateSolver::addNode(const tesseract_scene_graph::Joint& joint,
       link_map_[child_link_name] = n.get();
       parent_node->addChild(n.get());
       current_state_.joints[joint_name] = 0;
-      current_state_.link_transforms[n->getLinkName()] = n->getWorldTransformation();
-      current_state_.joint_transforms[n->getJointName()] = n->getWorldTransformation();
+      current_state_.link_transforms[n->getLinkName()] = Eigen::Isometry3d::Identity();
+      current_state_.joint_transforms[n->getJointName()] = Eigen::Isometry3d::Identity();
       joint_names_.push_back(joint_name);
       active_joint_names_.push_back(joint_name);
       link_names_.push_back(n->getLinkName());
@@ -1112,6 +1302,8 @@ void OFKTStateSolver::addNode(const tesseract_scene_graph::Joint& joint,
     }
       // LCOV_EXCL_STOP
   }
+
+  changed_links_.push_back(1);
 }
 
 void OFKTStateSolver::removeNode(OFKTNode* node,
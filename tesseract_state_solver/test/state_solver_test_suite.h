@@ -353,6 +353,32 @@ inline void runCompareJacobian(StateSolver& state_solver,
   }
 }
 
+/**
+ * @brief Compare the jacobians of multiple links calculated in a single call against the single link jacobians
+ * @param state_solver The state solver
+ * @param jvals The joint values in the order of the state solver's active joint names
+ * @param link_names The link names
+ * @param link_points The link points, if empty the jacobians are compared at the link origins
+ */
+inline void runCompareJacobians(StateSolver& state_solver,
+                                const Eigen::VectorXd& jvals,
+                                const std::vector<std::string>& link_names,
+                                const tesseract_common::VectorVector3d& link_points)
+{
+  Eigen::MatrixXd jacobians(6 * static_cast<Eigen::Index>(link_names.size()), jvals.size());
+  state_solver.getJacobians(jacobians, jvals, link_names, link_points);
+
+  tesseract_common::TransformMap poses = state_solver.getState(jvals).link_transforms;
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+  {
+    Eigen::MatrixXd jacobian = state_solver.getJacobian(jvals, link_names[i]);
+    if (!link_points.empty())
+      tesseract_common::jacobianChangeRefPoint(jacobian, poses[link_names[i]].linear() * link_points[i]);
+
+    EXPECT_TRUE(jacobian.isApprox(jacobians.middleRows(6 * static_cast<Eigen::Index>(i), 6), 1e-6));
+  }
+}
+
 template <typename S>
 inline void runJacobianTest()
 {
@@ -436,6 +462,23 @@ inline void runJacobianTest()
         *state_solver_clone, joint_names_empty, jvals, "", link_point, Eigen::Isometry3d::Identity()));  // NOLINT
   }
 
+  ///////////////////////////////////////////
+  // Test Jacobians of multiple links
+  ///////////////////////////////////////////
+  {
+    tesseract_common::VectorVector3d link_points;
+    for (std::size_t i = 0; i < link_names.size(); ++i)
+      link_points.emplace_back(0.1 * static_cast<double>(i), -0.2, 0.3);
+
+    runCompareJacobians(state_solver, jvals, link_names, {});
+    runCompareJacobians(state_solver, jvals, link_names, link_points);
+    runCompareJacobians(*state_solver_clone, jvals, link_names, link_points);
+
+    Eigen::MatrixXd jacobians(6, jvals.size());
+    EXPECT_ANY_THROW(state_solver.getJacobians(jacobians, jvals, { "" }));         // NOLINT
+    EXPECT_ANY_THROW(state_solver_clone->getJacobians(jacobians, jvals, { "" }));  // NOLINT
+  }
+
   ///////////////////////////////////////////
   // Test Jacobian with change base
   ///////////////////////////////////////////
@@ -1,6 +1,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_state_solver/ofkt/ofkt_nodes.h>
@@ -9,29 +10,87 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 using namespace tesseract_scene_graph;
 
-// Most of OFKT is tested in the tesseract_environment_unit.cpp
-TEST(TesseractStateSolverUnit, OFKTNodeBaseAndFailuresUnit)  // NOLINT
+/** @brief A state solver which only implements the pure virtual methods so the StateSolver defaults are used */
+class DefaultStateSolver : public StateSolver
 {
-  {  // OFKTRootNode
-    OFKTRootNode node("base_link");
-    EXPECT_ANY_THROW(node.setParent(nullptr));                                      // NOLINT
-    EXPECT_ANY_THROW(node.storeJointValue(0));                                      // NOLINT
-    EXPECT_ANY_THROW(node.setStaticTransformation(Eigen::Isometry3d::Identity()));  // NOLINT
-    EXPECT_FALSE(node.updateWorldTransformationRequired());
-    EXPECT_TRUE(Eigen::Isometry3d::Identity().isApprox(node.computeLocalTransformation(0), 1e-6));
-    node.computeAndStoreLocalTransformation();
-    node.computeAndStoreWorldTransformation();
-    EXPECT_TRUE(Eigen::Isometry3d::Identity().isApprox(node.getLocalTransformation(), 1e-6));
-    EXPECT_TRUE(Eigen::Isometry3d::Identity().isApprox(node.getWorldTransformation(), 1e-6));
+public:
+  explicit DefaultStateSolver(const SceneGraph& scene_graph) : solver_(scene_graph) {}
+
+  StateSolver::UPtr clone() const override { return std::make_unique<DefaultStateSolver>(*this); }
+  void setState(const Eigen::Ref<const Eigen::VectorXd>& joint_values) override { solver_.setState(joint_values); }
+  void setState(const std::unordered_map<std::string, double>& joint_values) override
+  {
+    solver_.setState(joint_values);
+  }
+  void setState(const std::vector<std::string>& joint_names,
+                const Eigen::Ref<const Eigen::VectorXd>& joint_values) override
+  {
+    solver_.setState(joint_names, joint_values);
+  }
+  SceneState getState(const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override
+  {
+    return solver_.getState(joint_values);
+  }
+  SceneState getState(const std::unordered_map<std::string, double>& joint_values) const override
+  {
+    return solver_.getState(joint_values);
   }
+  SceneState getState(const std::vector<std::string>& joint_names,
+                      const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override
+  {
+    return solver_.getState(joint_names, joint_values);
+  }
+  SceneState getState() const override { return solver_.getState(); }
+  Eigen::MatrixXd getJacobian(const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                              const std::string& link_name) const override
+  {
+    return solver_.getJacobian(joint_values, link_name);
+  }
+  Eigen::MatrixXd getJacobian(const std::unordered_map<std::string, double>& joint_values,
+                              const std::string& link_name) const override
+  {
+    return solver_.getJacobian(joint_values, link_name);
+  }
+  Eigen::MatrixXd getJacobian(const std::vector<std::string>& joint_names,
+                              const Eigen::Ref<const Eigen::VectorXd>& joint_values,
+                              const std::string& link_name) const override
+  {
+    return solver_.getJacobian(joint_names, joint_values, link_name);
+  }
+  SceneState getRandomState() const override { return solver_.getRandomState(); }
+  std::vector<std::string> getJointNames() const override { return solver_.getJointNames(); }
+  std::vector<std::string> getActiveJointNames() const override { return solver_.getActiveJointNames(); }
+  std::string getBaseLinkName() const override { return solver_.getBaseLinkName(); }
+  std::vector<std::string> getLinkNames() const override { return solver_.getLinkNames(); }
+  std::vector<std::string> getActiveLinkNames() const override { return solver_.getActiveLinkNames(); }
+  std::vector<std::string> getStaticLinkNames() const override { return solver_.getStaticLinkNames(); }
+  bool isActiveLinkName(const std::string& link_name) const override { return solver_.isActiveLinkName(link_name); }
+  bool hasLinkName(const std::string& link_name) const override { return solver_.hasLinkName(link_name); }
+  tesseract_common::VectorIsometry3d getLinkTransforms() const override { return solver_.getLinkTransforms(); }
+  Eigen::Isometry3d getLinkTransform(const std::string& link_name) const override
+  {
+    return solver_.getLinkTransform(link_name);
+  }
+  Eigen::Isometry3d getRelativeLinkTransform(const std::string& from_link_name,
+                                             const std::string& to_link_name) const override
+  {
+    return solver_.getRelativeLinkTransform(from_link_name, to_link_name);
+  }
+  tesseract_common::KinematicLimits getLimits() const override { return solver_.getLimits(); }
+
+private:
+  OFKTStateSolver solver_;
+};
 
+// Most of OFKT is tested in the tesseract_environment_unit.cpp
+TEST(TesseractStateSolverUnit, OFKTNodeBaseAndFailuresUnit)  // NOLINT
+{
   {  // OFKTRootNode
     OFKTRootNode node("base_link");
     EXPECT_ANY_THROW(node.setParent(nullptr));                                      // NOLINT
-    EXPECT_ANY_THROW(node.storeJointValue(0));                                      // NOLINT
     EXPECT_ANY_THROW(node.setStaticTransformation(Eigen::Isometry3d::Identity()));  // NOLINT
-    EXPECT_FALSE(node.updateWorldTransformationRequired());
     EXPECT_TRUE(Eigen::Isometry3d::Identity().isApprox(node.computeLocalTransformation(0), 1e-6));
+    EXPECT_TRUE(Eigen::Isometry3d::Identity().isApprox(node.getStaticTransformation(), 1e-6));
   }
 
   {  // OFKTFixedNode
@@ -39,18 +98,14 @@ TEST(TesseractStateSolverUnit, OFKTNodeBaseAndFailuresUnit)  // NOLINT
     OFKTFixedNode node(&root_node, "base_link", "joint_a1", Eigen::Isometry3d::Identity());
     const OFKTFixedNode& const_node = node;
     EXPECT_TRUE(const_node.getParent() == &root_node);
-    EXPECT_ANY_THROW(node.storeJointValue(M_PI_2));  // NOLINT
-    EXPECT_ANY_THROW(node.getJointValue());          // NOLINT
-    EXPECT_FALSE(node.updateWorldTransformationRequired());
     EXPECT_TRUE(Eigen::Isometry3d::Identity().isApprox(node.computeLocalTransformation(0), 1e-6));
     EXPECT_TRUE(node.getStaticTransformation().isApprox(Eigen::Isometry3d::Identity(), 1e-6));
-    node.computeAndStoreLocalTransformation();
-    EXPECT_TRUE(Eigen::Isometry3d::Identity().isApprox(node.getLocalTransformation(), 1e-6));
 
     Eigen::Isometry3d static_tf = Eigen::Isometry3d::Identity();
     static_tf.translation() = Eigen::Vector3d(1, 2, 3);
     node.setStaticTransformation(static_tf);
     EXPECT_TRUE(node.getStaticTransformation().isApprox(static_tf, 1e-6));
+    EXPECT_TRUE(node.computeLocalTransformation(0).isApprox(static_tf, 1e-6));
   }
 
   {  // OFKTRevoluteNode
@@ -58,16 +113,8 @@ TEST(TesseractStateSolverUnit, OFKTNodeBaseAndFailuresUnit)  // NOLINT
     OFKTRootNode root_node("base_link");
     OFKTRevoluteNode node(&root_node, "base_link", "joint_a1", Eigen::Isometry3d::Identity(), Eigen::Vector3d(0, 0, 1));
     EXPECT_TRUE(node.getParent() == &root_node);
-    EXPECT_FALSE(node.updateWorldTransformationRequired());
     EXPECT_TRUE(node.getAxis().isApprox(Eigen::Vector3d(0, 0, 1), 1e-6));
-    EXPECT_NO_THROW(node.storeJointValue(M_PI_2));  // NOLINT
-    EXPECT_NEAR(node.getJointValue(), M_PI_2, 1e-6);
-    EXPECT_FALSE(node.updateWorldTransformationRequired());
     EXPECT_TRUE(check.isApprox(node.computeLocalTransformation(M_PI_2), 1e-6));
-    node.computeAndStoreLocalTransformation();
-    EXPECT_TRUE(node.getLocalTransformation().isApprox(check, 1e-6));
-    node.computeAndStoreWorldTransformation();
-    EXPECT_TRUE(check.isApprox(node.getWorldTransformation(), 1e-6));
   }
 
   {  // OFKTContinuousNode
@@ -77,16 +124,8 @@ TEST(TesseractStateSolverUnit, OFKTNodeBaseAndFailuresUnit)  // NOLINT
         &root_node, "base_link", "joint_a1", Eigen::Isometry3d::Identity(), Eigen::Vector3d(0, 0, 1));
     const OFKTContinuousNode& const_node = node;
     EXPECT_TRUE(const_node.getParent() == &root_node);
-    EXPECT_FALSE(node.updateWorldTransformationRequired());
     EXPECT_TRUE(node.getAxis().isApprox(Eigen::Vector3d(0, 0, 1), 1e-6));
-    EXPECT_NO_THROW(node.storeJointValue(M_PI_2));  // NOLINT
-    EXPECT_NEAR(node.getJointValue(), M_PI_2, 1e-6);
-    EXPECT_FALSE(node.updateWorldTransformationRequired());
     EXPECT_TRUE(check.isApprox(node.computeLocalTransformation(M_PI_2), 1e-6));
-    node.computeAndStoreLocalTransformation();
-    EXPECT_TRUE(node.getLocalTransformation().isApprox(check, 1e-6));
-    node.computeAndStoreWorldTransformation();
-    EXPECT_TRUE(check.isApprox(node.getWorldTransformation(), 1e-6));
   }
 
   {  // OFKTPrismaticNode
@@ -95,16 +134,8 @@ TEST(TesseractStateSolverUnit, OFKTNodeBaseAndFailuresUnit)  // NOLINT
     OFKTPrismaticNode node(
         &root_node, "base_link", "joint_a1", Eigen::Isometry3d::Identity(), Eigen::Vector3d(1, 0, 0));
     EXPECT_TRUE(node.getParent() == &root_node);
-    EXPECT_FALSE(node.updateWorldTransformationRequired());
     EXPECT_TRUE(node.getAxis().isApprox(Eigen::Vector3d(1, 0, 0), 1e-6));
-    EXPECT_NO_THROW(node.storeJointValue(1.45));  // NOLINT
-    EXPECT_NEAR(node.getJointValue(), 1.45, 1e-6);
-    EXPECT_FALSE(node.updateWorldTransformationRequired());
     EXPECT_TRUE(check.isApprox(node.computeLocalTransformation(1.45), 1e-6));
-    node.computeAndStoreLocalTransformation();
-    EXPECT_TRUE(node.getLocalTransformation().isApprox(check, 1e-6));
-    node.computeAndStoreWorldTransformation();
-    EXPECT_TRUE(check.isApprox(node.getWorldTransformation(), 1e-6));
   }
 }
 
@@ -153,6 +184,301 @@ TEST(TesseractStateSolverUnit, OFKTGetJacobianUnit)  // NOLINT
   test_suite::runJacobianTest<OFKTStateSolver>();
 }
 
+TEST(TesseractStateSolverUnit, OFKTChangedLinkNamesUnit)  // NOLINT
+{
+  tesseract_common::GeneralResourceLocator locator;
+  auto scene_graph = test_suite::getSceneGraph(locator);
+  OFKTStateSolver state_solver(*scene_graph);
+
+  // After construction all links are considered changed
+  std::vector<std::string> changed_link_names = state_solver.getChangedLinkNames();
+  EXPECT_TRUE(tesseract_common::isIdentical(changed_link_names, state_solver.getLinkNames(), false));
+
+  state_solver.clearChangedLinkNames();
+  EXPECT_TRUE(state_solver.getChangedLinkNames().empty());
+
+  // Setting the same value does not change any link
+  state_solver.setState({ { "joint_a7", 0 } });
+  EXPECT_TRUE(state_solver.getChangedLinkNames().empty());
+
+  // Only the links downstream of the moved joint change
+  state_solver.setState({ { "joint_a7", 0.5 } });
+  changed_link_names = state_solver.getChangedLinkNames();
+  EXPECT_TRUE(tesseract_common::isIdentical<std::string>(changed_link_names, { "link_7", "tool0" }, false));
+
+  // Changes accumulate until cleared and are copied by clone
+  state_solver.setState({ { "joint_a6", 0.5 } });
+  StateSolver::UPtr state_solver_clone = state_solver.clone();
+  changed_link_names = state_solver_clone->getChangedLinkNames();
+  EXPECT_TRUE(tesseract_common::isIdentical<std::string>(changed_link_names, { "link_6", "link_7", "tool0" }, false));
+
+  state_solver.clearChangedLinkNames();
+  EXPECT_TRUE(state_solver.getChangedLinkNames().empty());
+  EXPECT_FALSE(state_solver_clone->getChangedLinkNames().empty());
+
+  // Removed links are not reported
+  state_solver.setState({ { "joint_a7", 1.0 } });
+  EXPECT_TRUE(state_solver.removeLink("tool0"));
+  changed_link_names = state_solver.getChangedLinkNames();
+  EXPECT_TRUE(tesseract_common::isIdentical<std::string>(changed_link_names, { "link_7" }, false));
+
+  // Structural changes report the links which moved and the current state matches a full recalculation
+  state_solver.clearChangedLinkNames();
+  Eigen::Isometry3d new_origin = Eigen::Isometry3d::Identity();
+  new_origin.translation() = Eigen::Vector3d(0.1, 0, 0);
+  EXPECT_TRUE(state_solver.changeJointOrigin("joint_a6", new_origin));
+  changed_link_names = state_solver.getChangedLinkNames();
+  EXPECT_TRUE(tesseract_common::isIdentical<std::string>(changed_link_names, { "link_6", "link_7" }, false));
+
+  SceneState current_state = state_solver.getState();
+  Eigen::VectorXd joint_values(static_cast<Eigen::Index>(state_solver.getActiveJointNames().size()));
+  for (std::size_t i = 0; i < state_solver.getActiveJointNames().size(); ++i)
+    joint_values(static_cast<Eigen::Index>(i)) = current_state.joints.at(state_solver.getActiveJointNames()[i]);
+
+  SceneState expected_state = state_solver.getState(joint_values);
+  for (const auto& link_tf : expected_state.link_transforms)
+    EXPECT_TRUE(link_tf.second.isApprox(current_state.link_transforms.at(link_tf.first), 1e-8));
+
+  for (const auto& joint_tf : expected_state.joint_transforms)
+    EXPECT_TRUE(joint_tf.second.isApprox(current_state.joint_transforms.at(joint_tf.first), 1e-8));
+}
+
+TEST(TesseractStateSolverUnit, OFKTCompactStateUnit)  // NOLINT
+{
+  tesseract_common::GeneralResourceLocator locator;
+  auto scene_graph = test_suite::getSceneGraph(locator);
+  OFKTStateSolver state_solver(*scene_graph);
+  KDLStateSolver kdl_state_solver(*scene_graph);
+
+  // The layout is shared until the structure changes
+  SceneStateLayout::ConstPtr layout = state_solver.getCompactStateLayout();
+  EXPECT_EQ(layout, state_solver.getCompactStateLayout());
+  EXPECT_EQ(layout->joint_names, state_solver.getActiveJointNames());
+  EXPECT_EQ(layout->link_names, state_solver.getLinkNames());
+  EXPECT_EQ(layout->link_joint_names.size(), layout->link_names.size());
+  EXPECT_EQ(layout->link_names[layout->getLinkIndex("tool0")], "tool0");
+  EXPECT_ANY_THROW(layout->getJointIndex("does_not_exist"));  // NOLINT
+
+  CompactSceneState state;
+  state_solver.getCompactState(state);
+  EXPECT_EQ(state.layout, layout);
+  test_suite::runCompareSceneStates(state_solver.getState(), state.toSceneState());
+
+  // Filling a state which already has the layout does not reallocate
+  const double* joints_data = state.joints.data();
+  const Eigen::Isometry3d* link_transforms_data = state.link_transforms.data();
+  for (int i = 0; i < 10; ++i)
+  {
+    Eigen::VectorXd joint_values = tesseract_common::generateRandomNumber(state_solver.getLimits().joint_limits);
+    state_solver.getCompactState(state, joint_values);
+    EXPECT_EQ(state.joints.data(), joints_data);
+    EXPECT_EQ(state.link_transforms.data(), link_transforms_data);
+
+    SceneState expected_state = state_solver.getState(joint_values);
+    test_suite::runCompareSceneStates(expected_state, state.toSceneState());
+    EXPECT_TRUE(state.getLinkTransform("tool0").isApprox(expected_state.link_transforms.at("tool0"), 1e-6));
+    EXPECT_NEAR(state.getJointValue("joint_a3"), joint_values(2), 1e-8);
+
+    CompactSceneState kdl_state;
+    kdl_state_solver.getCompactState(kdl_state, joint_values);
+    test_suite::runCompareSceneStates(expected_state, kdl_state.toSceneState());
+  }
+
+  // Converting from a scene state uses the layout
+  CompactSceneState converted_state(layout);
+  converted_state.fromSceneState(state_solver.getState());
+  test_suite::runCompareSceneStates(state_solver.getState(), converted_state.toSceneState());
+
+  // Changing the structure creates a new layout
+  EXPECT_TRUE(state_solver.removeLink("tool0"));
+  SceneStateLayout::ConstPtr new_layout = state_solver.getCompactStateLayout();
+  EXPECT_NE(layout, new_layout);
+  EXPECT_EQ(new_layout->link_names, state_solver.getLinkNames());
+  state_solver.getCompactState(state);
+  EXPECT_EQ(state.layout, new_layout);
+  EXPECT_EQ(state.link_transforms.size(), new_layout->link_names.size());
+  test_suite::runCompareSceneStates(state_solver.getState(), state.toSceneState());
+}
+
+TEST(TesseractStateSolverUnit, OFKTGetStatesUnit)  // NOLINT
+{
+  tesseract_common::GeneralResourceLocator locator;
+  auto scene_graph = test_suite::getSceneGraph(locator);
+  OFKTStateSolver state_solver(*scene_graph);
+  KDLStateSolver kdl_state_solver(*scene_graph);
+
+  // Consecutive states share joint values so the unchanged part of the tree is reused
+  const auto num_joints = static_cast<Eigen::Index>(state_solver.getActiveJointNames().size());
+  tesseract_common::TrajArray joint_values(6, num_joints);
+  joint_values.row(0) = tesseract_common::generateRandomNumber(state_solver.getLimits().joint_limits);
+  for (Eigen::Index i = 1; i < joint_values.rows(); ++i)
+  {
+    joint_values.row(i) = joint_values.row(i - 1);
+    joint_values(i, (i - 1) % num_joints) += 0.1;
+  }
+  joint_values.row(3) = joint_values.row(2);
+
+  SceneStateLayout::ConstPtr layout = state_solver.getCompactStateLayout();
+  const std::size_t num_links = layout->link_names.size();
+
+  tesseract_common::VectorIsometry3d link_transforms;
+  state_solver.getStates(link_transforms, joint_values);
+  EXPECT_EQ(link_transforms.size(), static_cast<std::size_t>(joint_values.rows()) * num_links);
+
+  SceneStateLayout::ConstPtr kdl_layout = kdl_state_solver.getCompactStateLayout();
+  tesseract_common::VectorIsometry3d kdl_link_transforms;
+  kdl_state_solver.getStates(kdl_link_transforms, joint_values);
+  EXPECT_EQ(kdl_link_transforms.size(), link_transforms.size());
+
+  for (Eigen::Index i = 0; i < joint_values.rows(); ++i)
+  {
+    SceneState expected_state = state_solver.getState(joint_values.row(i));
+    for (std::size_t j = 0; j < num_links; ++j)
+    {
+      const Eigen::Isometry3d& expected_tf = expected_state.link_transforms.at(layout->link_names[j]);
+      const std::size_t idx = (static_cast<std::size_t>(i) * num_links) + j;
+      EXPECT_TRUE(link_transforms[idx].isApprox(expected_tf, 1e-6));
+      const std::size_t kdl_idx =
+          (static_cast<std::size_t>(i) * num_links) + kdl_layout->getLinkIndex(layout->link_names[j]);
+      EXPECT_TRUE(kdl_link_transforms[kdl_idx].isApprox(expected_tf, 1e-6));
+    }
+  }
+
+  // A copy of the KDL state solver calculates the same transforms from its own tree
+  StateSolver::UPtr kdl_state_solver_clone = kdl_state_solver.clone();
+  tesseract_common::VectorIsometry3d kdl_clone_link_transforms;
+  kdl_state_solver_clone->getStates(kdl_clone_link_transforms, joint_values);
+  ASSERT_EQ(kdl_clone_link_transforms.size(), kdl_link_transforms.size());
+  for (std::size_t i = 0; i < kdl_link_transforms.size(); ++i)
+    EXPECT_TRUE(kdl_clone_link_transforms[i].isApprox(kdl_link_transforms[i], 1e-8));
+
+  // Calling again with the same number of states does not reallocate
+  const Eigen::Isometry3d* link_transforms_data = link_transforms.data();
+  state_solver.getStates(link_transforms, joint_values);
+  EXPECT_EQ(link_transforms.data(), link_transforms_data);
+
+  // An empty trajectory produces no transforms
+  state_solver.getStates(link_transforms, joint_values.topRows(0));
+  EXPECT_TRUE(link_transforms.empty());
+}
+
+TEST(TesseractStateSolverUnit, StateSolverDefaultsUnit)  // NOLINT
+{
+  tesseract_common::GeneralResourceLocator locator;
+  auto scene_graph = test_suite::getSceneGraph(locator);
+  OFKTStateSolver state_solver(*scene_graph);
+  DefaultStateSolver default_state_solver(*scene_graph);
+
+  // Changes are not tracked so every link is always reported
+  default_state_solver.clearChangedLinkNames();
+  EXPECT_TRUE(tesseract_common::isIdentical(
+      default_state_solver.getChangedLinkNames(), default_state_solver.getLinkNames(), false));
+
+  SceneStateLayout::ConstPtr layout = default_state_solver.getCompactStateLayout();
+  EXPECT_EQ(layout->joint_names, state_solver.getActiveJointNames());
+  EXPECT_EQ(layout->link_names, state_solver.getLinkNames());
+
+  CompactSceneState state;
+  default_state_solver.getCompactState(state);
+  test_suite::runCompareSceneStates(state_solver.getState(), state.toSceneState());
+
+  const auto num_joints = static_cast<Eigen::Index>(state_solver.getActiveJointNames().size());
+  tesseract_common::TrajArray joint_values(3, num_joints);
+  for (Eigen::Index i = 0; i < joint_values.rows(); ++i)
+    joint_values.row(i) = tesseract_common::generateRandomNumber(state_solver.getLimits().joint_limits);
+
+  CompactSceneState expected_state;
+  state_solver.getCompactState(expected_state, joint_values.row(0));
+  default_state_solver.getCompactState(state, joint_values.row(0));
+  EXPECT_TRUE(state.joints.isApprox(expected_state.joints, 1e-8));
+  for (std::size_t j = 0; j < layout->link_names.size(); ++j)
+    EXPECT_TRUE(state.link_transforms[j].isApprox(expected_state.link_transforms[j], 1e-6));
+
+  tesseract_common::VectorIsometry3d link_transforms;
+  tesseract_common::VectorIsometry3d expected_link_transforms;
+  state_solver.getStates(expected_link_transforms, joint_values);
+  default_state_solver.getStates(link_transforms, joint_values);
+  ASSERT_EQ(link_transforms.size(), expected_link_transforms.size());
+  for (std::size_t i = 0; i < link_transforms.size(); ++i)
+    EXPECT_TRUE(link_transforms[i].isApprox(expected_link_transforms[i], 1e-6));
+
+  default_state_solver.getStates(link_transforms, joint_values.topRows(0));
+  EXPECT_TRUE(link_transforms.empty());
+
+  std::vector<std::string> link_names = { "link_1", "link_4", "tool0" };
+  tesseract_common::VectorVector3d link_points = { Eigen::Vector3d(0.1, 0, 0),
+                                                   Eigen::Vector3d(0, 0.2, 0),
+                                                   Eigen::Vector3d(0, 0, 0.3) };
+  Eigen::MatrixXd jacobians(6 * static_cast<Eigen::Index>(link_names.size()), num_joints);
+  Eigen::MatrixXd expected_jacobians(jacobians.rows(), jacobians.cols());
+  state_solver.getJacobians(expected_jacobians, joint_values.row(1), link_names);
+  default_state_solver.getJacobians(jacobians, joint_values.row(1), link_names);
+  EXPECT_TRUE(jacobians.isApprox(expected_jacobians, 1e-6));
+
+  state_solver.getJacobians(expected_jacobians, joint_values.row(1), link_names, link_points);
+  default_state_solver.getJacobians(jacobians, joint_values.row(1), link_names, link_points);
+  EXPECT_TRUE(jacobians.isApprox(expected_jacobians, 1e-6));
+}
+
+TEST(TesseractStateSolverUnit, OFKTConstQueriesUnit)  // NOLINT
+{
+  tesseract_common::GeneralResourceLocator locator;
+  auto scene_graph = test_suite::getSceneGraph(locator);
+  OFKTStateSolver state_solver(*scene_graph);
+
+  // The const queries must account for the rotation of the joint origin
+  Eigen::Isometry3d origin{ Eigen::Isometry3d::Identity() };
+  origin.translation() = Eigen::Vector3d(-0.00043624, 0, 0.36);
+  origin.linear() = Eigen::AngleAxisd(0.5, Eigen::Vector3d(1, 1, 0).normalized()).toRotationMatrix();
+  EXPECT_TRUE(state_solver.changeJointOrigin("joint_a2", origin));
+
+  std::vector<std::string> joint_names = state_solver.getActiveJointNames();
+  std::vector<Eigen::VectorXd> joint_values;
+  std::vector<SceneState> expected_states;
+  std::vector<Eigen::MatrixXd> expected_jacobians;
+  for (int i = 0; i < 10; ++i)
+  {
+    Eigen::VectorXd jv = tesseract_common::generateRandomNumber(state_solver.getLimits().joint_limits);
+    test_suite::runCompareJacobian(
+        state_solver, {}, jv, "tool0", Eigen::Vector3d::Zero(), Eigen::Isometry3d::Identity());
+
+    // The state calculated by the const query must match the state after setting the joint values
+    SceneState state = state_solver.getState(jv);
+    state_solver.setState(jv);
+    test_suite::runCompareSceneStates(state_solver.getState(), state);
+    test_suite::runCompareSceneStates(state, state_solver.getState(joint_names, jv));
+
+    joint_values.push_back(jv);
+    expected_states.push_back(state);
+    expected_jacobians.push_back(state_solver.getJacobian(jv, "tool0"));
+  }
+
+  // The const queries may run from multiple threads while the current state changes
+  std::vector<std::thread> threads;
+  threads.reserve(4);
+  for (int t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&state_solver, &joint_values, &expected_states, &expected_jacobians]() {
+      for (int j = 0; j < 10; ++j)
+      {
+        for (std::size_t i = 0; i < joint_values.size(); ++i)
+        {
+          SceneState state = state_solver.getState(joint_values[i]);
+          const Eigen::Isometry3d& expected_tf = expected_states[i].link_transforms.at("tool0");
+          EXPECT_TRUE(state.link_transforms.at("tool0").isApprox(expected_tf, 1e-6));
+          EXPECT_TRUE(state_solver.getJacobian(joint_values[i], "tool0").isApprox(expected_jacobians[i], 1e-6));
+        }
+      }
+    });
+  }
+
+  for (std::size_t i = 0; i < joint_values.size(); ++i)
+    state_solver.setState(joint_values[i]);
+
+  for (auto& thread : threads)
+    thread.join();
+}
+
 TEST(TesseractStateSolverUnit, OFKTUnit)  // NOLINT
 {
   OFKTStateSolver solver("test");